@@ -0,0 +1,29 @@
+// C entry points for glaze_jl/accounting.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "accounting.hpp"
+
+#include <algorithm>
+
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    size_t glz_jl_live_objects(glz_jl_live_count* out, size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(glz_jl::detail::live_mutex());
+        const auto& counters = glz_jl::detail::live_list();
+        const size_t n = std::min(capacity, counters.size());
+        for (size_t i = 0; i < n; ++i) {
+            const auto& c = *counters[i];
+            out[i].name = c.name;
+            out[i].created = c.created.load(std::memory_order_relaxed);
+            out[i].destroyed = c.destroyed.load(std::memory_order_relaxed);
+            out[i].bytes_created = c.bytes_created.load(std::memory_order_relaxed);
+            out[i].bytes_destroyed = c.bytes_destroyed.load(std::memory_order_relaxed);
+        }
+        return counters.size();
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+// Live-object accounting for heap objects that glaze_jl hands to Glaze.jl.
+//
+// Extension operations that allocate on Julia's behalf (generator cursors and
+// struct elements, range cursors, cancellable futures, stop sources) record
+// every allocation and release here, so that Glaze.live_objects() can report
+// objects Julia never released. Counting is a pair of relaxed atomic
+// increments. The counts are read through glz_jl_live_objects (see
+// accounting.cpp, which must be compiled into exactly one translation unit of
+// the library).
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+extern "C" {
+    // Matches Glaze.NativeLiveCount on the Julia side
+    struct glz_jl_live_count {
+        const char* name;  // static category name
+        uint64_t created;
+        uint64_t destroyed;
+        uint64_t bytes_created;
+        uint64_t bytes_destroyed;
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        struct live_counter;
+
+        inline std::mutex& live_mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        inline std::vector<live_counter*>& live_list()
+        {
+            static std::vector<live_counter*> counters;
+            return counters;
+        }
+
+        struct live_counter {
+            const char* name;
+            std::atomic<uint64_t> created{0};
+            std::atomic<uint64_t> destroyed{0};
+            std::atomic<uint64_t> bytes_created{0};
+            std::atomic<uint64_t> bytes_destroyed{0};
+
+            explicit live_counter(const char* counter_name) : name(counter_name)
+            {
+                std::lock_guard<std::mutex> lock(live_mutex());
+                live_list().push_back(this);
+            }
+        };
+
+        // One counter per C++ type; `name` is used on first use only
+        template <class T>
+        live_counter& live_counter_for(const char* name)
+        {
+            static live_counter counter{name};
+            return counter;
+        }
+    }
+
+    // Record a heap object of type T created for Julia
+    template <class T>
+    void note_new(const char* name, size_t bytes = sizeof(T))
+    {
+        auto& c = detail::live_counter_for<T>(name);
+        c.created.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_created.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    // Record the release of an object counted by note_new<T>
+    template <class T>
+    void note_delete(const char* name, size_t bytes = sizeof(T))
+    {
+        auto& c = detail::live_counter_for<T>(name);
+        c.destroyed.fetch_add(1, std::memory_order_relaxed);
+        c.bytes_destroyed.fetch_add(bytes, std::memory_order_relaxed);
+    }
+}
+
+extern "C" {
+    // Copy up to `capacity` counters into `out`, returning how many counters exist
+    size_t glz_jl_live_objects(glz_jl_live_count* out, size_t capacity);
+}
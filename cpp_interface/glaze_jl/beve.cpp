@@ -0,0 +1,49 @@
+// C entry points for glaze_jl/beve.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "beve.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    // Copied under the lock, since registering a type again replaces its codec
+    glz_jl::detail::beve_codec find_beve_codec(const char* type_name)
+    {
+        std::lock_guard<std::mutex> lock(glz_jl::detail::extension_mutex());
+        auto& codecs = glz_jl::detail::beve_codecs();
+        auto it = codecs.find(type_name);
+        return it == codecs.end() ? glz_jl::detail::beve_codec{} : it->second;
+    }
+}
+
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    size_t glz_jl_write_beve(const char* type_name, const void* object, uint8_t* out, size_t capacity)
+    {
+        const auto codec = find_beve_codec(type_name);
+        if (!codec.write) return SIZE_MAX;
+        std::string buffer;
+        if (!codec.write(object, buffer)) return SIZE_MAX;
+        if (buffer.size() <= capacity) {
+            std::copy(buffer.begin(), buffer.end(), out);
+        }
+        return buffer.size();
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    int glz_jl_read_beve(const char* type_name, void* object, const uint8_t* data, size_t size)
+    {
+        const auto codec = find_beve_codec(type_name);
+        if (!codec.read) return -1;
+        return codec.read(object, std::string_view(reinterpret_cast<const char*>(data), size)) ? 0 : 1;
+    }
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+// Native BEVE encoding of registered types for Glaze.jl.
+//
+// Glaze.jl serializes a CppStruct (Serialization.serialize, Distributed) by
+// encoding the C++ object itself with glz::write_beve when its type is
+// registered here, so every member Glaze can write is included, whether or not
+// Julia can read it. Types not registered here are encoded member by member
+// from Julia, which only covers the members of the interop descriptors.
+//
+// beve.cpp must be compiled into exactly one translation unit of the library.
+
+#include "extensions.hpp"
+
+#include <glaze/glaze.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        struct beve_codec {
+            bool (*write)(const void* object, std::string& out);
+            bool (*read)(void* object, std::string_view data);
+        };
+
+        // Codecs of types registered with register_beve, by registered type name
+        inline std::unordered_map<std::string, beve_codec>& beve_codecs()
+        {
+            static std::unordered_map<std::string, beve_codec> codecs;
+            return codecs;
+        }
+
+        template <class T>
+        bool write_beve_object(const void* object, std::string& out)
+        {
+            return !glz::write_beve(*static_cast<const T*>(object), out);
+        }
+
+        template <class T>
+        bool read_beve_object(void* object, std::string_view data)
+        {
+            return !glz::read_beve(*static_cast<T*>(object), data);
+        }
+    }
+
+    // Encode instances of the registered type `type_name` natively when Julia
+    // serializes them. `type_name` is the name T was registered under with
+    // glz::register_type.
+    //
+    //   glz_jl::register_beve<Person>("Person");
+    template <class T>
+    void register_beve(std::string_view type_name)
+    {
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        detail::beve_codecs()[std::string(type_name)] = {&detail::write_beve_object<T>, &detail::read_beve_object<T>};
+    }
+}
+
+extern "C" {
+    // Encode `object` of the registered type `type_name` as BEVE. Copies the
+    // encoding into `out` when it fits in `capacity` bytes and returns its size
+    // either way; returns SIZE_MAX when the type is not registered with
+    // glz_jl::register_beve or encoding failed.
+    size_t glz_jl_write_beve(const char* type_name, const void* object, uint8_t* out, size_t capacity);
+
+    // Decode `size` bytes of BEVE into `object`. Returns 0 on success, -1 when the
+    // type is not registered and 1 when the data does not match the type.
+    int glz_jl_read_beve(const char* type_name, void* object, const uint8_t* data, size_t size);
+}
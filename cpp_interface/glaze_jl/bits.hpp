@@ -0,0 +1,200 @@
+#pragma once
+
+// Packed bit members for Glaze.jl.
+//
+// Registers std::vector<bool> and std::bitset<N> members as extension members
+// of a registered type (see extensions.hpp). Both store bits packed into
+// machine words, so neither can go through the contiguous bool vector path.
+// The operations table exposes the packed words directly when the standard
+// library's layout allows it (64-bit words, least significant bit first, the
+// same layout as Julia's BitVector chunks) and copies them 64 bits at a time
+// otherwise. A std::vector<bool> member may also be listed in glz::meta; Glaze.jl
+// then uses these operations instead of the contiguous bool vector path.
+
+#include "extensions.hpp"
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_BITS = 69
+    };
+
+    // Operations on one packed bit type (matches Glaze.BitsOps)
+    struct glz_jl_bits_ops {
+        size_t (*size)(void* object);                                  // number of bits
+        uint64_t* (*words)(void* object);                              // packed words, null when not addressable
+        int (*get)(void* object, size_t i);
+        void (*set)(void* object, size_t i, int value);
+        void (*to_words)(void* object, uint64_t* out);                 // (size + 63) / 64 words
+        void (*from_words)(void* object, const uint64_t* in, size_t n); // resizes std::vector<bool> to n bits
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_bits_desc {
+        uint64_t index;          // GLZ_JL_TYPE_BITS
+        uint8_t resizable;       // 1 for std::vector<bool>, 0 for std::bitset
+        uint8_t padding[7];
+        const glz_jl_bits_ops* ops;
+        void* reserved[2];
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class B>
+        struct bits_ops;
+
+        template <class A>
+        struct bits_ops<std::vector<bool, A>> {
+            using V = std::vector<bool, A>;
+
+            static size_t size(void* object) { return static_cast<V*>(object)->size(); }
+
+            static uint64_t* words(void* object)
+            {
+#if defined(__GLIBCXX__)
+                // libstdc++ stores bits LSB-first in an array of _Bit_type starting at begin()._M_p
+                if constexpr (sizeof(std::_Bit_type) == sizeof(uint64_t)) {
+                    auto& v = *static_cast<V*>(object);
+                    return reinterpret_cast<uint64_t*>(v.begin()._M_p);
+                }
+#endif
+                (void)object;
+                return nullptr;
+            }
+
+            static int get(void* object, size_t i) { return (*static_cast<V*>(object))[i] ? 1 : 0; }
+
+            static void set(void* object, size_t i, int value) { (*static_cast<V*>(object))[i] = value != 0; }
+
+            static void to_words(void* object, uint64_t* out)
+            {
+                auto& v = *static_cast<V*>(object);
+                const size_t n = v.size();
+                if (const uint64_t* w = words(object)) {
+                    std::memcpy(out, w, ((n + 63) / 64) * sizeof(uint64_t));
+                    if (n % 64) out[n / 64] &= (uint64_t(1) << (n % 64)) - 1;
+                    return;
+                }
+                for (size_t k = 0; k < (n + 63) / 64; ++k) {
+                    uint64_t word = 0;
+                    const size_t end = (k + 1) * 64 < n ? (k + 1) * 64 : n;
+                    for (size_t i = k * 64; i < end; ++i) {
+                        word |= uint64_t(v[i]) << (i - k * 64);
+                    }
+                    out[k] = word;
+                }
+            }
+
+            static void from_words(void* object, const uint64_t* in, size_t n)
+            {
+                auto& v = *static_cast<V*>(object);
+                v.resize(n);
+                if (uint64_t* w = words(object)) {
+                    std::memcpy(w, in, ((n + 63) / 64) * sizeof(uint64_t));
+                    return;
+                }
+                for (size_t i = 0; i < n; ++i) {
+                    v[i] = (in[i / 64] >> (i % 64)) & 1;
+                }
+            }
+
+            static constexpr glz_jl_bits_ops table{&size, &words, &get, &set, &to_words, &from_words};
+        };
+
+        template <size_t N>
+        struct bits_ops<std::bitset<N>> {
+            using B = std::bitset<N>;
+            static constexpr size_t word_count = (N + 63) / 64;
+
+            static size_t size(void*) { return N; }
+
+            static uint64_t* words(void* object)
+            {
+#if defined(__GLIBCXX__) || defined(_LIBCPP_VERSION)
+                // libstdc++ and libc++ store a bitset as an array of words, LSB-first
+                if constexpr (N > 0 && sizeof(B) == word_count * sizeof(uint64_t) && sizeof(size_t) == sizeof(uint64_t)) {
+                    return reinterpret_cast<uint64_t*>(object);
+                }
+#endif
+                (void)object;
+                return nullptr;
+            }
+
+            static int get(void* object, size_t i) { return static_cast<B*>(object)->test(i) ? 1 : 0; }
+
+            static void set(void* object, size_t i, int value) { static_cast<B*>(object)->set(i, value != 0); }
+
+            static void to_words(void* object, uint64_t* out)
+            {
+                if (const uint64_t* w = words(object)) {
+                    std::memcpy(out, w, word_count * sizeof(uint64_t));
+                    return;
+                }
+                const auto& b = *static_cast<B*>(object);
+                for (size_t k = 0; k < word_count; ++k) {
+                    uint64_t word = 0;
+                    for (size_t i = k * 64; i < N && i < (k + 1) * 64; ++i) {
+                        word |= uint64_t(b[i]) << (i - k * 64);
+                    }
+                    out[k] = word;
+                }
+            }
+
+            static void from_words(void* object, const uint64_t* in, size_t)
+            {
+                if (uint64_t* w = words(object)) {
+                    std::memcpy(w, in, word_count * sizeof(uint64_t));
+                    // Keep the unused high bits clear, as std::bitset expects
+                    if (N % 64) w[word_count - 1] &= (uint64_t(1) << (N % 64)) - 1;
+                    return;
+                }
+                auto& b = *static_cast<B*>(object);
+                for (size_t i = 0; i < N; ++i) {
+                    b[i] = (in[i / 64] >> (i % 64)) & 1;
+                }
+            }
+
+            static constexpr glz_jl_bits_ops table{&size, &words, &get, &set, &to_words, &from_words};
+        };
+
+        template <class T>
+        struct is_vector_bool : std::false_type {};
+
+        template <class A>
+        struct is_vector_bool<std::vector<bool, A>> : std::true_type {};
+
+        inline std::deque<glz_jl_bits_desc>& bits_descs()
+        {
+            static std::deque<glz_jl_bits_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose a std::vector<bool> or std::bitset<N> member on the registered type `owner_type`.
+    //
+    //   glz_jl::register_bits_member<&Mask::selected>("Mask", "selected");
+    template <auto Member>
+    void register_bits_member(std::string_view owner_type, std::string_view name)
+    {
+        using M = typename detail::member_pointer<decltype(Member)>::member_type;
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_bits_desc desc{};
+        desc.index = GLZ_JL_TYPE_BITS;
+        desc.resizable = detail::is_vector_bool<M>::value ? 1 : 0;
+        desc.ops = &detail::bits_ops<M>::table;
+        detail::add_extension_member(owner_type, name, &detail::bits_descs().emplace_back(desc),
+                                     &detail::member_getter<Member>);
+    }
+}
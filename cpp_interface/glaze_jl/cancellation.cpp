@@ -0,0 +1,48 @@
+// C entry points for glaze_jl/cancellation.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "cancellation.hpp"
+
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    void* glz_jl_stop_source_create()
+    {
+        glz_jl::note_new<std::stop_source>("std::stop_source");
+        return new std::stop_source();
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    int glz_jl_stop_source_request(void* source)
+    {
+        return static_cast<std::stop_source*>(source)->request_stop() ? 1 : 0;
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    int glz_jl_stop_source_requested(void* source)
+    {
+        return static_cast<std::stop_source*>(source)->stop_requested() ? 1 : 0;
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    void glz_jl_stop_source_destroy(void* source)
+    {
+        delete static_cast<std::stop_source*>(source);
+        glz_jl::note_delete<std::stop_source>("std::stop_source");
+    }
+}
@@ -0,0 +1,348 @@
+#pragma once
+
+// Cancellable methods for Glaze.jl.
+//
+// Registers member functions that take a std::stop_token as extension members
+// of a registered type (see extensions.hpp). Glaze.jl supplies the token from a
+// std::stop_source it owns, so a Julia task can request a stop with
+// Glaze.cancel while the call, or the std::future / std::shared_future it
+// returned, is still running. The remaining parameters may be arithmetic,
+// std::string or std::string_view.
+//
+// Exceptions thrown by the method, or stored in its future, are caught and
+// reported to Julia as error messages. cancellation.cpp must be compiled into
+// exactly one translation unit of the library.
+
+#include "extensions.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_CANCELLABLE = 75
+    };
+
+    enum : uint8_t {
+        GLZ_JL_RESULT_VOID = 0,
+        GLZ_JL_RESULT_VALUE = 1,    // arithmetic or std::complex, written in place
+        GLZ_JL_RESULT_STRING = 2    // std::string, written as glz_jl_string_arg
+    };
+
+    // Operations on one cancellable method (matches Glaze.CancellableOps).
+    // Functions returning const char* return null on success or an error message
+    // valid until the next call on the thread.
+    struct glz_jl_cancellable_ops {
+        // Calls the method with a token of `source` (a std::stop_source*). Writes
+        // the result to `out`, or for future-returning methods a future handle.
+        const char* (*call)(void* object, const void* const* args, void* source, void* out);
+        int (*ready)(void* future);
+        void (*wait)(void* future);
+        const char* (*get)(void* future, void* out);
+        void (*destroy)(void* future);   // waits for unfinished std::async futures; release once ready
+        void (*cancel)(void* future);    // requests a stop through the future's own copy of the source
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_cancellable_desc {
+        uint64_t index;              // GLZ_JL_TYPE_CANCELLABLE
+        uint8_t result_class;        // GLZ_JL_RESULT_*
+        uint8_t result_kind;         // primitive kind for GLZ_JL_RESULT_VALUE (32/33 for complex)
+        uint8_t arg_count;           // parameters other than the std::stop_token
+        uint8_t is_future;           // 1 when the method returns std::future or std::shared_future
+        uint8_t padding[4];
+        const glz_jl_cancellable_ops* ops;
+        const uint8_t* arg_kinds;    // primitive kind or GLZ_JL_ARG_STRING per argument
+        void* reserved;
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class P>
+        constexpr bool is_stop_token = std::is_same_v<std::remove_cvref_t<P>, std::stop_token>;
+
+        template <class R>
+        struct future_result {
+            static constexpr bool is_future = false;
+            using type = R;
+        };
+
+        template <class T>
+        struct future_result<std::future<T>> {
+            static constexpr bool is_future = true;
+            using type = T;
+        };
+
+        template <class T>
+        struct future_result<std::shared_future<T>> {
+            static constexpr bool is_future = true;
+            using type = T;
+        };
+
+        // Future handle: the shared result and a copy of the caller's
+        // std::stop_source. The copy shares the stop state, so a stop can still
+        // be requested after the Julia StopSource has been destroyed.
+        template <class T>
+        struct cancellable_future {
+            std::shared_future<T> result;
+            std::stop_source source;
+        };
+
+        template <class>
+        struct cancellable_traits;
+
+        template <class Owner, class R, class... Params>
+        struct cancellable_traits<R (Owner::*)(Params...)> {
+            using owner_type = Owner;
+            using result_type = R;
+            using params = std::tuple<std::remove_cvref_t<Params>...>;
+        };
+
+        template <class Owner, class R, class... Params>
+        struct cancellable_traits<R (Owner::*)(Params...) const> : cancellable_traits<R (Owner::*)(Params...)> {};
+
+        inline std::string& cancellable_error()
+        {
+            thread_local std::string message;
+            return message;
+        }
+
+        inline const char* current_exception_message()
+        {
+            try {
+                throw;
+            }
+            catch (const std::exception& e) {
+                cancellable_error() = e.what();
+            }
+            catch (...) {
+                cancellable_error() = "unknown C++ exception";
+            }
+            return cancellable_error().c_str();
+        }
+
+        template <class T>
+        void write_result(const T& value, void* out)
+        {
+            if constexpr (std::is_same_v<T, std::string>) {
+                *static_cast<glz_jl_string_arg*>(out) = {value.data(), value.size()};
+            }
+            else {
+                *static_cast<T*>(out) = value;
+            }
+        }
+
+        template <auto Method>
+        struct cancellable_ops {
+            using traits = cancellable_traits<decltype(Method)>;
+            using Owner = typename traits::owner_type;
+            using R = typename traits::result_type;
+            using Params = typename traits::params;
+            static constexpr bool is_future = future_result<R>::is_future;
+            using T = typename future_result<R>::type;
+            static constexpr size_t param_count = std::tuple_size_v<Params>;
+
+            // Julia argument index of each parameter (tokens are not passed from Julia)
+            template <size_t... I>
+            static constexpr std::array<size_t, sizeof...(I) + 1> make_arg_index(std::index_sequence<I...>)
+            {
+                constexpr std::array<bool, sizeof...(I) + 1> token{is_stop_token<std::tuple_element_t<I, Params>>..., false};
+                std::array<size_t, sizeof...(I) + 1> index{};
+                size_t next = 0;
+                for (size_t i = 0; i < sizeof...(I); ++i) {
+                    index[i] = next;
+                    next += token[i] ? 0 : 1;
+                }
+                index[sizeof...(I)] = next;
+                return index;
+            }
+
+            static constexpr auto arg_index = make_arg_index(std::make_index_sequence<param_count>{});
+            static constexpr size_t arg_count = arg_index[param_count];
+
+            template <size_t I>
+            static decltype(auto) param(const void* const* args, const std::stop_token& token)
+            {
+                using P = std::tuple_element_t<I, Params>;
+                if constexpr (is_stop_token<P>) {
+                    return token;
+                }
+                else {
+                    return call_arg<P>(args[arg_index[I]]);
+                }
+            }
+
+            template <size_t... I>
+            static R invoke(Owner& object, const void* const* args, const std::stop_token& token,
+                            std::index_sequence<I...>)
+            {
+                return std::invoke(Method, object, param<I>(args, token)...);
+            }
+
+            static const char* call(void* object, const void* const* args, void* source, void* out)
+            {
+                auto& stop = *static_cast<std::stop_source*>(source);
+                const auto token = stop.get_token();
+                auto& owner = *static_cast<Owner*>(object);
+                try {
+                    if constexpr (is_future) {
+                        auto future = invoke(owner, args, token, std::make_index_sequence<param_count>{});
+                        *static_cast<void**>(out) = new cancellable_future<T>{std::move(future), stop};
+                        note_new<cancellable_future<T>>("cancellable future");
+                    }
+                    else if constexpr (std::is_void_v<T>) {
+                        invoke(owner, args, token, std::make_index_sequence<param_count>{});
+                    }
+                    else if constexpr (std::is_same_v<T, std::string>) {
+                        thread_local std::string result;
+                        result = invoke(owner, args, token, std::make_index_sequence<param_count>{});
+                        write_result(result, out);
+                    }
+                    else {
+                        write_result(invoke(owner, args, token, std::make_index_sequence<param_count>{}), out);
+                    }
+                    return nullptr;
+                }
+                catch (...) {
+                    return current_exception_message();
+                }
+            }
+
+            static cancellable_future<T>& handle(void* f) { return *static_cast<cancellable_future<T>*>(f); }
+
+            static std::shared_future<T>& future(void* f) { return handle(f).result; }
+
+            static int ready(void* f)
+            {
+                return future(f).wait_for(std::chrono::seconds(0)) == std::future_status::ready ? 1 : 0;
+            }
+
+            static void wait(void* f) { future(f).wait(); }
+
+            static const char* get(void* f, void* out)
+            {
+                try {
+                    if constexpr (std::is_void_v<T>) {
+                        future(f).get();
+                    }
+                    else {
+                        write_result(future(f).get(), out);
+                    }
+                    return nullptr;
+                }
+                catch (...) {
+                    return current_exception_message();
+                }
+            }
+
+            static void destroy(void* f)
+            {
+                delete &handle(f);
+                note_delete<cancellable_future<T>>("cancellable future");
+            }
+
+            static void cancel(void* f) { handle(f).source.request_stop(); }
+
+            static constexpr glz_jl_cancellable_ops table{&call, &ready, &wait, &get, &destroy, &cancel};
+
+            template <size_t... I>
+            static constexpr std::array<uint8_t, arg_count + 1> make_arg_kinds(std::index_sequence<I...>)
+            {
+                std::array<uint8_t, arg_count + 1> kinds{};
+                ((is_stop_token<std::tuple_element_t<I, Params>>
+                      ? void()
+                      : void(kinds[arg_index[I]] = call_arg_kind<std::tuple_element_t<I, Params>>())),
+                 ...);
+                return kinds;
+            }
+
+            static constexpr auto arg_kinds = make_arg_kinds(std::make_index_sequence<param_count>{});
+
+            template <size_t... I>
+            static constexpr size_t count_tokens(std::index_sequence<I...>)
+            {
+                return (size_t{0} + ... + (is_stop_token<std::tuple_element_t<I, Params>> ? 1 : 0));
+            }
+
+            template <size_t... I>
+            static constexpr bool all_args_supported(std::index_sequence<I...>)
+            {
+                return ((is_stop_token<std::tuple_element_t<I, Params>> ||
+                         call_arg_kind<std::tuple_element_t<I, Params>>() != 0) &&
+                        ...);
+            }
+
+            static constexpr size_t token_count = count_tokens(std::make_index_sequence<param_count>{});
+            static constexpr bool args_supported = all_args_supported(std::make_index_sequence<param_count>{});
+        };
+
+        inline std::deque<glz_jl_cancellable_desc>& cancellable_descs()
+        {
+            static std::deque<glz_jl_cancellable_desc> descs;
+            return descs;
+        }
+
+        // Cancellable members are looked up on the object itself
+        inline void* cancellable_owner(void* object) { return object; }
+    }
+
+    // Expose a member function taking a std::stop_token on the registered type
+    // `owner_type`. It may return void, an arithmetic or std::complex value, a
+    // std::string, or a std::future / std::shared_future of one of those.
+    //
+    //   glz_jl::register_cancellable_method<&Solver::run>("Solver", "run");
+    template <auto Method>
+    void register_cancellable_method(std::string_view owner_type, std::string_view name)
+    {
+        using ops = detail::cancellable_ops<Method>;
+        using T = typename ops::T;
+        static_assert(ops::token_count == 1, "cancellable methods take exactly one std::stop_token parameter");
+        static_assert(ops::args_supported, "cancellable method parameters must be arithmetic, std::string or std::string_view");
+        static_assert(std::is_void_v<T> || std::is_same_v<T, std::string> || detail::primitive_kind<T>() != 0,
+                      "cancellable methods return void, arithmetic, std::complex or std::string values");
+
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_cancellable_desc desc{};
+        desc.index = GLZ_JL_TYPE_CANCELLABLE;
+        if constexpr (std::is_void_v<T>) {
+            desc.result_class = GLZ_JL_RESULT_VOID;
+        }
+        else if constexpr (std::is_same_v<T, std::string>) {
+            desc.result_class = GLZ_JL_RESULT_STRING;
+        }
+        else {
+            desc.result_class = GLZ_JL_RESULT_VALUE;
+            desc.result_kind = detail::primitive_kind<T>();
+        }
+        desc.arg_count = uint8_t(ops::arg_count);
+        desc.is_future = ops::is_future ? 1 : 0;
+        desc.ops = &ops::table;
+        desc.arg_kinds = ops::arg_kinds.data();
+        detail::add_extension_member(owner_type, name, &detail::cancellable_descs().emplace_back(desc),
+                                     &detail::cancellable_owner);
+    }
+}
+
+extern "C" {
+    // std::stop_source handles owned by Glaze.StopSource
+    void* glz_jl_stop_source_create();
+    int glz_jl_stop_source_request(void* source);     // 1 if this call made the request
+    int glz_jl_stop_source_requested(void* source);
+    void glz_jl_stop_source_destroy(void* source);
+}
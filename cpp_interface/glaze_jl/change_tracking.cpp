@@ -0,0 +1,60 @@
+// C entry points for glaze_jl/change_tracking.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "change_tracking.hpp"
+
+#include <algorithm>
+
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    void glz_jl_track_object(const void* object, uint64_t* epoch_counter)
+    {
+        auto& s = glz_jl::detail::changes();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.epoch_counter = epoch_counter;
+        s.tracked.insert(object);
+        s.tracked_count.store(s.tracked.size(), std::memory_order_release);
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    void glz_jl_untrack_object(const void* object)
+    {
+        auto& s = glz_jl::detail::changes();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        s.tracked.erase(object);
+        s.tracked_count.store(s.tracked.size(), std::memory_order_release);
+        std::erase_if(s.log, [object](const glz_jl_change& c) { return c.object == object; });
+        if (s.tracked.empty()) {
+            s.log.clear();
+            s.overflow_epoch = 0;
+        }
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    size_t glz_jl_drain_changes(glz_jl_change* out, size_t capacity)
+    {
+        auto& s = glz_jl::detail::changes();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        size_t written = 0;
+        if (s.overflow_epoch != 0 && capacity > 0) {
+            out[written++] = {nullptr, nullptr, 0, 0, s.overflow_epoch};
+            s.overflow_epoch = 0;
+        }
+        const size_t n = std::min(capacity - written, s.log.size());
+        std::copy_n(s.log.begin(), n, out + written);
+        s.log.erase(s.log.begin(), s.log.begin() + n);
+        return written + n;
+    }
+}
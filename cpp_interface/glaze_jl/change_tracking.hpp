@@ -0,0 +1,106 @@
+#pragma once
+
+// Change tracking for Glaze.jl incremental synchronization.
+//
+// Julia setters record dirty members on their own. C++ code that mutates a
+// registered instance behind Julia's back calls glz_jl::mark_dirty so that
+// Glaze.changed_since can report the mutation as well. Only instances Julia
+// tracks (Glaze.track_changes!) are recorded, and each record is stamped with
+// Julia's change epoch at the time of the mutation. The records are drained by
+// Julia through glz_jl_drain_changes (see change_tracking.cpp, which must be
+// compiled into exactly one translation unit of the library).
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+extern "C" {
+    // Matches Glaze.NativeChange on the Julia side (40 bytes)
+    struct glz_jl_change {
+        const void* object;  // address of the mutated instance, null after an overflow
+        const char* member;  // member name as registered in glz::meta (must outlive the record)
+        uint64_t first;      // first modified element (0-based), ignored when count == 0
+        uint64_t count;      // number of modified elements, 0 marks the whole member
+        uint64_t epoch;      // Julia change epoch of the mutation
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        // Records kept between drains. Past this, records are dropped and the
+        // next drain reports every tracked object as changed.
+        inline constexpr size_t max_pending_changes = 65536;
+
+        struct change_state {
+            std::mutex mutex;
+            std::vector<glz_jl_change> log;
+            std::unordered_set<const void*> tracked;
+            std::atomic<size_t> tracked_count{0};  // read without the mutex by mark_dirty
+            uint64_t* epoch_counter = nullptr;     // Glaze._change_epoch, set by Julia
+            uint64_t overflow_epoch = 0;           // epoch of the last dropped record
+        };
+
+        inline change_state& changes()
+        {
+            static change_state state;
+            return state;
+        }
+
+        inline void record_change(const void* object, const char* member, uint64_t first, uint64_t count)
+        {
+            auto& s = changes();
+            if (s.tracked_count.load(std::memory_order_acquire) == 0) return;
+
+            std::lock_guard<std::mutex> lock(s.mutex);
+            if (!s.tracked.contains(object)) return;
+            const uint64_t epoch = std::atomic_ref<uint64_t>(*s.epoch_counter).fetch_add(1) + 1;
+            if (s.log.size() >= max_pending_changes) {
+                s.overflow_epoch = epoch;
+                return;
+            }
+            s.log.push_back({object, member, first, count, epoch});
+        }
+    }
+
+    // Mark a whole member of `object` as modified
+    inline void mark_dirty(const void* object, const char* member)
+    {
+        detail::record_change(object, member, 0, 0);
+    }
+
+    // Mark `count` elements starting at `first` of a vector member as modified
+    inline void mark_dirty(const void* object, const char* member, size_t first, size_t count)
+    {
+        detail::record_change(object, member, uint64_t(first), uint64_t(count));
+    }
+
+    template <class T>
+    void mark_dirty(const T& object, const char* member)
+    {
+        mark_dirty(static_cast<const void*>(&object), member);
+    }
+
+    template <class T>
+    void mark_dirty(const T& object, const char* member, size_t first, size_t count)
+    {
+        mark_dirty(static_cast<const void*>(&object), member, first, count);
+    }
+}
+
+extern "C" {
+    // Start recording mutations of `object`, stamping them from `epoch_counter`
+    void glz_jl_track_object(const void* object, uint64_t* epoch_counter);
+
+    // Stop recording mutations of `object` and drop its pending records
+    void glz_jl_untrack_object(const void* object);
+
+    // Move up to `capacity` pending records into `out`, returning how many were
+    // written. After an overflow the first record has a null object and the
+    // epoch of the last dropped record.
+    size_t glz_jl_drain_changes(glz_jl_change* out, size_t capacity);
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+// std::chrono members for Glaze.jl.
+//
+// Registers std::chrono::duration and std::chrono::time_point members, and
+// std::vectors of them, as extension members of a registered type (see
+// extensions.hpp). The descriptor carries the representation's primitive kind,
+// the period as a ratio of seconds and the clock, so Glaze.jl can map them to
+// Dates periods and time points. Vectors expose their contiguous storage, which
+// Glaze.jl views in place as a column of Int64-backed values.
+
+#include "extensions.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_CHRONO = 72
+    };
+
+    enum : uint8_t {
+        GLZ_JL_CHRONO_DURATION = 0,
+        GLZ_JL_CHRONO_TIME_POINT = 1
+    };
+
+    enum : uint8_t {
+        GLZ_JL_CLOCK_NONE = 0,      // durations
+        GLZ_JL_CLOCK_SYSTEM = 1,    // std::chrono::system_clock (Unix epoch)
+        GLZ_JL_CLOCK_STEADY = 2,    // std::chrono::steady_clock
+        GLZ_JL_CLOCK_OTHER = 3
+    };
+
+    // Operations on a std::vector of durations or time points (matches Glaze.ChronoOps)
+    struct glz_jl_chrono_ops {
+        size_t (*size)(void* vec);
+        void* (*data)(void* vec);
+        void (*resize)(void* vec, size_t n);
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_chrono_desc {
+        uint64_t index;                 // GLZ_JL_TYPE_CHRONO
+        uint8_t rep_kind;               // primitive kind of the representation
+        uint8_t category;               // GLZ_JL_CHRONO_DURATION or GLZ_JL_CHRONO_TIME_POINT
+        uint8_t clock;                  // GLZ_JL_CLOCK_*
+        uint8_t is_vector;              // 1 for std::vector members
+        uint8_t padding[4];
+        int64_t period_num;             // period = period_num / period_den seconds
+        int64_t period_den;
+        const glz_jl_chrono_ops* ops;   // vector operations, null for scalars
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class T>
+        struct chrono_traits {
+            static constexpr bool supported = false;
+        };
+
+        template <class Rep, class Period>
+        struct chrono_traits<std::chrono::duration<Rep, Period>> {
+            static constexpr bool supported = true;
+            using rep = Rep;
+            using period = Period;
+            static constexpr uint8_t category = GLZ_JL_CHRONO_DURATION;
+            static constexpr uint8_t clock = GLZ_JL_CLOCK_NONE;
+        };
+
+        template <class Clock, class Duration>
+        struct chrono_traits<std::chrono::time_point<Clock, Duration>> {
+            static constexpr bool supported = true;
+            using rep = typename Duration::rep;
+            using period = typename Duration::period;
+            static constexpr uint8_t category = GLZ_JL_CHRONO_TIME_POINT;
+            static constexpr uint8_t clock = std::is_same_v<Clock, std::chrono::system_clock> ? GLZ_JL_CLOCK_SYSTEM
+                                             : std::is_same_v<Clock, std::chrono::steady_clock> ? GLZ_JL_CLOCK_STEADY
+                                                                                                 : GLZ_JL_CLOCK_OTHER;
+        };
+
+        template <class T>
+        struct chrono_element {
+            using type = T;
+            static constexpr bool is_vector = false;
+        };
+
+        template <class E, class A>
+        struct chrono_element<std::vector<E, A>> {
+            using type = E;
+            static constexpr bool is_vector = true;
+        };
+
+        template <class V>
+        struct chrono_vector_ops {
+            static size_t size(void* vec) { return static_cast<V*>(vec)->size(); }
+            static void* data(void* vec) { return static_cast<V*>(vec)->data(); }
+            static void resize(void* vec, size_t n) { static_cast<V*>(vec)->resize(n); }
+
+            static constexpr glz_jl_chrono_ops table{&size, &data, &resize};
+        };
+
+        inline std::deque<glz_jl_chrono_desc>& chrono_descs()
+        {
+            static std::deque<glz_jl_chrono_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose a std::chrono::duration or time_point member, or a std::vector of
+    // either, on the registered type `owner_type`.
+    //
+    //   glz_jl::register_chrono_member<&Series::timestamps>("Series", "timestamps");
+    template <auto Member>
+    void register_chrono_member(std::string_view owner_type, std::string_view name)
+    {
+        using M = typename detail::member_pointer<decltype(Member)>::member_type;
+        constexpr bool is_vector = detail::chrono_element<M>::is_vector;
+        using traits = detail::chrono_traits<typename detail::chrono_element<M>::type>;
+        static_assert(traits::supported, "register_chrono_member requires a duration, time_point or std::vector of them");
+        static_assert(detail::primitive_kind<typename traits::rep>() != 0 &&
+                          !std::is_same_v<typename traits::rep, bool>,
+                      "unsupported chrono representation");
+
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_chrono_desc desc{};
+        desc.index = GLZ_JL_TYPE_CHRONO;
+        desc.rep_kind = detail::primitive_kind<typename traits::rep>();
+        desc.category = traits::category;
+        desc.clock = traits::clock;
+        desc.is_vector = is_vector ? 1 : 0;
+        desc.period_num = traits::period::num;
+        desc.period_den = traits::period::den;
+        if constexpr (is_vector) {
+            desc.ops = &detail::chrono_vector_ops<M>::table;
+        }
+        detail::add_extension_member(owner_type, name, &detail::chrono_descs().emplace_back(desc),
+                                     &detail::member_getter<Member>);
+    }
+}
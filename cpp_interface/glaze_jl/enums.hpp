@@ -0,0 +1,108 @@
+#pragma once
+
+// Enum members for Glaze.jl.
+//
+// Registers enum members (scoped or not) whose names are reflected through
+// glz::meta as extension members of a registered type (see extensions.hpp).
+// The descriptor carries the primitive kind of the underlying type and the
+// name/value table, built once per enum type, so Glaze.jl can generate a
+// matching @enum and read members with a direct integer load.
+
+#include "extensions.hpp"
+
+#include <glaze/glaze.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_ENUM = 70
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_enum_desc {
+        uint64_t index;              // GLZ_JL_TYPE_ENUM
+        uint8_t underlying_kind;     // primitive kind of the underlying integer type
+        uint8_t padding[3];
+        uint32_t count;              // number of enumerators
+        const char* type_name;       // enum type name, used for the Julia type
+        const char* const* names;    // enumerator names, in declaration order
+        const int64_t* values;       // enumerator values, in declaration order
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class E>
+        struct enum_table {
+            std::vector<std::string> name_storage;
+            std::vector<const char*> names;
+            std::vector<int64_t> values;
+
+            enum_table()
+            {
+                using R = glz::reflect<E>;
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    (add(R::keys[I], glz::get<I>(R::values)), ...);
+                }(std::make_index_sequence<R::size>{});
+                for (const auto& name : name_storage) {
+                    names.push_back(name.c_str());
+                }
+            }
+
+            void add(std::string_view name, E value)
+            {
+                name_storage.emplace_back(name);
+                values.push_back(static_cast<int64_t>(static_cast<std::underlying_type_t<E>>(value)));
+            }
+
+            static const enum_table& get()
+            {
+                static const enum_table table;
+                return table;
+            }
+        };
+
+        inline std::deque<glz_jl_enum_desc>& enum_descs()
+        {
+            static std::deque<glz_jl_enum_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose an enum member on the registered type `owner_type`. The enum needs a
+    // glz::meta with its enumerators; `enum_type` names the generated Julia type
+    // (default: the reflected C++ type name).
+    //
+    //   glz_jl::register_enum_member<&Light::color>("Light", "color", "Color");
+    template <auto Member>
+    void register_enum_member(std::string_view owner_type, std::string_view name, std::string_view enum_type = {})
+    {
+        using E = typename detail::member_pointer<decltype(Member)>::member_type;
+        static_assert(std::is_enum_v<E>, "register_enum_member requires an enum member");
+        using U = std::underlying_type_t<E>;
+        static_assert(detail::primitive_kind<U>() != 0 && !std::is_same_v<U, bool>, "unsupported underlying enum type");
+
+        const auto& table = detail::enum_table<E>::get();
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_enum_desc desc{};
+        desc.index = GLZ_JL_TYPE_ENUM;
+        desc.underlying_kind = detail::primitive_kind<U>();
+        desc.count = static_cast<uint32_t>(table.values.size());
+        desc.type_name = detail::intern(enum_type.empty() ? std::string_view(glz::name_v<E>) : enum_type);
+        desc.names = table.names.data();
+        desc.values = table.values.data();
+        detail::add_extension_member(owner_type, name, &detail::enum_descs().emplace_back(desc),
+                                     &detail::member_getter<Member>);
+    }
+}
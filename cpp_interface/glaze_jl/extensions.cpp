@@ -0,0 +1,35 @@
+// C entry points for glaze_jl/extensions.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "extensions.hpp"
+
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    size_t glz_jl_extension_members(const char* type_name, const glz_jl_member_info** out)
+    {
+        std::lock_guard<std::mutex> lock(glz_jl::detail::extension_mutex());
+        auto& members = glz_jl::detail::extension_members();
+        auto it = members.find(type_name);
+        if (it == members.end() || it->second.empty()) {
+            *out = nullptr;
+            return 0;
+        }
+        *out = it->second.data();
+        return it->second.size();
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    const uint64_t* glz_jl_extension_generation()
+    {
+        static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t) && std::atomic<uint64_t>::is_always_lock_free);
+        return reinterpret_cast<const uint64_t*>(&glz_jl::detail::extension_generation());
+    }
+}
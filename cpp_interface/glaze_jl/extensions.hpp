@@ -0,0 +1,181 @@
+#pragma once
+
+// Extension members for Glaze.jl.
+//
+// Members whose types the interop descriptors generated by glz::register_type
+// cannot describe (pointers, fixed-size arrays, ...) are registered by the
+// glaze_jl helpers as extension members of their owner type. Each carries a
+// descriptor with one of the GLZ_JL_TYPE_* kinds. Glaze.jl looks them up
+// through glz_jl_extension_members when a name is not among the type's regular
+// members.
+//
+// extensions.cpp must be compiled into exactly one translation unit of the library.
+
+#include <atomic>
+#include <complex>
+#include "accounting.hpp"
+#include "instrumentation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+extern "C" {
+    // Same layout as the interop member info (48 bytes)
+    struct glz_jl_member_info {
+        const char* name;
+        const void* type;
+        void* (*getter)(void* object);
+        void (*setter)(void* object, void* value);
+        uint8_t kind;
+        uint8_t padding[7];
+        void* function_ptr;
+    };
+
+    // Argument kind of std::string and std::string_view parameters of methods
+    // called through extension members; other parameters use their primitive kind
+    enum : uint8_t {
+        GLZ_JL_ARG_STRING = 64
+    };
+
+    // String argument, valid for the duration of the call
+    struct glz_jl_string_arg {
+        const char* data;
+        size_t size;
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        inline std::mutex& extension_mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        // Extension members per registered owner type name
+        inline std::unordered_map<std::string, std::vector<glz_jl_member_info>>& extension_members()
+        {
+            static std::unordered_map<std::string, std::vector<glz_jl_member_info>> members;
+            return members;
+        }
+
+        // Bumped on every registration so Julia can refresh its member caches
+        inline std::atomic<uint64_t>& extension_generation()
+        {
+            static std::atomic<uint64_t> generation{0};
+            return generation;
+        }
+
+        // Stable storage for names and descriptors referenced from member infos
+        inline std::deque<std::string>& string_storage()
+        {
+            static std::deque<std::string> storage;
+            return storage;
+        }
+
+        inline const char* intern(std::string_view s)
+        {
+            return string_storage().emplace_back(s).c_str();
+        }
+
+        // Primitive kinds as used by the interop primitive descriptors, plus complex
+        template <class T>
+        constexpr uint8_t primitive_kind()
+        {
+            if constexpr (std::is_same_v<T, bool>) return 1;
+            else if constexpr (std::is_same_v<T, int8_t>) return 2;
+            else if constexpr (std::is_same_v<T, int16_t>) return 3;
+            else if constexpr (std::is_same_v<T, int32_t>) return 4;
+            else if constexpr (std::is_same_v<T, int64_t>) return 5;
+            else if constexpr (std::is_same_v<T, uint8_t>) return 6;
+            else if constexpr (std::is_same_v<T, uint16_t>) return 7;
+            else if constexpr (std::is_same_v<T, uint32_t>) return 8;
+            else if constexpr (std::is_same_v<T, uint64_t>) return 9;
+            else if constexpr (std::is_same_v<T, float>) return 10;
+            else if constexpr (std::is_same_v<T, double>) return 11;
+#if defined(__STDCPP_FLOAT16_T__)
+            else if constexpr (std::is_same_v<T, std::float16_t>) return 12;
+#endif
+#if defined(__STDCPP_BFLOAT16_T__)
+            else if constexpr (std::is_same_v<T, std::bfloat16_t>) return 13;
+#endif
+            else if constexpr (std::is_same_v<T, std::complex<float>>) return 32;
+            else if constexpr (std::is_same_v<T, std::complex<double>>) return 33;
+            else return 0;
+        }
+
+        // Argument kind of a method parameter type, 0 if unsupported
+        template <class A>
+        constexpr uint8_t call_arg_kind()
+        {
+            if constexpr (std::is_same_v<A, std::string> || std::is_same_v<A, std::string_view>) {
+                return GLZ_JL_ARG_STRING;
+            }
+            else {
+                return primitive_kind<A>();
+            }
+        }
+
+        template <class A>
+        A call_arg(const void* arg)
+        {
+            if constexpr (call_arg_kind<A>() == GLZ_JL_ARG_STRING) {
+                const auto* s = static_cast<const glz_jl_string_arg*>(arg);
+                return A(s->data, s->size);
+            }
+            else {
+                return *static_cast<const A*>(arg);
+            }
+        }
+
+        template <class>
+        struct member_pointer;
+
+        template <class Owner, class M>
+        struct member_pointer<M Owner::*> {
+            using owner_type = Owner;
+            using member_type = M;
+        };
+
+        template <auto Member>
+        void* member_getter(void* object)
+        {
+            using Owner = typename member_pointer<decltype(Member)>::owner_type;
+            return &(static_cast<Owner*>(object)->*Member);
+        }
+
+        // Caller holds extension_mutex()
+        inline void add_extension_member(std::string_view owner_type, std::string_view name,
+                                         const void* type, void* (*getter)(void*))
+        {
+            glz_jl_member_info info{};
+            info.name = intern(name);
+            info.type = type;
+            info.getter = getter;
+            extension_members()[std::string(owner_type)].push_back(info);
+            extension_generation().fetch_add(1, std::memory_order_release);
+        }
+    }
+}
+
+extern "C" {
+    // Extension members registered for `type_name`; returns their count and sets
+    // *out to the first one (valid until more members are registered for the type)
+    size_t glz_jl_extension_members(const char* type_name, const glz_jl_member_info** out);
+
+    // Address of the registration counter, which only grows. Registrations only
+    // append, so members seen before keep their position in the list.
+    const uint64_t* glz_jl_extension_generation();
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+// Fixed-size array members for Glaze.jl.
+//
+// Registers std::array members of arithmetic or std::complex elements, nested up
+// to three levels (std::array<std::array<float, 4>, 4> is a 4x4 matrix), as
+// extension members of a registered type (see extensions.hpp). Glaze.jl reads
+// small arrays as isbits NTuples in a single load and larger ones as zero-copy
+// CppArrayViews over the member's storage.
+
+#include "extensions.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_FIXED_ARRAY = 66
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_fixed_array_desc {
+        uint64_t index;          // GLZ_JL_TYPE_FIXED_ARRAY
+        uint8_t element_kind;    // primitive kind of the innermost element (32/33 for complex)
+        uint8_t rank;            // nesting depth, 1 to 3
+        uint8_t padding[6];
+        uint64_t extents[3];     // outermost extent first, unused extents are 1
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class T>
+        struct fixed_array_traits {
+            using element_type = T;
+            static constexpr uint8_t rank = 0;
+            static constexpr std::array<uint64_t, 3> extents{1, 1, 1};
+        };
+
+        template <class T, size_t N>
+        struct fixed_array_traits<std::array<T, N>> {
+            using inner = fixed_array_traits<T>;
+            using element_type = typename inner::element_type;
+            static constexpr uint8_t rank = inner::rank + 1;
+            static constexpr std::array<uint64_t, 3> extents{N, inner::extents[0], inner::extents[1]};
+        };
+
+        inline std::deque<glz_jl_fixed_array_desc>& fixed_array_descs()
+        {
+            static std::deque<glz_jl_fixed_array_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose a std::array member on the registered type `owner_type`.
+    //
+    //   glz_jl::register_array_member<&Body::orientation>("Body", "orientation");
+    template <auto Member>
+    void register_array_member(std::string_view owner_type, std::string_view name)
+    {
+        using M = typename detail::member_pointer<decltype(Member)>::member_type;
+        using traits = detail::fixed_array_traits<M>;
+        using E = typename traits::element_type;
+        static_assert(traits::rank >= 1 && traits::rank <= 3, "member must be a std::array nested at most three levels");
+        static_assert(detail::primitive_kind<E>() != 0, "array elements must be arithmetic or std::complex");
+        // Nested std::arrays must be contiguous for Julia to view them as one block
+        static_assert(sizeof(M) == sizeof(E) * traits::extents[0] * traits::extents[1] * traits::extents[2]);
+
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_fixed_array_desc desc{};
+        desc.index = GLZ_JL_TYPE_FIXED_ARRAY;
+        desc.element_kind = detail::primitive_kind<E>();
+        desc.rank = traits::rank;
+        for (size_t i = 0; i < 3; ++i) {
+            desc.extents[i] = traits::extents[i];
+        }
+        detail::add_extension_member(owner_type, name, &detail::fixed_array_descs().emplace_back(desc),
+                                     &detail::member_getter<Member>);
+    }
+}
@@ -0,0 +1,236 @@
+#pragma once
+
+// Generator methods for Glaze.jl.
+//
+// Registers member functions returning a C++23 std::generator (or any other
+// single-pass input range) as extension members of a registered type (see
+// extensions.hpp). Calling the member from Julia starts the coroutine; Glaze.jl
+// then resumes it through a cursor that fills a reusable buffer with up to
+// `capacity` elements per call, so a stream costs one call per batch and is
+// never materialized in full.
+//
+// Arithmetic and std::complex elements are copied into the buffer, std::string
+// elements are handed out as views that stay valid until the next batch, and
+// registered struct elements are moved into heap copies that Glaze.jl owns.
+
+#include "extensions.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<generator>)
+#include <generator>
+#endif
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_GENERATOR = 74
+    };
+
+    enum : uint8_t {
+        GLZ_JL_GENERATOR_VALUES = 0,    // arithmetic or std::complex elements, copied out
+        GLZ_JL_GENERATOR_STRINGS = 1,   // std::string elements, as glz_jl_generator_string
+        GLZ_JL_GENERATOR_STRUCTS = 2    // registered struct elements, as owned heap copies
+    };
+
+    // String element: bytes valid until the next batch
+    struct glz_jl_generator_string {
+        const char* data;
+        size_t size;
+    };
+
+    // Operations on one generator method (matches Glaze.GeneratorOps)
+    struct glz_jl_generator_ops {
+        void* (*start)(void* object, const void* const* args);     // calls the method, returns a cursor
+        size_t (*next)(void* cursor, void* out, size_t capacity);  // resumes; returns count (0 when done)
+        void (*close)(void* cursor);                               // destroys the coroutine
+        void (*destroy_element)(void* element);                    // frees a struct element
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_generator_desc {
+        uint64_t index;              // GLZ_JL_TYPE_GENERATOR
+        uint8_t element_class;       // GLZ_JL_GENERATOR_*
+        uint8_t element_kind;        // primitive kind for GLZ_JL_GENERATOR_VALUES (32/33 for complex)
+        uint8_t arg_count;
+        uint8_t padding[5];
+        const glz_jl_generator_ops* ops;
+        const uint8_t* arg_kinds;    // primitive kind or GLZ_JL_ARG_STRING per argument
+        const char* element_type;    // registered type name for GLZ_JL_GENERATOR_STRUCTS
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class>
+        struct generator_method_traits;
+
+        template <class Owner, class G, class... Args>
+        struct generator_method_traits<G (Owner::*)(Args...)> {
+            using owner_type = Owner;
+            using range_type = G;
+            using args = std::tuple<std::remove_cvref_t<Args>...>;
+        };
+
+        template <class Owner, class G, class... Args>
+        struct generator_method_traits<G (Owner::*)(Args...) const> : generator_method_traits<G (Owner::*)(Args...)> {};
+
+        template <auto Method>
+        struct generator_ops {
+            using traits = generator_method_traits<decltype(Method)>;
+            using Owner = typename traits::owner_type;
+            using G = typename traits::range_type;
+            using E = std::ranges::range_value_t<G>;
+            using Args = typename traits::args;
+            static constexpr bool is_string = std::is_same_v<E, std::string>;
+            static constexpr bool is_value = primitive_kind<E>() != 0;
+
+            struct cursor {
+                G range;
+                std::optional<std::ranges::iterator_t<G>> it;
+                std::vector<std::string> strings;   // string elements of the current batch
+            };
+
+            template <size_t... I>
+            static G call(Owner& object, const void* const* args, std::index_sequence<I...>)
+            {
+                return std::invoke(Method, object, call_arg<std::tuple_element_t<I, Args>>(args[I])...);
+            }
+
+            static void* start(void* object, const void* const* args)
+            {
+                GLZ_JL_TIMED("glz_jl_generator_start");
+                note_new<cursor>("generator cursor");
+                return new cursor{call(*static_cast<Owner*>(object), args,
+                                       std::make_index_sequence<std::tuple_size_v<Args>>{}),
+                                  std::nullopt, {}};
+            }
+
+            static size_t next(void* c, void* out, size_t capacity)
+            {
+                GLZ_JL_TIMED("glz_jl_generator_next");
+                auto& cur = *static_cast<cursor*>(c);
+                if (!cur.it) {
+                    cur.it.emplace(std::ranges::begin(cur.range));   // runs the coroutine to its first yield
+                }
+                auto& it = *cur.it;
+                const auto end = std::ranges::end(cur.range);
+                size_t n = 0;
+                if constexpr (is_value) {
+                    auto* values = static_cast<E*>(out);
+                    for (; n < capacity && it != end; ++n, ++it) {
+                        values[n] = *it;
+                    }
+                }
+                else if constexpr (is_string) {
+                    cur.strings.clear();
+                    for (; n < capacity && it != end; ++n, ++it) {
+                        cur.strings.emplace_back(*it);
+                    }
+                    auto* refs = static_cast<glz_jl_generator_string*>(out);
+                    for (size_t i = 0; i < n; ++i) {
+                        refs[i] = {cur.strings[i].data(), cur.strings[i].size()};
+                    }
+                }
+                else {
+                    auto* elements = static_cast<void**>(out);
+                    for (; n < capacity && it != end; ++n, ++it) {
+                        elements[n] = new E(*it);
+                        note_new<E>("generator element");
+                    }
+                }
+                return n;
+            }
+
+            static void close(void* c)
+            {
+                delete static_cast<cursor*>(c);
+                note_delete<cursor>("generator cursor");
+            }
+
+            static void destroy_element(void* element)
+            {
+                if constexpr (!is_value && !is_string) {
+                    delete static_cast<E*>(element);
+                    note_delete<E>("generator element");
+                }
+            }
+
+            static constexpr glz_jl_generator_ops table{&start, &next, &close, &destroy_element};
+
+            template <size_t... I>
+            static constexpr std::array<uint8_t, sizeof...(I) + 1> make_arg_kinds(std::index_sequence<I...>)
+            {
+                return {call_arg_kind<std::tuple_element_t<I, Args>>()..., 0};
+            }
+
+            static constexpr auto arg_kinds = make_arg_kinds(std::make_index_sequence<std::tuple_size_v<Args>>{});
+
+            template <size_t... I>
+            static constexpr bool all_args_supported(std::index_sequence<I...>)
+            {
+                return ((call_arg_kind<std::tuple_element_t<I, Args>>() != 0) && ...);
+            }
+
+            static constexpr bool args_supported = all_args_supported(std::make_index_sequence<std::tuple_size_v<Args>>{});
+        };
+
+        // Generator members are looked up on the object itself
+        inline void* generator_owner(void* object) { return object; }
+
+        inline std::deque<glz_jl_generator_desc>& generator_descs()
+        {
+            static std::deque<glz_jl_generator_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose a member function returning std::generator<T> (or another input
+    // range) on the registered type `owner_type`. Parameters may be arithmetic,
+    // std::string or std::string_view; elements are arithmetic, std::complex,
+    // std::string, or a copyable struct registered as `element_type`.
+    //
+    //   glz_jl::register_generator_method<&Reader::records>("Reader", "records", "Record");
+    template <auto Method>
+    void register_generator_method(std::string_view owner_type, std::string_view name,
+                                   std::string_view element_type = {})
+    {
+        using ops = detail::generator_ops<Method>;
+        using E = typename ops::E;
+        static_assert(std::ranges::input_range<typename ops::G>, "generator methods must return an input range");
+        static_assert(ops::is_value || ops::is_string || std::is_copy_constructible_v<E>,
+                      "generator elements must be arithmetic, std::complex, std::string or a copyable struct");
+        static_assert(ops::args_supported, "generator method parameters must be arithmetic, std::string or std::string_view");
+
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_generator_desc desc{};
+        desc.index = GLZ_JL_TYPE_GENERATOR;
+        desc.element_class = ops::is_value    ? GLZ_JL_GENERATOR_VALUES
+                             : ops::is_string ? GLZ_JL_GENERATOR_STRINGS
+                                              : GLZ_JL_GENERATOR_STRUCTS;
+        desc.element_kind = detail::primitive_kind<E>();
+        desc.arg_count = uint8_t(std::tuple_size_v<typename ops::Args>);
+        desc.ops = &ops::table;
+        desc.arg_kinds = ops::arg_kinds.data();
+        if constexpr (!ops::is_value && !ops::is_string) {
+            desc.element_type = detail::intern(element_type);
+        }
+        detail::add_extension_member(owner_type, name, &detail::generator_descs().emplace_back(desc),
+                                     &detail::generator_owner);
+    }
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+// Generic JSON members for Glaze.jl.
+//
+// Registers glz::generic (formerly glz::json_t) members as extension members of
+// a registered type (see extensions.hpp). The descriptor points at a table of
+// node operations, so Glaze.jl navigates and edits the C++ tree in place: it
+// reads one node at a time and never serializes the value. Any type with
+// Glaze's generic layout works: a `data` variant over null, number, string,
+// bool, `array_t` and `object_t` (plus int64_t / uint64_t where present).
+
+#include "extensions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_GENERIC = 76
+    };
+
+    // Node types (matches Glaze.GENERIC_*)
+    enum : uint8_t {
+        GLZ_JL_GENERIC_NULL = 0,
+        GLZ_JL_GENERIC_NUMBER = 1,
+        GLZ_JL_GENERIC_STRING = 2,
+        GLZ_JL_GENERIC_BOOL = 3,
+        GLZ_JL_GENERIC_ARRAY = 4,
+        GLZ_JL_GENERIC_OBJECT = 5,
+        GLZ_JL_GENERIC_INT64 = 6,
+        GLZ_JL_GENERIC_UINT64 = 7
+    };
+
+    // Operations on nodes of one generic type (matches Glaze.GenericOps). Child
+    // nodes are returned by address; they move when their parent array grows or
+    // when an ancestor is assigned.
+    struct glz_jl_generic_ops {
+        uint8_t (*type)(const void* node);
+        size_t (*size)(const void* node);                        // elements, entries or bytes
+        double (*number)(const void* node);                      // NUMBER, INT64 or UINT64 as double
+        int64_t (*int64)(const void* node);
+        uint64_t (*uint64)(const void* node);
+        int (*boolean)(const void* node);
+        void (*string)(const void* node, glz_jl_string_arg* out);
+        void* (*at)(void* node, size_t i);                       // array element, null if out of range
+        void* (*find)(void* node, const char* key, size_t size); // object entry, null if missing
+        size_t (*items)(void* node, glz_jl_string_arg* keys, void** values, size_t capacity);
+
+        void (*set_null)(void* node);
+        void (*set_number)(void* node, double value);
+        void (*set_int64)(void* node, int64_t value);            // stored as a number if there is no int64_t
+        void (*set_uint64)(void* node, uint64_t value);
+        void (*set_bool)(void* node, int value);
+        void (*set_string)(void* node, const char* data, size_t size);
+        void (*set_array)(void* node, size_t n);                 // array of n nulls
+        void (*set_object)(void* node);                          // empty object
+        void* (*insert)(void* node, const char* key, size_t size);   // entry, created as null if missing
+        size_t (*erase)(void* node, const char* key, size_t size);
+        void* (*push)(void* node);                               // appends a null element
+        void (*resize)(void* node, size_t n);
+        void (*erase_at)(void* node, size_t i);
+        void (*assign)(void* node, const void* source);          // deep copy of another node
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_generic_desc {
+        uint64_t index;                  // GLZ_JL_TYPE_GENERIC
+        const glz_jl_generic_ops* ops;
+        void* reserved[3];
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class V, class T>
+        struct variant_has;
+
+        template <class... Ts, class T>
+        struct variant_has<std::variant<Ts...>, T> : std::bool_constant<(std::is_same_v<Ts, T> || ...)> {};
+
+        template <class J>
+        struct generic_ops {
+            using V = decltype(std::declval<J&>().data);
+            using array_t = typename J::array_t;
+            using object_t = typename J::object_t;
+            static constexpr bool has_int64 = variant_has<V, int64_t>::value;
+            static constexpr bool has_uint64 = variant_has<V, uint64_t>::value;
+
+            static J& node(void* n) { return *static_cast<J*>(n); }
+            static const J& node(const void* n) { return *static_cast<const J*>(n); }
+
+            static uint8_t type(const void* n)
+            {
+                return std::visit(
+                    [](const auto& v) -> uint8_t {
+                        using T = std::decay_t<decltype(v)>;
+                        if constexpr (std::is_same_v<T, double>) return GLZ_JL_GENERIC_NUMBER;
+                        else if constexpr (std::is_same_v<T, std::string>) return GLZ_JL_GENERIC_STRING;
+                        else if constexpr (std::is_same_v<T, bool>) return GLZ_JL_GENERIC_BOOL;
+                        else if constexpr (std::is_same_v<T, array_t>) return GLZ_JL_GENERIC_ARRAY;
+                        else if constexpr (std::is_same_v<T, object_t>) return GLZ_JL_GENERIC_OBJECT;
+                        else if constexpr (std::is_same_v<T, int64_t>) return GLZ_JL_GENERIC_INT64;
+                        else if constexpr (std::is_same_v<T, uint64_t>) return GLZ_JL_GENERIC_UINT64;
+                        else return GLZ_JL_GENERIC_NULL;
+                    },
+                    node(n).data);
+            }
+
+            static size_t size(const void* n)
+            {
+                const auto& data = node(n).data;
+                if (auto* a = std::get_if<array_t>(&data)) return a->size();
+                if (auto* o = std::get_if<object_t>(&data)) return o->size();
+                if (auto* s = std::get_if<std::string>(&data)) return s->size();
+                return 0;
+            }
+
+            static double number(const void* n)
+            {
+                return std::visit(
+                    [](const auto& v) -> double {
+                        using T = std::decay_t<decltype(v)>;
+                        if constexpr (std::is_arithmetic_v<T> && !std::is_same_v<T, bool>) return double(v);
+                        else return 0.0;
+                    },
+                    node(n).data);
+            }
+
+            static int64_t int64(const void* n)
+            {
+                if constexpr (has_int64) {
+                    if (auto* i = std::get_if<int64_t>(&node(n).data)) return *i;
+                }
+                return int64_t(number(n));
+            }
+
+            static uint64_t uint64(const void* n)
+            {
+                if constexpr (has_uint64) {
+                    if (auto* u = std::get_if<uint64_t>(&node(n).data)) return *u;
+                }
+                return uint64_t(number(n));
+            }
+
+            static int boolean(const void* n)
+            {
+                auto* b = std::get_if<bool>(&node(n).data);
+                return b && *b ? 1 : 0;
+            }
+
+            static void string(const void* n, glz_jl_string_arg* out)
+            {
+                auto* s = std::get_if<std::string>(&node(n).data);
+                *out = s ? glz_jl_string_arg{s->data(), s->size()} : glz_jl_string_arg{nullptr, 0};
+            }
+
+            static void* at(void* n, size_t i)
+            {
+                auto* a = std::get_if<array_t>(&node(n).data);
+                return a && i < a->size() ? &(*a)[i] : nullptr;
+            }
+
+            static void* find(void* n, const char* key, size_t size)
+            {
+                auto* o = std::get_if<object_t>(&node(n).data);
+                if (!o) return nullptr;
+                auto it = o->find(std::string_view(key, size));
+                return it == o->end() ? nullptr : &it->second;
+            }
+
+            static size_t items(void* n, glz_jl_string_arg* keys, void** values, size_t capacity)
+            {
+                auto* o = std::get_if<object_t>(&node(n).data);
+                if (!o) return 0;
+                size_t i = 0;
+                for (auto it = o->begin(); it != o->end() && i < capacity; ++it, ++i) {
+                    keys[i] = {it->first.data(), it->first.size()};
+                    values[i] = &it->second;
+                }
+                return i;
+            }
+
+            static void set_null(void* n) { node(n).data = nullptr; }
+            static void set_number(void* n, double value) { node(n).data = value; }
+
+            static void set_int64(void* n, int64_t value)
+            {
+                if constexpr (has_int64) node(n).data = value;
+                else node(n).data = double(value);
+            }
+
+            static void set_uint64(void* n, uint64_t value)
+            {
+                if constexpr (has_uint64) node(n).data = value;
+                else node(n).data = double(value);
+            }
+
+            static void set_bool(void* n, int value) { node(n).data = value != 0; }
+            static void set_string(void* n, const char* data, size_t size) { node(n).data = std::string(data, size); }
+            static void set_array(void* n, size_t size) { node(n).data = array_t(size); }
+            static void set_object(void* n) { node(n).data = object_t{}; }
+
+            static object_t& as_object(void* n)
+            {
+                auto& data = node(n).data;
+                if (!std::holds_alternative<object_t>(data)) data = object_t{};
+                return std::get<object_t>(data);
+            }
+
+            static array_t& as_array(void* n)
+            {
+                auto& data = node(n).data;
+                if (!std::holds_alternative<array_t>(data)) data = array_t{};
+                return std::get<array_t>(data);
+            }
+
+            static void* insert(void* n, const char* key, size_t size)
+            {
+                auto& o = as_object(n);
+                const std::string_view k(key, size);
+                auto it = o.find(k);
+                if (it == o.end()) it = o.emplace(std::string(k), J{}).first;
+                return &it->second;
+            }
+
+            static size_t erase(void* n, const char* key, size_t size)
+            {
+                auto* o = std::get_if<object_t>(&node(n).data);
+                if (!o) return 0;
+                auto it = o->find(std::string_view(key, size));
+                if (it == o->end()) return 0;
+                o->erase(it);
+                return 1;
+            }
+
+            static void* push(void* n) { return &as_array(n).emplace_back(); }
+            static void resize(void* n, size_t size) { as_array(n).resize(size); }
+
+            static void erase_at(void* n, size_t i)
+            {
+                auto& a = as_array(n);
+                if (i < a.size()) a.erase(a.begin() + std::ptrdiff_t(i));
+            }
+
+            static void assign(void* n, const void* source)
+            {
+                J copy = node(source);   // the source may be a descendant of n
+                node(n) = std::move(copy);
+            }
+
+            static constexpr glz_jl_generic_ops table{
+                &type,       &size,      &number,     &int64,      &uint64,     &boolean,    &string,
+                &at,         &find,      &items,      &set_null,   &set_number, &set_int64,  &set_uint64,
+                &set_bool,   &set_string, &set_array, &set_object, &insert,     &erase,      &push,
+                &resize,     &erase_at,  &assign};
+        };
+
+        inline std::deque<glz_jl_generic_desc>& generic_descs()
+        {
+            static std::deque<glz_jl_generic_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose a glz::generic (glz::json_t) member on the registered type `owner_type`.
+    //
+    //   glz_jl::register_generic_member<&Event::payload>("Event", "payload");
+    template <auto Member>
+    void register_generic_member(std::string_view owner_type, std::string_view name)
+    {
+        using J = typename detail::member_pointer<decltype(Member)>::member_type;
+        static_assert(requires(J& j) {
+            j.data;
+            typename J::array_t;
+            typename J::object_t;
+        }, "register_generic_member requires a glz::generic member");
+
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_generic_desc desc{};
+        desc.index = GLZ_JL_TYPE_GENERIC;
+        desc.ops = &detail::generic_ops<J>::table;
+        detail::add_extension_member(owner_type, name, &detail::generic_descs().emplace_back(desc),
+                                     &detail::member_getter<Member>);
+    }
+}
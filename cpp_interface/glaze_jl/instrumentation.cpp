@@ -0,0 +1,52 @@
+// C entry points for glaze_jl/instrumentation.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "instrumentation.hpp"
+
+#include <algorithm>
+
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    void glz_jl_set_instrumentation(int enabled)
+    {
+        glz_jl::detail::instrumentation_enabled().store(enabled != 0, std::memory_order_relaxed);
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    size_t glz_jl_native_stats(glz_jl_entry_stats* out, size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(glz_jl::detail::entry_mutex());
+        const auto& entries = glz_jl::detail::entry_list();
+        const size_t n = std::min(capacity, entries.size());
+        for (size_t i = 0; i < n; ++i) {
+            const auto& e = *entries[i];
+            out[i].name = e.name;
+            out[i].count = e.count.load(std::memory_order_relaxed);
+            out[i].total_ns = e.total_ns.load(std::memory_order_relaxed);
+            out[i].max_ns = e.max_ns.load(std::memory_order_relaxed);
+            for (size_t k = 0; k < GLZ_JL_LATENCY_BUCKETS; ++k) {
+                out[i].histogram[k] = e.histogram[k].load(std::memory_order_relaxed);
+            }
+        }
+        return entries.size();
+    }
+
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    void glz_jl_reset_native_stats()
+    {
+        std::lock_guard<std::mutex> lock(glz_jl::detail::entry_mutex());
+        for (auto* e : glz_jl::detail::entry_list()) e->reset();
+    }
+}
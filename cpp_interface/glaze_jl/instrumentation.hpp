@@ -0,0 +1,146 @@
+#pragma once
+
+// Native timing for Glaze.jl FFI instrumentation.
+//
+// Glaze.jl times every crossing from the Julia side once instrumentation is
+// enabled (see Glaze.enable_instrumentation!). C++ entry points that want their
+// own timing, so that time spent inside C++ can be told apart from the cost of
+// the crossing, open a GLZ_JL_TIMED("name") scope. Each scope costs one relaxed
+// atomic load while instrumentation is disabled. Counters are read and reset
+// through the entry points in instrumentation.cpp, which must be compiled into
+// exactly one translation unit of the library.
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+extern "C" {
+    // log2 latency buckets: bucket k counts calls taking [2^k, 2^(k+1)) ns, bucket 0 also holds 0 ns
+    enum : size_t {
+        GLZ_JL_LATENCY_BUCKETS = 40
+    };
+
+    // Matches Glaze.NativeEntryStats on the Julia side
+    struct glz_jl_entry_stats {
+        const char* name;  // static string passed to GLZ_JL_TIMED
+        uint64_t count;
+        uint64_t total_ns;
+        uint64_t max_ns;
+        uint64_t histogram[GLZ_JL_LATENCY_BUCKETS];
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        inline std::atomic<bool>& instrumentation_enabled()
+        {
+            static std::atomic<bool> enabled{false};
+            return enabled;
+        }
+
+        struct entry_counters;
+
+        inline std::mutex& entry_mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        inline std::vector<entry_counters*>& entry_list()
+        {
+            static std::vector<entry_counters*> entries;
+            return entries;
+        }
+
+        // One per GLZ_JL_TIMED site, registered on first use
+        struct entry_counters {
+            const char* name;
+            std::atomic<uint64_t> count{0};
+            std::atomic<uint64_t> total_ns{0};
+            std::atomic<uint64_t> max_ns{0};
+            std::atomic<uint64_t> histogram[GLZ_JL_LATENCY_BUCKETS]{};
+
+            explicit entry_counters(const char* entry_name) : name(entry_name)
+            {
+                std::lock_guard<std::mutex> lock(entry_mutex());
+                entry_list().push_back(this);
+            }
+
+            void record(uint64_t ns)
+            {
+                count.fetch_add(1, std::memory_order_relaxed);
+                total_ns.fetch_add(ns, std::memory_order_relaxed);
+                uint64_t prev = max_ns.load(std::memory_order_relaxed);
+                while (ns > prev && !max_ns.compare_exchange_weak(prev, ns, std::memory_order_relaxed)) {
+                }
+                size_t bucket = 0;
+                while (bucket + 1 < GLZ_JL_LATENCY_BUCKETS && (ns >> (bucket + 1)) != 0) {
+                    ++bucket;
+                }
+                histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void reset()
+            {
+                count.store(0, std::memory_order_relaxed);
+                total_ns.store(0, std::memory_order_relaxed);
+                max_ns.store(0, std::memory_order_relaxed);
+                for (auto& h : histogram) h.store(0, std::memory_order_relaxed);
+            }
+        };
+
+        class scoped_timer
+        {
+           public:
+            explicit scoped_timer(entry_counters& counters)
+                : counters_(instrumentation_enabled().load(std::memory_order_relaxed) ? &counters : nullptr)
+            {
+                if (counters_) start_ = std::chrono::steady_clock::now();
+            }
+
+            ~scoped_timer()
+            {
+                if (counters_) {
+                    const auto elapsed = std::chrono::steady_clock::now() - start_;
+                    counters_->record(uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+                }
+            }
+
+            scoped_timer(const scoped_timer&) = delete;
+            scoped_timer& operator=(const scoped_timer&) = delete;
+
+           private:
+            entry_counters* counters_;
+            std::chrono::steady_clock::time_point start_{};
+        };
+    }
+
+    inline bool instrumentation_enabled()
+    {
+        return detail::instrumentation_enabled().load(std::memory_order_relaxed);
+    }
+}
+
+#define GLZ_JL_TIMED_CONCAT_(a, b) a##b
+#define GLZ_JL_TIMED_CONCAT(a, b) GLZ_JL_TIMED_CONCAT_(a, b)
+
+// Time the rest of the enclosing scope under `name` (a string literal)
+#define GLZ_JL_TIMED(name)                                                                        \
+    static ::glz_jl::detail::entry_counters GLZ_JL_TIMED_CONCAT(glz_jl_counters_, __LINE__){name}; \
+    ::glz_jl::detail::scoped_timer GLZ_JL_TIMED_CONCAT(glz_jl_timer_, __LINE__){GLZ_JL_TIMED_CONCAT(glz_jl_counters_, __LINE__)}
+
+extern "C" {
+    // Turn native timing on (nonzero) or off
+    void glz_jl_set_instrumentation(int enabled);
+
+    // Copy up to `capacity` entry counters into `out`, returning how many entries exist
+    size_t glz_jl_native_stats(glz_jl_entry_stats* out, size_t capacity);
+
+    // Zero every entry counter
+    void glz_jl_reset_native_stats();
+}
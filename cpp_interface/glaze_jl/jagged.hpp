@@ -0,0 +1,130 @@
+#pragma once
+
+// Jagged vector members for Glaze.jl.
+//
+// Registers std::vector<std::vector<T>> members of arithmetic or std::complex
+// elements as extension members of a registered type (see extensions.hpp).
+// Besides zero-copy views of the inner vectors, the operations table lets
+// Glaze.jl flatten the whole member into a values buffer plus an offsets
+// buffer, and rebuild it from such buffers, in a single call each.
+//
+// A member registered here may also be listed in glz::meta; Glaze.jl then uses
+// these operations in place of the generic vector path.
+
+#include "extensions.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_JAGGED = 68
+    };
+
+    // Operations on one std::vector<std::vector<T>> type (matches Glaze.JaggedOps)
+    struct glz_jl_jagged_ops {
+        size_t (*size)(void* object);                                        // number of inner vectors
+        void* (*inner_data)(void* object, size_t i, size_t* length);         // data and length of inner vector i
+        size_t (*total)(void* object);                                       // total number of elements
+        void (*flatten)(void* object, void* values, int64_t* offsets);       // offsets has size() + 1 entries
+        void (*assign)(void* object, const void* values, const int64_t* offsets, size_t count);
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_jagged_desc {
+        uint64_t index;          // GLZ_JL_TYPE_JAGGED
+        uint8_t element_kind;    // primitive kind of the elements (32/33 for complex)
+        uint8_t padding[7];
+        const glz_jl_jagged_ops* ops;
+        void* reserved[2];
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class V>
+        struct jagged_ops {
+            using E = typename V::value_type::value_type;
+
+            static size_t size(void* object) { return static_cast<V*>(object)->size(); }
+
+            static void* inner_data(void* object, size_t i, size_t* length)
+            {
+                auto& inner = (*static_cast<V*>(object))[i];
+                *length = inner.size();
+                return inner.data();
+            }
+
+            static size_t total(void* object)
+            {
+                size_t n = 0;
+                for (const auto& inner : *static_cast<V*>(object)) {
+                    n += inner.size();
+                }
+                return n;
+            }
+
+            static void flatten(void* object, void* values, int64_t* offsets)
+            {
+                GLZ_JL_TIMED("glz_jl_jagged_flatten");
+                auto* out = static_cast<E*>(values);
+                int64_t offset = 0;
+                size_t i = 0;
+                offsets[0] = 0;
+                for (const auto& inner : *static_cast<V*>(object)) {
+                    std::copy(inner.begin(), inner.end(), out + offset);
+                    offset += int64_t(inner.size());
+                    offsets[++i] = offset;
+                }
+            }
+
+            static void assign(void* object, const void* values, const int64_t* offsets, size_t count)
+            {
+                GLZ_JL_TIMED("glz_jl_jagged_assign");
+                auto& v = *static_cast<V*>(object);
+                const auto* in = static_cast<const E*>(values);
+                v.resize(count);
+                for (size_t i = 0; i < count; ++i) {
+                    v[i].assign(in + offsets[i], in + offsets[i + 1]);
+                }
+            }
+
+            static constexpr glz_jl_jagged_ops table{&size, &inner_data, &total, &flatten, &assign};
+        };
+
+        inline std::deque<glz_jl_jagged_desc>& jagged_descs()
+        {
+            static std::deque<glz_jl_jagged_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose a std::vector<std::vector<T>> member on the registered type `owner_type`.
+    //
+    //   glz_jl::register_jagged_member<&Event::hits>("Event", "hits");
+    template <auto Member>
+    void register_jagged_member(std::string_view owner_type, std::string_view name)
+    {
+        using M = typename detail::member_pointer<decltype(Member)>::member_type;
+        using E = typename M::value_type::value_type;
+        static_assert(std::is_same_v<M, std::vector<std::vector<E>>>, "member must be a std::vector<std::vector<T>>");
+        static_assert(detail::primitive_kind<E>() != 0 && !std::is_same_v<E, bool>,
+                      "elements must be arithmetic (not bool) or std::complex");
+
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_jagged_desc desc{};
+        desc.index = GLZ_JL_TYPE_JAGGED;
+        desc.element_kind = detail::primitive_kind<E>();
+        desc.ops = &detail::jagged_ops<M>::table;
+        detail::add_extension_member(owner_type, name, &detail::jagged_descs().emplace_back(desc),
+                                     &detail::member_getter<Member>);
+    }
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+// std::mdspan members and results for Glaze.jl.
+//
+// Registers std::mdspan members, or const member functions returning a
+// std::mdspan, as extension members of a registered type (see extensions.hpp).
+// Glaze.jl reads the data handle, extents and strides in one call and returns a
+// zero-copy view: a CppArrayView (or its transpose/permutation) for
+// std::layout_left and std::layout_right, a CppStridedView for std::layout_stride.
+//
+// Requires a standard library with <mdspan> (C++23); without it this header
+// only declares the descriptor types.
+
+#include "extensions.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <version>
+
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+#endif
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_MDSPAN = 67
+    };
+
+    // Extents and strides (in elements) of one mdspan, matches Glaze.MdspanView
+    struct glz_jl_mdspan_view {
+        void* data;
+        uint64_t rank;
+        int64_t extents[8];
+        int64_t strides[8];
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_mdspan_desc {
+        uint64_t index;          // GLZ_JL_TYPE_MDSPAN
+        uint8_t element_kind;    // primitive kind of the elements (32/33 for complex)
+        uint8_t rank;
+        uint8_t padding[6];
+        void (*extract)(void* mdspan_object, glz_jl_mdspan_view* out);
+        void* reserved[2];
+    };
+}
+
+#if defined(__cpp_lib_mdspan)
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class M>
+        void mdspan_extract(void* mdspan_object, glz_jl_mdspan_view* out)
+        {
+            auto& m = *static_cast<M*>(mdspan_object);
+            out->data = const_cast<std::remove_const_t<typename M::element_type>*>(m.data_handle());
+            out->rank = M::rank();
+            for (size_t r = 0; r < M::rank(); ++r) {
+                out->extents[r] = int64_t(m.extent(r));
+                out->strides[r] = int64_t(m.stride(r));
+            }
+        }
+
+        template <class M>
+        const glz_jl_mdspan_desc* make_mdspan_desc()
+        {
+            using E = std::remove_const_t<typename M::element_type>;
+            static_assert(primitive_kind<E>() != 0, "mdspan elements must be arithmetic or std::complex");
+            static_assert(M::rank() <= 8, "mdspan rank is limited to 8");
+            static_assert(M::is_always_strided(), "mdspan layout must be strided");
+            static_assert(std::is_same_v<typename M::accessor_type, std::default_accessor<typename M::element_type>>,
+                          "mdspan must use the default accessor");
+
+            static std::deque<glz_jl_mdspan_desc> descs;
+            glz_jl_mdspan_desc desc{};
+            desc.index = GLZ_JL_TYPE_MDSPAN;
+            desc.element_kind = primitive_kind<E>();
+            desc.rank = uint8_t(M::rank());
+            desc.extract = &mdspan_extract<M>;
+            return &descs.emplace_back(desc);
+        }
+
+        template <class>
+        struct method_traits;
+
+        template <class Owner, class R>
+        struct method_traits<R (Owner::*)() const> {
+            using owner_type = Owner;
+            using result_type = R;
+        };
+
+        // Calls the method and returns the address of its result, which stays
+        // valid on the calling thread until the next call
+        template <auto Method>
+        void* method_result(void* object)
+        {
+            using traits = method_traits<decltype(Method)>;
+            thread_local std::optional<typename traits::result_type> result;
+            result.emplace((static_cast<typename traits::owner_type*>(object)->*Method)());
+            return &*result;
+        }
+    }
+
+    // Expose a std::mdspan member on the registered type `owner_type`.
+    //
+    //   glz_jl::register_mdspan_member<&Tensor::view>("Tensor", "view");
+    template <auto Member>
+    void register_mdspan_member(std::string_view owner_type, std::string_view name)
+    {
+        using M = typename detail::member_pointer<decltype(Member)>::member_type;
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        detail::add_extension_member(owner_type, name, detail::make_mdspan_desc<M>(), &detail::member_getter<Member>);
+    }
+
+    // Expose a const member function returning a std::mdspan as a property that
+    // calls it on every access.
+    //
+    //   glz_jl::register_mdspan_method<&Image::pixels>("Image", "pixels");
+    template <auto Method>
+    void register_mdspan_method(std::string_view owner_type, std::string_view name)
+    {
+        using M = typename detail::method_traits<decltype(Method)>::result_type;
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        detail::add_extension_member(owner_type, name, detail::make_mdspan_desc<M>(), &detail::method_result<Method>);
+    }
+}
+#endif
@@ -0,0 +1,39 @@
+// C entry points for glaze_jl/planar.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "planar.hpp"
+#include "instrumentation.hpp"
+
+#ifdef _WIN32
+#define GLZ_JL_EXPORT __declspec(dllexport)
+#else
+#define GLZ_JL_EXPORT __attribute__((visibility("default")))
+#endif
+
+extern "C" {
+    GLZ_JL_EXPORT void glz_jl_complexf32_to_planar(const void* src, size_t n, float* re, float* im)
+    {
+        GLZ_JL_TIMED("glz_jl_complexf32_to_planar");
+        glz_jl::to_planar(static_cast<const std::complex<float>*>(src), n, re, im);
+    }
+
+    GLZ_JL_EXPORT void glz_jl_complexf32_from_planar(void* dst, size_t n, const float* re, const float* im)
+    {
+        GLZ_JL_TIMED("glz_jl_complexf32_from_planar");
+        glz_jl::from_planar(static_cast<std::complex<float>*>(dst), n, re, im);
+    }
+
+    GLZ_JL_EXPORT void glz_jl_complexf64_to_planar(const void* src, size_t n, double* re, double* im)
+    {
+        GLZ_JL_TIMED("glz_jl_complexf64_to_planar");
+        glz_jl::to_planar(static_cast<const std::complex<double>*>(src), n, re, im);
+    }
+
+    GLZ_JL_EXPORT void glz_jl_complexf64_from_planar(void* dst, size_t n, const double* re, const double* im)
+    {
+        GLZ_JL_TIMED("glz_jl_complexf64_from_planar");
+        glz_jl::from_planar(static_cast<std::complex<double>*>(dst), n, re, im);
+    }
+}
+
+#undef GLZ_JL_EXPORT
@@ -0,0 +1,53 @@
+#pragma once
+
+// Interleaved <-> planar (split real/imaginary) conversion for Glaze.jl.
+//
+// std::complex<T> arrays store real and imaginary parts interleaved. DSP code
+// often wants them in two separate buffers. The kernels below are written as
+// plain restrict-qualified loops over the underlying scalars so the compiler
+// vectorizes them; planar.cpp exports float and double instantiations that
+// Glaze.jl calls with whole buffers (one call per conversion).
+
+#include <complex>
+#include <cstddef>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define GLZ_JL_RESTRICT __restrict__
+#elif defined(_MSC_VER)
+#define GLZ_JL_RESTRICT __restrict
+#else
+#define GLZ_JL_RESTRICT
+#endif
+
+namespace glz_jl
+{
+    // re[i] = real(src[i]), im[i] = imag(src[i])
+    template <class T>
+    void to_planar(const std::complex<T>* src, size_t n, T* GLZ_JL_RESTRICT re, T* GLZ_JL_RESTRICT im)
+    {
+        // std::complex<T> is layout-compatible with T[2]
+        const T* GLZ_JL_RESTRICT s = reinterpret_cast<const T*>(src);
+        for (size_t i = 0; i < n; ++i) {
+            re[i] = s[2 * i];
+            im[i] = s[2 * i + 1];
+        }
+    }
+
+    // dst[i] = complex(re[i], im[i])
+    template <class T>
+    void from_planar(std::complex<T>* dst, size_t n, const T* GLZ_JL_RESTRICT re, const T* GLZ_JL_RESTRICT im)
+    {
+        T* GLZ_JL_RESTRICT d = reinterpret_cast<T*>(dst);
+        for (size_t i = 0; i < n; ++i) {
+            d[2 * i] = re[i];
+            d[2 * i + 1] = im[i];
+        }
+    }
+}
+
+extern "C" {
+    void glz_jl_complexf32_to_planar(const void* src, size_t n, float* re, float* im);
+    void glz_jl_complexf32_from_planar(void* dst, size_t n, const float* re, const float* im);
+    void glz_jl_complexf64_to_planar(const void* src, size_t n, double* re, double* im);
+    void glz_jl_complexf64_from_planar(void* dst, size_t n, const double* re, const double* im);
+}
@@ -0,0 +1,353 @@
+#pragma once
+
+// Pointer and polymorphic members for Glaze.jl.
+//
+// The interop descriptors generated by glz::register_type have no kind for
+// pointer members. These helpers register unique_ptr/shared_ptr/raw pointer
+// members (and vectors of them) as extension members of a registered type.
+// Pointees may be registered structs, std::string, arithmetic values or
+// std::vectors of float, double, int32_t, bool and std::complex.
+// Glaze.jl looks them up through glz_jl_extension_members when a name is not
+// among the type's regular members.
+//
+// When the pointee type is a polymorphic base, the dynamic type of each pointee
+// is resolved through RTTI, or through a registered discriminator function, to
+// a derived type registered with glz_jl::register_derived. Julia caches RTTI
+// results per vtable pointer, so walking heterogeneous object graphs does not
+// call back into C++ for every element.
+//
+// Extension members are declared in extensions.hpp; extensions.cpp must be
+// compiled into exactly one translation unit of the library.
+
+#include "extensions.hpp"
+
+#include <atomic>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+extern "C" {
+    // Type descriptor kinds understood by Glaze.jl in addition to the interop kinds
+    enum : uint64_t {
+        GLZ_JL_TYPE_POINTER = 64,
+        GLZ_JL_TYPE_POINTER_VECTOR = 65
+    };
+
+    enum : uint8_t {
+        GLZ_JL_POINTER_RAW = 0,
+        GLZ_JL_POINTER_UNIQUE = 1,
+        GLZ_JL_POINTER_SHARED = 2
+    };
+
+    enum : uint8_t {
+        GLZ_JL_POINTEE_STRUCT = 0,
+        GLZ_JL_POINTEE_STRING = 1,
+        GLZ_JL_POINTEE_VECTOR = 2,
+        GLZ_JL_POINTEE_PRIMITIVE = 3
+    };
+
+    enum : uint8_t {
+        GLZ_JL_STATIC = 0,         // pointee is always of the declared type
+        GLZ_JL_RTTI = 1,           // dynamic type from typeid, cacheable per vtable
+        GLZ_JL_DISCRIMINATOR = 2   // dynamic type from a registered function
+    };
+
+    // Result of resolving the dynamic type of a pointee (matches Glaze.DynamicType)
+    struct glz_jl_dynamic_type {
+        const char* type_name;   // registered name of the dynamic type
+        int64_t offset;          // derived address minus base address
+        const void* cache_key;   // vtable pointer for RTTI resolution, null otherwise
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_pointer_desc {
+        uint64_t index;          // GLZ_JL_TYPE_POINTER
+        uint8_t pointer_kind;    // GLZ_JL_POINTER_*
+        uint8_t resolution;      // GLZ_JL_STATIC, GLZ_JL_RTTI or GLZ_JL_DISCRIMINATOR
+        uint8_t pointee_kind;    // GLZ_JL_POINTEE_*
+        uint8_t element_kind;    // primitive kind of the pointee (or of its vector elements)
+        uint8_t padding[4];
+        const char* pointee_type;                               // registered name of a struct pointee
+        void* (*deref)(void* pointer_object);                    // pointee address, null for null pointers
+        int (*resolve)(void* pointee, glz_jl_dynamic_type* out); // nonzero when out was filled
+    };
+
+    struct glz_jl_pointer_vector_desc {
+        uint64_t index;                                          // GLZ_JL_TYPE_POINTER_VECTOR
+        const glz_jl_pointer_desc* element;
+        size_t (*size)(void* vector_object);
+        void* (*element_at)(void* vector_object, size_t i);      // address of the i-th pointer object
+        size_t (*collect)(void* vector_object, void** out, size_t capacity);  // pointee addresses in one pass
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        struct derived_entry {
+            std::string name;
+            void* (*cast)(void* base);
+        };
+
+        // Derived types registered per polymorphic base. resolve<Base> runs on
+        // every pointer dereference Julia cannot answer from its cache, from any
+        // thread, so it reads an immutable version of the registry without
+        // locking. Registration (under extension_mutex()) publishes a new
+        // version; old versions are kept because a reader may still use them.
+        template <class Base>
+        struct derived_registry {
+            struct version {
+                std::unordered_map<std::type_index, derived_entry> by_type;
+                std::unordered_map<std::string, const derived_entry*> by_name;
+                std::string_view (*discriminator)(const Base&) = nullptr;
+            };
+
+            std::deque<version> versions;
+            std::atomic<const version*> current{nullptr};
+
+            static derived_registry& get()
+            {
+                static derived_registry registry;
+                return registry;
+            }
+
+            const version* load() const { return current.load(std::memory_order_acquire); }
+
+            // Copy the current version, apply `update` and publish the result.
+            // Caller holds extension_mutex().
+            template <class F>
+            void publish(F&& update)
+            {
+                const version* previous = load();
+                auto& next = previous ? versions.emplace_back(*previous) : versions.emplace_back();
+                update(next);
+                next.by_name.clear();
+                for (const auto& [type, entry] : next.by_type) {
+                    next.by_name[entry.name] = &entry;
+                }
+                current.store(&next, std::memory_order_release);
+            }
+        };
+
+        inline std::deque<glz_jl_pointer_desc>& pointer_descs()
+        {
+            static std::deque<glz_jl_pointer_desc> descs;
+            return descs;
+        }
+
+        inline std::deque<glz_jl_pointer_vector_desc>& pointer_vector_descs()
+        {
+            static std::deque<glz_jl_pointer_vector_desc> descs;
+            return descs;
+        }
+
+        template <class P>
+        struct pointer_traits;
+
+        template <class T>
+        struct pointer_traits<T*> {
+            using element_type = T;
+            static constexpr uint8_t kind = GLZ_JL_POINTER_RAW;
+            static void* get(T* const& p) { return const_cast<std::remove_const_t<T>*>(p); }
+        };
+
+        template <class T, class D>
+        struct pointer_traits<std::unique_ptr<T, D>> {
+            using element_type = T;
+            static constexpr uint8_t kind = GLZ_JL_POINTER_UNIQUE;
+            static void* get(const std::unique_ptr<T, D>& p) { return const_cast<std::remove_const_t<T>*>(p.get()); }
+        };
+
+        template <class T>
+        struct pointer_traits<std::shared_ptr<T>> {
+            using element_type = T;
+            static constexpr uint8_t kind = GLZ_JL_POINTER_SHARED;
+            static void* get(const std::shared_ptr<T>& p) { return const_cast<std::remove_const_t<T>*>(p.get()); }
+        };
+
+        template <class P>
+        inline constexpr bool is_pointer_like = requires { typename pointer_traits<P>::element_type; };
+
+        template <class P>
+        void* deref(void* pointer_object)
+        {
+            return pointer_traits<P>::get(*static_cast<P*>(pointer_object));
+        }
+
+        template <class Base>
+        int resolve(void* pointee, glz_jl_dynamic_type* out)
+        {
+            const auto* registry = derived_registry<Base>::get().load();
+            if (!registry) return 0;
+            auto* base = static_cast<Base*>(pointee);
+            const derived_entry* entry = nullptr;
+            const void* cache_key = nullptr;
+
+            if (registry->discriminator) {
+                auto it = registry->by_name.find(std::string(registry->discriminator(*base)));
+                if (it != registry->by_name.end()) entry = it->second;
+            }
+            else if constexpr (std::is_polymorphic_v<Base>) {
+                auto it = registry->by_type.find(std::type_index(typeid(*base)));
+                if (it != registry->by_type.end()) entry = &it->second;
+                // The vtable pointer of the Base subobject identifies (dynamic type, Base)
+                cache_key = *reinterpret_cast<const void* const*>(pointee);
+            }
+
+            if (!entry) return 0;
+            out->type_name = entry->name.c_str();
+            out->offset = static_cast<char*>(entry->cast(pointee)) - static_cast<char*>(pointee);
+            out->cache_key = cache_key;
+            return 1;
+        }
+
+        template <class T>
+        constexpr uint8_t resolution_for()
+        {
+            return std::is_polymorphic_v<T> ? GLZ_JL_RTTI : GLZ_JL_STATIC;
+        }
+
+        template <class T>
+        struct is_std_vector : std::false_type {};
+
+        template <class E, class A>
+        struct is_std_vector<std::vector<E, A>> : std::true_type {};
+
+        // Elements of std::vector pointees that Glaze.jl views as contiguous memory.
+        // std::vector<bool> is bit-packed, so it is not one of them.
+        template <class E>
+        constexpr bool is_vector_pointee_element =
+            std::is_same_v<E, float> || std::is_same_v<E, double> || std::is_same_v<E, int32_t> ||
+            std::is_same_v<E, std::complex<float>> || std::is_same_v<E, std::complex<double>>;
+
+        template <class T>
+        void set_pointee_kind(glz_jl_pointer_desc& desc)
+        {
+            if constexpr (std::is_same_v<T, std::string>) {
+                desc.pointee_kind = GLZ_JL_POINTEE_STRING;
+            }
+            else if constexpr (std::is_arithmetic_v<T>) {
+                static_assert(primitive_kind<T>() != 0, "unsupported arithmetic pointee type");
+                desc.pointee_kind = GLZ_JL_POINTEE_PRIMITIVE;
+                desc.element_kind = primitive_kind<T>();
+            }
+            else if constexpr (is_std_vector<T>::value) {
+                using E = typename T::value_type;
+                static_assert(is_vector_pointee_element<E>,
+                              "unsupported vector pointee element type (std::vector<bool> is bit-packed; "
+                              "expose it as a member with register_bits_member instead)");
+                desc.pointee_kind = GLZ_JL_POINTEE_VECTOR;
+                desc.element_kind = primitive_kind<E>();
+            }
+            else {
+                desc.pointee_kind = GLZ_JL_POINTEE_STRUCT;
+            }
+        }
+
+        template <class P>
+        const glz_jl_pointer_desc* make_pointer_desc(std::string_view pointee_type)
+        {
+            using T = std::remove_const_t<typename pointer_traits<P>::element_type>;
+            glz_jl_pointer_desc desc{};
+            desc.index = GLZ_JL_TYPE_POINTER;
+            desc.pointer_kind = pointer_traits<P>::kind;
+            const auto* registry = derived_registry<T>::get().load();
+            desc.resolution = registry && registry->discriminator ? uint8_t(GLZ_JL_DISCRIMINATOR) : resolution_for<T>();
+            set_pointee_kind<T>(desc);
+            desc.pointee_type = intern(pointee_type);
+            desc.deref = &deref<P>;
+            desc.resolve = &resolve<T>;
+            return &pointer_descs().emplace_back(desc);
+        }
+
+        template <class V>
+        size_t vector_size(void* vector_object)
+        {
+            return static_cast<V*>(vector_object)->size();
+        }
+
+        template <class V>
+        void* vector_element_at(void* vector_object, size_t i)
+        {
+            return &(*static_cast<V*>(vector_object))[i];
+        }
+
+        template <class V>
+        size_t vector_collect(void* vector_object, void** out, size_t capacity)
+        {
+            auto& v = *static_cast<V*>(vector_object);
+            const size_t n = v.size() < capacity ? v.size() : capacity;
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = pointer_traits<typename V::value_type>::get(v[i]);
+            }
+            return n;
+        }
+
+    }
+
+    // Register `Derived` as a possible dynamic type of pointers to `Base`.
+    // `name` is the name Derived was registered under with glz::register_type.
+    template <class Base, class Derived>
+    void register_derived(std::string_view name)
+    {
+        static_assert(std::is_base_of_v<Base, Derived>);
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        detail::derived_registry<Base>::get().publish([&](auto& registry) {
+            auto& entry = registry.by_type[std::type_index(typeid(Derived))];
+            entry.name = std::string(name);
+            entry.cast = [](void* base) -> void* { return static_cast<Derived*>(static_cast<Base*>(base)); };
+        });
+    }
+
+    // Resolve dynamic types of `Base` pointees by calling `discriminator`, which
+    // returns the registered name of the object's type. Use this for hierarchies
+    // without virtual functions. Register it before the pointer members.
+    template <class Base>
+    void register_discriminator(std::string_view (*discriminator)(const Base&))
+    {
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        detail::derived_registry<Base>::get().publish([&](auto& registry) { registry.discriminator = discriminator; });
+    }
+
+    // Expose a pointer member (T*, std::unique_ptr<T>, std::shared_ptr<T>) or a
+    // std::vector of them on the registered type `owner_type`. For struct pointees
+    // `pointee_type` is the registered name of T, used when the dynamic type is not
+    // resolved; it is not needed for string, arithmetic and vector pointees.
+    //
+    //   glz_jl::register_pointer_member<&Scene::shapes>("Scene", "shapes", "Shape");
+    //   glz_jl::register_pointer_member<&Scene::weights>("Scene", "weights");
+    template <auto Member>
+    void register_pointer_member(std::string_view owner_type, std::string_view name, std::string_view pointee_type = {})
+    {
+        using M = typename detail::member_pointer<decltype(Member)>::member_type;
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+
+        if constexpr (detail::is_pointer_like<M>) {
+            detail::add_extension_member(owner_type, name, detail::make_pointer_desc<M>(pointee_type),
+                                         &detail::member_getter<Member>);
+        }
+        else {
+            using P = typename M::value_type;
+            static_assert(detail::is_pointer_like<P>, "member must be a pointer or a std::vector of pointers");
+            glz_jl_pointer_vector_desc desc{};
+            desc.index = GLZ_JL_TYPE_POINTER_VECTOR;
+            desc.element = detail::make_pointer_desc<P>(pointee_type);
+            desc.size = &detail::vector_size<M>;
+            desc.element_at = &detail::vector_element_at<M>;
+            desc.collect = &detail::vector_collect<M>;
+            detail::add_extension_member(owner_type, name, &detail::pointer_vector_descs().emplace_back(desc),
+                                         &detail::member_getter<Member>);
+        }
+    }
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+// Non-contiguous range members for Glaze.jl.
+//
+// Registers std::deque, std::list, std::set and std::unordered_set members (and
+// any other range with begin/end/size) as extension members of a registered type
+// (see extensions.hpp). Iteration goes through a cursor that hands out elements
+// in chunks: arithmetic elements are copied by value, strings and registered
+// structs by address, so Julia makes one call per chunk rather than per element.
+// Membership tests run in C++, using the container's own lookup (heterogeneous
+// for transparent comparators) for sets and a linear search otherwise.
+
+#include "extensions.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_RANGE = 73
+    };
+
+    enum : uint8_t {
+        GLZ_JL_RANGE_VALUES = 0,    // arithmetic or std::complex elements, copied out
+        GLZ_JL_RANGE_STRINGS = 1,   // std::string elements, handed out by address
+        GLZ_JL_RANGE_STRUCTS = 2    // registered struct elements, handed out by address
+    };
+
+    // Key or value passed for string elements
+    struct glz_jl_string_ref {
+        const char* data;
+        size_t size;
+    };
+
+    // Operations on one range type (matches Glaze.RangeOps)
+    struct glz_jl_range_ops {
+        size_t (*size)(void* range);
+        void* (*open)(void* range);                                  // cursor at the first element
+        size_t (*next)(void* cursor, void* out, size_t capacity);    // fills out, returns count (0 at the end)
+        void (*close)(void* cursor);
+        int (*contains)(void* range, const void* key);               // -1 when elements cannot be compared
+        void (*insert)(void* range, const void* value);              // push_back, or insert for sets
+        size_t (*erase)(void* range, const void* key);               // elements removed
+        void (*clear)(void* range);
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_range_desc {
+        uint64_t index;              // GLZ_JL_TYPE_RANGE
+        uint8_t element_class;       // GLZ_JL_RANGE_*
+        uint8_t element_kind;        // primitive kind for GLZ_JL_RANGE_VALUES (32/33 for complex)
+        uint8_t is_set;              // 1 for sets: unique elements, insert does not append
+        uint8_t padding[5];
+        const glz_jl_range_ops* ops;
+        const char* element_type;    // registered type name for GLZ_JL_RANGE_STRUCTS
+        void* reserved;
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class R>
+        concept set_like = requires(R& r, const typename R::key_type& k) {
+            r.find(k);
+            r.insert(k);
+        };
+
+        template <class R>
+        struct range_ops {
+            using E = typename R::value_type;
+            static constexpr bool is_string = std::is_same_v<E, std::string>;
+            static constexpr bool is_value = primitive_kind<E>() != 0;
+
+            struct cursor {
+                typename R::iterator it;
+                typename R::iterator end;
+            };
+
+            static size_t size(void* range) { return static_cast<R*>(range)->size(); }
+
+            static void* open(void* range)
+            {
+                auto& r = *static_cast<R*>(range);
+                note_new<cursor>("range cursor");
+                return new cursor{r.begin(), r.end()};
+            }
+
+            static size_t next(void* c, void* out, size_t capacity)
+            {
+                GLZ_JL_TIMED("glz_jl_range_next");
+                auto& cur = *static_cast<cursor*>(c);
+                size_t n = 0;
+                if constexpr (is_value) {
+                    auto* values = static_cast<E*>(out);
+                    for (; n < capacity && cur.it != cur.end; ++n, ++cur.it) {
+                        values[n] = *cur.it;
+                    }
+                }
+                else {
+                    auto* addresses = static_cast<const void**>(out);
+                    for (; n < capacity && cur.it != cur.end; ++n, ++cur.it) {
+                        addresses[n] = std::addressof(*cur.it);
+                    }
+                }
+                return n;
+            }
+
+            static void close(void* c)
+            {
+                delete static_cast<cursor*>(c);
+                note_delete<cursor>("range cursor");
+            }
+
+            template <class Key>
+            static int find(R& r, const Key& key)
+            {
+                if constexpr (set_like<R> && requires { r.find(key); }) {
+                    return r.find(key) != r.end() ? 1 : 0;
+                }
+                else if constexpr (requires(const E& e) { e == key; }) {
+                    return std::find_if(r.begin(), r.end(), [&](const E& e) { return e == key; }) != r.end() ? 1 : 0;
+                }
+                else {
+                    return -1;
+                }
+            }
+
+            static int contains(void* range, const void* key)
+            {
+                auto& r = *static_cast<R*>(range);
+                if constexpr (is_string) {
+                    const auto* ref = static_cast<const glz_jl_string_ref*>(key);
+                    const std::string_view sv(ref->data, ref->size);
+                    // Heterogeneous lookup when the set's comparator/hash is transparent
+                    if constexpr (set_like<R> && requires { r.find(sv); }) {
+                        return r.find(sv) != r.end() ? 1 : 0;
+                    }
+                    else if constexpr (set_like<R>) {
+                        return find(r, std::string(sv));
+                    }
+                    else {
+                        return find(r, sv);
+                    }
+                }
+                else {
+                    return find(r, *static_cast<const E*>(key));
+                }
+            }
+
+            static E make(const void* value)
+            {
+                if constexpr (is_string) {
+                    const auto* ref = static_cast<const glz_jl_string_ref*>(value);
+                    return E(ref->data, ref->size);
+                }
+                else {
+                    return *static_cast<const E*>(value);
+                }
+            }
+
+            static void insert(void* range, const void* value)
+            {
+                auto& r = *static_cast<R*>(range);
+                if constexpr (set_like<R>) {
+                    r.insert(make(value));
+                }
+                else {
+                    r.push_back(make(value));
+                }
+            }
+
+            static size_t erase(void* range, const void* key)
+            {
+                auto& r = *static_cast<R*>(range);
+                if constexpr (set_like<R>) {
+                    return r.erase(make(key));
+                }
+                else {
+                    const E k = make(key);
+                    const auto before = r.size();
+                    if constexpr (requires(const E& e) { e == k; }) {
+                        for (auto it = r.begin(); it != r.end();) {
+                            it = *it == k ? r.erase(it) : std::next(it);
+                        }
+                    }
+                    return before - r.size();
+                }
+            }
+
+            static void clear(void* range) { static_cast<R*>(range)->clear(); }
+
+            static constexpr glz_jl_range_ops table{&size, &open, &next, &close, &contains, &insert, &erase, &clear};
+        };
+
+        inline std::deque<glz_jl_range_desc>& range_descs()
+        {
+            static std::deque<glz_jl_range_desc> descs;
+            return descs;
+        }
+    }
+
+    // Expose a range member (std::deque, std::list, std::set, std::unordered_set,
+    // ...) on the registered type `owner_type`. Elements are arithmetic,
+    // std::complex, std::string, or a struct registered as `element_type`.
+    //
+    //   glz_jl::register_range_member<&Index::tags>("Index", "tags");
+    //   glz_jl::register_range_member<&Index::points>("Index", "points", "Point");
+    template <auto Member>
+    void register_range_member(std::string_view owner_type, std::string_view name, std::string_view element_type = {})
+    {
+        using R = typename detail::member_pointer<decltype(Member)>::member_type;
+        using E = typename R::value_type;
+        using ops = detail::range_ops<R>;
+        static_assert(ops::is_value || ops::is_string || std::is_class_v<E>,
+                      "range elements must be arithmetic, std::complex, std::string or a registered struct");
+
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        glz_jl_range_desc desc{};
+        desc.index = GLZ_JL_TYPE_RANGE;
+        desc.element_class = ops::is_value ? GLZ_JL_RANGE_VALUES : ops::is_string ? GLZ_JL_RANGE_STRINGS : GLZ_JL_RANGE_STRUCTS;
+        desc.element_kind = detail::primitive_kind<E>();
+        desc.is_set = detail::set_like<R> ? 1 : 0;
+        desc.ops = &ops::table;
+        if constexpr (!ops::is_value && !ops::is_string) {
+            desc.element_type = detail::intern(element_type);
+        }
+        detail::add_extension_member(owner_type, name, &detail::range_descs().emplace_back(desc),
+                                     &detail::member_getter<Member>);
+    }
+}
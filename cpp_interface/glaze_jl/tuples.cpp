@@ -0,0 +1,19 @@
+// C entry points for glaze_jl/tuples.hpp
+// Include this file in exactly one translation unit of the shared library.
+
+#include "tuples.hpp"
+
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    const glz_jl_tuple_desc* glz_jl_tuple_layout(const char* type_name)
+    {
+        std::lock_guard<std::mutex> lock(glz_jl::detail::extension_mutex());
+        auto& types = glz_jl::detail::tuple_types();
+        auto it = types.find(type_name);
+        return it == types.end() ? nullptr : it->second;
+    }
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+// std::pair and std::tuple support for Glaze.jl.
+//
+// Pairs and tuples of trivially copyable arithmetic (or std::complex) components
+// are described by their component kinds and byte offsets, so Glaze.jl can read
+// them into isbits Julia Tuples, with a single load when the C++ layout matches
+// Julia's. Members are registered as extension members of their owner type (see
+// extensions.hpp). Tuple types returned by registered member functions are
+// registered by name; Glaze.jl resolves a method's return type to its layout once.
+//
+// tuples.cpp must be compiled into exactly one translation unit of the library.
+
+#include "extensions.hpp"
+
+#include <glaze/glaze.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+extern "C" {
+    enum : uint64_t {
+        GLZ_JL_TYPE_TUPLE = 71
+    };
+
+    // Same layout as the interop type descriptor: 8-byte kind + 32-byte payload
+    struct glz_jl_tuple_desc {
+        uint64_t index;                // GLZ_JL_TYPE_TUPLE
+        uint32_t count;                // number of components
+        uint32_t size;                 // sizeof the pair/tuple
+        const uint8_t* element_kinds;  // primitive kind per component (32/33 for complex)
+        const uint64_t* offsets;       // byte offset per component
+        void* reserved;
+    };
+}
+
+namespace glz_jl
+{
+    namespace detail
+    {
+        template <class T>
+        struct tuple_layout {
+            static constexpr size_t count = std::tuple_size_v<T>;
+
+            uint8_t element_kinds[count]{};
+            uint64_t offsets[count]{};
+
+            tuple_layout()
+            {
+                static const T probe{};
+                const auto* base = reinterpret_cast<const char*>(&probe);
+                [&]<size_t... I>(std::index_sequence<I...>) {
+                    ((element_kinds[I] = primitive_kind<std::tuple_element_t<I, T>>(),
+                      offsets[I] = uint64_t(reinterpret_cast<const char*>(&std::get<I>(probe)) - base)),
+                     ...);
+                }(std::make_index_sequence<count>{});
+            }
+
+            static const tuple_layout& get()
+            {
+                static const tuple_layout layout;
+                return layout;
+            }
+
+            static constexpr bool supported()
+            {
+                return []<size_t... I>(std::index_sequence<I...>) {
+                    return ((primitive_kind<std::tuple_element_t<I, T>>() != 0) && ...);
+                }(std::make_index_sequence<count>{});
+            }
+        };
+
+        template <class T>
+        const glz_jl_tuple_desc* make_tuple_desc()
+        {
+            static_assert(std::tuple_size_v<T> > 0, "empty tuples are not supported");
+            // Arithmetic and std::complex components are trivially copyable, so the
+            // pair/tuple can be read and written bytewise even though it is not
+            static_assert(tuple_layout<T>::supported(), "tuple components must be arithmetic or std::complex");
+            static const glz_jl_tuple_desc desc = [] {
+                const auto& layout = tuple_layout<T>::get();
+                glz_jl_tuple_desc d{};
+                d.index = GLZ_JL_TYPE_TUPLE;
+                d.count = uint32_t(tuple_layout<T>::count);
+                d.size = uint32_t(sizeof(T));
+                d.element_kinds = layout.element_kinds;
+                d.offsets = layout.offsets;
+                return d;
+            }();
+            return &desc;
+        }
+
+        // Tuple layouts of registered return types, by type name
+        inline std::unordered_map<std::string, const glz_jl_tuple_desc*>& tuple_types()
+        {
+            static std::unordered_map<std::string, const glz_jl_tuple_desc*> types;
+            return types;
+        }
+    }
+
+    // Expose a std::pair or std::tuple member on the registered type `owner_type`.
+    //
+    //   glz_jl::register_tuple_member<&Segment::range>("Segment", "range");
+    template <auto Member>
+    void register_tuple_member(std::string_view owner_type, std::string_view name)
+    {
+        using M = typename detail::member_pointer<decltype(Member)>::member_type;
+        const auto* desc = detail::make_tuple_desc<M>();
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        detail::add_extension_member(owner_type, name, desc, &detail::member_getter<Member>);
+    }
+
+    // Describe a std::pair or std::tuple type returned by registered member
+    // functions. `type_name` is the name it was registered under with
+    // glz::register_type; the reflected name is registered as well.
+    //
+    //   glz_jl::register_tuple_type<std::pair<double, double>>("std::pair<double, double>");
+    template <class T>
+    void register_tuple_type(std::string_view type_name)
+    {
+        const auto* desc = detail::make_tuple_desc<T>();
+        std::lock_guard<std::mutex> lock(detail::extension_mutex());
+        detail::tuple_types()[std::string(type_name)] = desc;
+        detail::tuple_types()[std::string(glz::name_v<T>)] = desc;
+    }
+}
+
+extern "C" {
+    // Layout of a tuple type registered with glz_jl::register_tuple_type, or null
+    const glz_jl_tuple_desc* glz_jl_tuple_layout(const char* type_name);
+}
@@ -30,12 +30,39 @@ module Glaze
 
 using Base: RefValue
 using Libdl
+import Dates
+import LinearAlgebra
+using Mmap
+import Serialization
+import Sockets
 
 # Include all modules in dependency order
+include("concurrency.jl")
+include("instrumentation.jl")
+include("accounting.jl")
 include("types.jl")
+include("half.jl")
 include("library.jl")
 include("vectors.jl")
 include("variants.jl")
 include("strings.jl")
+include("pointers.jl")
+include("fixed_arrays.jl")
+include("mdspan.jl")
+include("jagged.jl")
+include("planar.jl")
+include("bits.jl")
+include("enums.jl")
+include("tuples.jl")
+include("chrono.jl")
+include("ranges.jl")
+include("generators.jl")
+include("cancellation.jl")
+include("generic.jl")
+include("tracking.jl")
+include("shared_memory.jl")
+include("beve.jl")
+include("remote.jl")
+include("serialization.jl")
 
 end # module Glaze
\ No newline at end of file
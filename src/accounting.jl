@@ -0,0 +1,172 @@
+# Live-object accounting for C++ objects owned by Julia
+
+"""
+    LiveObjects
+
+Objects of one kind that Glaze.jl created in C++ on Julia's behalf, as returned by
+`Glaze.live_objects()`.
+
+# Fields
+- `name`: Registered type name for instances and future results, or a category
+  such as `"std::string (temporary)"` or `"generator cursor"`
+- `native`: `true` for counts kept by the glaze_jl C++ extensions
+- `live`: Objects created and not yet destroyed
+- `bytes`: Bytes held by the live objects (`sizeof` of registered types, payload
+  bytes of temporaries)
+- `created`, `destroyed`: Totals since the library was loaded
+"""
+struct LiveObjects
+    name::String
+    native::Bool
+    live::Int
+    bytes::Int
+    created::Int
+    destroyed::Int
+end
+
+function Base.show(io::IO, x::LiveObjects)
+    print(io, "LiveObjects(", x.native ? "native " : "", x.name, ": ", x.live, " live, ",
+          x.bytes, " bytes, ", x.created, " created)")
+end
+
+# Atomic, so instances created and finalized on any thread never wait on each other
+struct LiveCounter
+    name::String
+    created::Threads.Atomic{Int}
+    destroyed::Threads.Atomic{Int}
+    bytes_created::Threads.Atomic{Int}
+    bytes_destroyed::Threads.Atomic{Int}
+end
+
+LiveCounter(name::String) = LiveCounter(name, Threads.Atomic{Int}(0), Threads.Atomic{Int}(0),
+                                        Threads.Atomic{Int}(0), Threads.Atomic{Int}(0))
+
+const TEMP_STRING = "std::string (temporary)"
+const TEMP_VECTOR = "std::vector (temporary)"
+const SHARED_FUTURE = "std::shared_future"
+
+# Counters by category name, and by the registered type-name pointer of
+# ConcreteTypeInfo (stable while the library is loaded) so that instance
+# finalizers count without building the name
+const _live_counters = SnapshotDict{String, LiveCounter}()
+const _type_counters = SnapshotDict{Ptr{UInt8}, LiveCounter}()
+
+live_counter(name::String) = get!(() -> LiveCounter(name), _live_counters, name)
+live_counter(type_name::Ptr{UInt8}) = get!(() -> LiveCounter(unsafe_string(type_name)), _type_counters, type_name)
+
+function note_created!(c::LiveCounter, bytes::Integer)
+    Threads.atomic_add!(c.created, 1)
+    Threads.atomic_add!(c.bytes_created, Int(bytes))
+    return nothing
+end
+
+function note_destroyed!(c::LiveCounter, bytes::Integer)
+    Threads.atomic_add!(c.destroyed, 1)
+    Threads.atomic_add!(c.bytes_destroyed, Int(bytes))
+    return nothing
+end
+
+note_created!(name::Union{String, Ptr{UInt8}}, bytes::Integer) = note_created!(live_counter(name), bytes)
+note_destroyed!(name::Union{String, Ptr{UInt8}}, bytes::Integer) = note_destroyed!(live_counter(name), bytes)
+
+# Matches glz_jl_live_count in cpp_interface/glaze_jl/accounting.hpp
+struct NativeLiveCount
+    name::Ptr{UInt8}
+    created::UInt64
+    destroyed::UInt64
+    bytes_created::UInt64
+    bytes_destroyed::UInt64
+end
+
+# glz_jl_live_objects per library handle (C_NULL when the library does not export it)
+const _native_live_funcs = Dict{Ptr{Cvoid}, Ptr{Cvoid}}()
+const _native_live_lock = ReentrantLock()
+
+function native_live_counts(handle::Ptr{Cvoid})
+    live_func = lock(_native_live_lock) do
+        get!(_native_live_funcs, handle) do
+            something(Libdl.dlsym(handle, :glz_jl_live_objects; throw_error=false), C_NULL)
+        end
+    end
+    live_func == C_NULL && return NativeLiveCount[]
+    buffer = Vector{NativeLiveCount}(undef, 64)
+    n = Int(ccall(live_func, Csize_t, (Ptr{NativeLiveCount}, Csize_t), buffer, length(buffer)))
+    if n > length(buffer)
+        resize!(buffer, n)
+        n = Int(ccall(live_func, Csize_t, (Ptr{NativeLiveCount}, Csize_t), buffer, length(buffer)))
+    end
+    return buffer[1:min(n, length(buffer))]
+end
+
+"""
+    live_objects() -> Vector{LiveObjects}
+
+Count the C++ objects Julia currently owns, per registered type or category,
+with the most bytes first. This covers:
+
+- instances created with `lib.TypeName`
+- struct results copied out of `std::shared_future`s
+- shared futures
+- temporary strings and vectors made for member-function arguments
+
+With the glaze_jl extensions, it also covers generator and range cursors,
+generator struct elements, cancellable futures and stop sources
+(`native == true`).
+
+Objects awaiting finalization still count as live; run `GC.gc()` first for a
+settled view.
+"""
+function live_objects()
+    # (name, native) -> created, destroyed, bytes created, bytes destroyed
+    merged = Dict{Tuple{String, Bool}, NTuple{4, Int}}()
+    add!(key, counts) = merged[key] = get(merged, key, (0, 0, 0, 0)) .+ counts
+    for c in Iterators.flatten((values(snapshot(_live_counters)), values(snapshot(_type_counters))))
+        # Destroyed first: a concurrent creation can only make the snapshot overstate live objects
+        destroyed, bytes_destroyed = c.destroyed[], c.bytes_destroyed[]
+        add!((c.name, false), (c.created[], destroyed, c.bytes_created[], bytes_destroyed))
+    end
+    for handle in keys(snapshot(_library_registry)), n in native_live_counts(handle)
+        add!((unsafe_string(n.name), true), Int.((n.created, n.destroyed, n.bytes_created, n.bytes_destroyed)))
+    end
+
+    result = [LiveObjects(name, native, created - destroyed, bytes_created - bytes_destroyed, created, destroyed)
+              for ((name, native), (created, destroyed, bytes_created, bytes_destroyed)) in merged]
+    return sort!(result; by=x -> (-x.bytes, -x.live, x.name))
+end
+
+"""
+    live_count(name::AbstractString) -> Int
+
+Live objects of the registered type or category `name`.
+"""
+live_count(name::AbstractString) = sum((x.live for x in live_objects() if x.name == name); init=0)
+
+"""
+    leaked_since(before::Vector{LiveObjects}) -> Vector{LiveObjects}
+
+Entries of `live_objects()` whose live count grew since the snapshot `before`.
+The results hold the growth, not the totals. Take the snapshot, run the workload,
+release its results, call `GC.gc()`, and then check.
+
+# Example
+```julia
+before = Glaze.live_objects()
+run_workload(lib)
+GC.gc()
+leaks = Glaze.leaked_since(before)
+isempty(leaks) || @warn "C++ objects leaked" leaks
+```
+"""
+function leaked_since(before::Vector{LiveObjects})
+    base = Dict((x.name, x.native) => x for x in before)
+    leaks = LiveObjects[]
+    for x in live_objects()
+        b = get(base, (x.name, x.native), nothing)
+        live0, bytes0, created0, destroyed0 = b === nothing ? (0, 0, 0, 0) : (b.live, b.bytes, b.created, b.destroyed)
+        if x.live > live0
+            push!(leaks, LiveObjects(x.name, x.native, x.live - live0, x.bytes - bytes0,
+                                     x.created - created0, x.destroyed - destroyed0))
+        end
+    end
+    return leaks
+end
@@ -0,0 +1,329 @@
+# BEVE (Binary Efficient Versatile Encoding) support
+#
+# BEVE is Glaze's native binary format. This covers the subset needed to move C++
+# data between processes: null, booleans, numbers, strings, objects, typed and
+# generic arrays and complex numbers. All values are little-endian.
+
+const BEVE_NULL = 0x00
+const BEVE_FALSE = 0x08
+const BEVE_TRUE = 0x18
+const BEVE_NUMBER = 0x01
+const BEVE_STRING = 0x02
+const BEVE_OBJECT = 0x03
+const BEVE_TYPED_ARRAY = 0x04
+const BEVE_GENERIC_ARRAY = 0x05
+const BEVE_EXTENSION = 0x06
+
+# Extension subtypes (header bits 3-7)
+const BEVE_EXT_COMPLEX = 0x03
+
+# Number classes (header bits 3-4)
+const BEVE_FLOAT = 0x00
+const BEVE_SIGNED = 0x01
+const BEVE_UNSIGNED = 0x02
+const BEVE_BOOL_OR_STRING = 0x03
+
+const BeveNumber = Union{Int8, Int16, Int32, Int64, UInt8, UInt16, UInt32, UInt64, Float32, Float64}
+
+beve_number_class(::Type{<:AbstractFloat}) = BEVE_FLOAT
+beve_number_class(::Type{<:Signed}) = BEVE_SIGNED
+beve_number_class(::Type{<:Unsigned}) = BEVE_UNSIGNED
+
+# Class in bits 3-4, byte count index (log2 of the size) in bits 5-7
+beve_number_bits(::Type{T}) where T = (beve_number_class(T) << 3) | (UInt8(trailing_zeros(sizeof(T))) << 5)
+
+function beve_number_type(class::UInt8, size_index::UInt8)
+    if class == BEVE_FLOAT
+        size_index == 2 && return Float32
+        size_index == 3 && return Float64
+    elseif class == BEVE_SIGNED
+        return (Int8, Int16, Int32, Int64)[size_index + 1]
+    elseif class == BEVE_UNSIGNED
+        return (UInt8, UInt16, UInt32, UInt64)[size_index + 1]
+    end
+    error("Unsupported BEVE number type (class $class, size index $size_index)")
+end
+
+# Sizes are stored with the 2 low bits selecting a 1, 2, 4 or 8 byte encoding
+function write_beve_size(io::IO, n::Integer)
+    if n < 1 << 6
+        write(io, UInt8(n << 2))
+    elseif n < 1 << 14
+        write(io, htol(UInt16(n << 2 | 1)))
+    elseif n < 1 << 30
+        write(io, htol(UInt32(n << 2 | 2)))
+    else
+        write(io, htol(UInt64(n) << 2 | 3))
+    end
+    return nothing
+end
+
+function read_beve_size(io::IO)
+    first_byte = read(io, UInt8)
+    nbytes = 1 << (first_byte & 0x03)
+    value = UInt64(first_byte)
+    for k in 1:(nbytes - 1)
+        value |= UInt64(read(io, UInt8)) << (8 * k)
+    end
+    return Int(value >> 2)
+end
+
+function write_beve_bytes(io::IO, s::AbstractString)
+    str = String(s)
+    write_beve_size(io, ncodeunits(str))
+    write(io, str)
+    return nothing
+end
+
+# Write numeric data in one call; only non-contiguous inputs are copied first
+function write_beve_data(io::IO, v::AbstractVector{T}) where T
+    data = v isa Union{Array, CppArrayView, SharedMemoryView} ? v : collect(v)
+    GC.@preserve data unsafe_write(io, Ptr{UInt8}(pointer(data)), length(data) * sizeof(T))
+    return nothing
+end
+
+"""
+    beve_write(io::IO, value)
+
+Encode `value` as BEVE. Glaze wrappers are encoded from the underlying C++ data:
+structs as objects keyed by member name, vectors as typed arrays, optionals as
+their value or null.
+"""
+beve_write(io::IO, ::Nothing) = (write(io, BEVE_NULL); nothing)
+beve_write(io::IO, x::Bool) = (write(io, x ? BEVE_TRUE : BEVE_FALSE); nothing)
+
+function beve_write(io::IO, x::T) where {T <: BeveNumber}
+    write(io, BEVE_NUMBER | beve_number_bits(T))
+    write(io, htol(x))
+    return nothing
+end
+
+function beve_write(io::IO, z::Complex{T}) where {T <: Union{Float32, Float64}}
+    write(io, BEVE_EXTENSION | (BEVE_EXT_COMPLEX << 3))
+    write(io, beve_number_bits(T))  # bit 0 clear: single value
+    write(io, htol(real(z)), htol(imag(z)))
+    return nothing
+end
+
+function beve_write(io::IO, s::AbstractString)
+    write(io, BEVE_STRING)
+    write_beve_bytes(io, s)
+end
+
+beve_write(io::IO, x::Symbol) = beve_write(io, String(x))
+beve_write(io::IO, x::Enum) = beve_write(io, String(Symbol(x)))   # enum members, by enumerator name
+
+function beve_write(io::IO, v::AbstractVector{T}) where {T <: BeveNumber}
+    write(io, BEVE_TYPED_ARRAY | beve_number_bits(T))
+    write_beve_size(io, length(v))
+    write_beve_data(io, v)
+end
+
+function beve_write(io::IO, v::AbstractVector{Complex{T}}) where {T <: Union{Float32, Float64}}
+    write(io, BEVE_EXTENSION | (BEVE_EXT_COMPLEX << 3))
+    write(io, beve_number_bits(T) | 0x01)  # bit 0 set: array
+    write_beve_size(io, length(v))
+    write_beve_data(io, v)
+end
+
+function beve_write(io::IO, v::AbstractVector{Bool})
+    write(io, BEVE_TYPED_ARRAY | (BEVE_BOOL_OR_STRING << 3))
+    write_beve_size(io, length(v))
+    # Packed 8 per byte, least significant bit first
+    byte = 0x00
+    for (i, b) in enumerate(v)
+        byte |= UInt8(b) << ((i - 1) % 8)
+        if i % 8 == 0
+            write(io, byte)
+            byte = 0x00
+        end
+    end
+    length(v) % 8 == 0 || write(io, byte)
+    return nothing
+end
+
+function beve_write(io::IO, v::AbstractVector{<:AbstractString})
+    write(io, BEVE_TYPED_ARRAY | (BEVE_BOOL_OR_STRING << 3) | 0x20)
+    write_beve_size(io, length(v))
+    for s in v
+        write_beve_bytes(io, s)
+    end
+    return nothing
+end
+
+function beve_write(io::IO, v::Union{AbstractVector, Tuple})
+    write(io, BEVE_GENERIC_ARRAY)
+    write_beve_size(io, length(v))
+    for x in v
+        beve_write(io, x)
+    end
+    return nothing
+end
+
+function beve_write(io::IO, d::AbstractDict)
+    write(io, BEVE_OBJECT)  # string keys
+    write_beve_size(io, length(d))
+    for (k, v) in d
+        write_beve_bytes(io, string(k))
+        beve_write(io, v)
+    end
+    return nothing
+end
+
+beve_write(io::IO, s::CppString) = beve_write(io, String(s))
+beve_write(io::IO, v::Union{CppVector, CppVectorFloat32, CppVectorFloat64, CppVectorInt32, CppVectorComplexF32, CppVectorComplexF64}) =
+    beve_write(io, array_view(v))
+beve_write(io::IO, opt::CppOptional) = isnothing(opt) ? beve_write(io, nothing) : beve_write(io, value(opt))
+beve_write(io::IO, v::CppVariant) = beve_write(io, get_value(v))
+
+function beve_write(io::IO, obj::CppStruct)
+    # Extension members have no generic encoding; leaving them out would lose data
+    extensions = [m for m in extension_members(obj.lib, obj.info) if member_index_by_name(obj.info, m.name) == 0]
+    if !Base.isempty(extensions)
+        names = join((unsafe_string(m.name) for m in extensions), ", ")
+        error("Cannot encode $(unsafe_string(obj.info.name)) as BEVE from Julia: members $names are registered " *
+              "through glaze_jl helpers. Register the type with glz_jl::register_beve to encode it in C++.")
+    end
+    members = [m for m in unsafe_wrap(Array, obj.info.members, obj.info.member_count)
+               if m.kind != UInt8(MEMBER_FUNCTION)]
+    write(io, BEVE_OBJECT)
+    write_beve_size(io, length(members))
+    for member in members
+        GC.@preserve obj write_beve_bytes(io, unsafe_string(member.name))
+        beve_write(io, get_member_value(obj, member))
+    end
+    return nothing
+end
+
+beve_write(io::IO, x) = error("Cannot encode value of type $(typeof(x)) as BEVE")
+
+function read_beve_string(io::IO)
+    n = read_beve_size(io)
+    return String(read(io, n))
+end
+
+function read_beve_array(io::IO, ::Type{T}, n::Int) where T
+    # Payload is little-endian, as are all platforms Glaze supports
+    v = Vector{T}(undef, n)
+    read!(io, v)
+    return v
+end
+
+"""
+    beve_read(io::IO)
+
+Decode one BEVE value into plain Julia data: `nothing`, `Bool`, numbers, `String`,
+`Vector`s and `Dict`s.
+"""
+function beve_read(io::IO)
+    header = read(io, UInt8)
+    tag = header & 0x07
+
+    if tag == 0x00
+        header == BEVE_NULL && return nothing
+        return (header >> 4) & 0x01 == 0x01
+    elseif tag == BEVE_NUMBER
+        T = beve_number_type((header >> 3) & 0x03, header >> 5)
+        return ltoh(read(io, T))
+    elseif tag == BEVE_STRING
+        return read_beve_string(io)
+    elseif tag == BEVE_OBJECT
+        key_class = (header >> 3) & 0x03
+        n = read_beve_size(io)
+        if key_class == 0x00
+            d = Dict{String, Any}()
+            for _ in 1:n
+                key = read_beve_string(io)
+                d[key] = beve_read(io)
+            end
+        else
+            K = beve_number_type(key_class, header >> 5)
+            d = Dict{K, Any}()
+            for _ in 1:n
+                key = ltoh(read(io, K))
+                d[key] = beve_read(io)
+            end
+        end
+        return d
+    elseif tag == BEVE_TYPED_ARRAY
+        class = (header >> 3) & 0x03
+        n = read_beve_size(io)
+        if class == BEVE_BOOL_OR_STRING
+            if header & 0x20 != 0
+                return [read_beve_string(io) for _ in 1:n]
+            end
+            bytes = read(io, cld(n, 8))
+            return [(bytes[(i - 1) ÷ 8 + 1] >> ((i - 1) % 8)) & 0x01 == 0x01 for i in 1:n]
+        end
+        return read_beve_array(io, beve_number_type(class, header >> 5), n)
+    elseif tag == BEVE_GENERIC_ARRAY
+        n = read_beve_size(io)
+        return Any[beve_read(io) for _ in 1:n]
+    elseif tag == BEVE_EXTENSION && header >> 3 == BEVE_EXT_COMPLEX
+        complex_header = read(io, UInt8)
+        T = beve_number_type((complex_header >> 3) & 0x03, complex_header >> 5)
+        if complex_header & 0x01 == 0x00
+            re = ltoh(read(io, T))
+            im = ltoh(read(io, T))
+            return Complex{T}(re, im)
+        end
+        return read_beve_array(io, Complex{T}, read_beve_size(io))
+    end
+    error("Unsupported BEVE header 0x$(string(header; base=16))")
+end
+
+"""
+    to_beve(value) -> Vector{UInt8}
+
+Encode `value` (plain Julia data or Glaze wrappers around C++ data) as BEVE.
+"""
+function to_beve(value)
+    io = IOBuffer()
+    beve_write(io, value)
+    return take!(io)
+end
+
+"""
+    from_beve(bytes::AbstractVector{UInt8})
+
+Decode a BEVE buffer into plain Julia data.
+"""
+from_beve(bytes::AbstractVector{UInt8}) = beve_read(IOBuffer(bytes))
+
+# Assign decoded plain data (as produced by beve_read) to C++ objects
+
+function assign_member!(obj::CppStruct, name::Symbol, value)
+    current = getproperty(obj, name)
+    if current isa CppStruct
+        value isa AbstractDict || error("Member $name is a struct; expected a Dict, got $(typeof(value))")
+        assign_plain!(current, value)
+    elseif current isa Union{CppVector, CppVectorFloat32, CppVectorFloat64, CppVectorInt32, CppVectorComplexF32, CppVectorComplexF64}
+        resize!(current, length(value))
+        Base.isempty(value) || copyto!(array_view(current), value)
+    elseif current isa CppOptional
+        value === nothing ? reset!(current) : assign_optional!(current, value)
+    elseif current isa CppVariant
+        alternative = find_alternative_index(current, typeof(value))
+        alternative === nothing &&
+            error("Value of type $(typeof(value)) does not match any alternative of member $name")
+        set_value!(current, alternative, value)
+    else
+        setproperty!(obj, name, value)
+    end
+    return nothing
+end
+
+assign_optional!(opt::CppOptional{T}, value) where T = set_value!(opt, convert(T, value))
+
+"""
+    assign_plain!(obj::CppStruct, data::AbstractDict) -> obj
+
+Write plain Julia data (e.g. decoded with `from_beve`) into the C++ object, member
+by member. Keys not present in `data` are left unchanged.
+"""
+function assign_plain!(obj::CppStruct, data::AbstractDict)
+    for (key, value) in data
+        assign_member!(obj, Symbol(key), value)
+    end
+    return obj
+end
@@ -0,0 +1,206 @@
+# Packed bit members
+#
+# std::vector<bool> and std::bitset<N> members are registered in C++ with
+# glz_jl::register_bits_member (see cpp_interface/glaze_jl/bits.hpp) as
+# extension members using the GLZ_JL_TYPE_BITS kind. Bulk operations work on
+# 64-bit words, laid out like the chunks of a Julia BitVector.
+
+const GLZ_JL_TYPE_BITS = UInt64(69)
+
+# Matches glz_jl_bits_ops
+struct BitsOps
+    size::Ptr{Cvoid}
+    words::Ptr{Cvoid}
+    get::Ptr{Cvoid}
+    set::Ptr{Cvoid}
+    to_words::Ptr{Cvoid}
+    from_words::Ptr{Cvoid}
+end
+
+# Matches glz_jl_bits_desc (payload after the descriptor kind)
+struct BitsDesc
+    resizable::UInt8
+    padding::NTuple{7, UInt8}
+    ops::Ptr{BitsOps}
+    reserved::NTuple{2, Ptr{Cvoid}}
+end
+
+@inline bits_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{BitsDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+"""
+    CppBitVector
+
+View of a `std::vector<bool>` or `std::bitset<N>` member registered with
+`glz_jl::register_bits_member`. Indexing reads and writes single bits; `count`,
+`findfirst`, [`and_bits!`](@ref), [`or_bits!`](@ref), [`xor_bits!`](@ref) and
+conversion to and from `BitVector` work on whole 64-bit words. When the C++
+standard library's layout allows, the packed words are accessed in place.
+"""
+struct CppBitVector <: AbstractVector{Bool}
+    ptr::Ptr{Cvoid}
+    ops::BitsOps
+    resizable::Bool
+
+    # Keep reference to the owner to prevent GC
+    parent::Any
+end
+
+function bits_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, parent)
+    desc = bits_desc(type_desc)
+    return CppBitVector(ptr, unsafe_load(desc.ops), desc.resizable != 0, parent)
+end
+
+Base.size(b::CppBitVector) = (Int(@ffi ccall(b.ops.size, Csize_t, (Ptr{Cvoid},), b.ptr)),)
+Base.IndexStyle(::Type{CppBitVector}) = IndexLinear()
+
+nwords(n::Integer) = (n + 63) >> 6
+
+# In-place packed words, or C_NULL (re-fetched on every use: resizing moves them)
+packed_words(b::CppBitVector) = @ffi ccall(b.ops.words, Ptr{UInt64}, (Ptr{Cvoid},), b.ptr)
+
+function Base.getindex(b::CppBitVector, i::Int)
+    @boundscheck checkbounds(b, i)
+    words = packed_words(b)
+    if words != C_NULL
+        return (unsafe_load(words, ((i - 1) >> 6) + 1) >> ((i - 1) & 63)) & 1 == 1
+    end
+    return @ffi ccall(b.ops.get, Cint, (Ptr{Cvoid}, Csize_t), b.ptr, i - 1) != 0
+end
+
+function Base.setindex!(b::CppBitVector, value, i::Int)
+    @boundscheck checkbounds(b, i)
+    @ffi ccall(b.ops.set, Cvoid, (Ptr{Cvoid}, Csize_t, Cint), b.ptr, i - 1, Bool(value))
+    return value
+end
+
+"""
+    bit_words(b::CppBitVector) -> Vector{UInt64}
+
+Copy of the packed words of `b` (unused high bits of the last word cleared),
+fetched 64 bits at a time in one call.
+"""
+function bit_words(b::CppBitVector)
+    words = Vector{UInt64}(undef, nwords(length(b)))
+    @ffi ccall(b.ops.to_words, Cvoid, (Ptr{Cvoid}, Ptr{UInt64}), b.ptr, words)
+    return words
+end
+
+# Apply f to the words of b: in place when addressable, on a copy otherwise
+function with_words(f, b::CppBitVector)
+    n = length(b)
+    words = packed_words(b)
+    if words != C_NULL
+        return f(words, n)
+    end
+    buffer = bit_words(b)
+    return GC.@preserve buffer f(pointer(buffer), n)
+end
+
+# Mask of the valid bits of word k (1-based) of an n-bit vector
+@inline function word_mask(k::Int, n::Int)
+    rem = n & 63
+    return (k == nwords(n) && rem != 0) ? (UInt64(1) << rem) - 1 : typemax(UInt64)
+end
+
+function Base.count(b::CppBitVector)
+    with_words(b) do words, n
+        total = 0
+        for k in 1:nwords(n)
+            total += count_ones(unsafe_load(words, k) & word_mask(k, n))
+        end
+        total
+    end
+end
+
+function Base.findnext(b::CppBitVector, start::Integer)
+    start = Int(start)
+    with_words(b) do words, n
+        start > n && return nothing
+        k = ((start - 1) >> 6) + 1
+        word = unsafe_load(words, k) & word_mask(k, n) & (typemax(UInt64) << ((start - 1) & 63))
+        while true
+            word != 0 && return (k - 1) * 64 + trailing_zeros(word) + 1
+            k == nwords(n) && return nothing
+            k += 1
+            word = unsafe_load(words, k) & word_mask(k, n)
+        end
+    end
+end
+
+Base.findfirst(b::CppBitVector) = findnext(b, 1)
+
+"""
+    BitVector(b::CppBitVector)
+
+Copy a packed C++ bit member into a Julia `BitVector`, 64 bits at a time.
+"""
+function Base.BitVector(b::CppBitVector)
+    n = length(b)
+    result = BitVector(undef, n)
+    n == 0 && return result
+    @ffi ccall(b.ops.to_words, Cvoid, (Ptr{Cvoid}, Ptr{UInt64}), b.ptr, result.chunks)
+    return result
+end
+
+Base.convert(::Type{BitVector}, b::CppBitVector) = BitVector(b)
+
+"""
+    assign_bits!(b::CppBitVector, bits::AbstractVector{Bool}) -> b
+
+Replace the contents of `b` with `bits` in one call, copying 64 bits at a time.
+A `std::vector<bool>` is resized; a `std::bitset` must have the same length.
+"""
+function assign_bits!(b::CppBitVector, bits::AbstractVector{Bool})
+    source = bits isa BitVector ? bits : BitVector(bits)
+    n = length(source)
+    b.resizable || n == length(b) ||
+        throw(DimensionMismatch("cannot assign $n bits to a std::bitset of $(length(b)) bits"))
+    @ffi ccall(b.ops.from_words, Cvoid, (Ptr{Cvoid}, Ptr{UInt64}, Csize_t), b.ptr, source.chunks, n)
+    return b
+end
+
+Base.copyto!(b::CppBitVector, bits::BitVector) = length(bits) == length(b) ? assign_bits!(b, bits) :
+    throw(DimensionMismatch("cannot copy $(length(bits)) bits into $(length(b))"))
+
+source_words(other::BitVector) = other.chunks
+source_words(other::CppBitVector) = bit_words(other)
+
+function combine_bits!(op, b::CppBitVector, other::Union{BitVector, CppBitVector})
+    length(other) == length(b) ||
+        throw(DimensionMismatch("bit vectors have lengths $(length(b)) and $(length(other))"))
+    src = source_words(other)
+    words = packed_words(b)
+    if words != C_NULL
+        @inbounds for k in 1:length(src)
+            unsafe_store!(words, op(unsafe_load(words, k), src[k]), k)
+        end
+    else
+        dest = bit_words(b)
+        @inbounds for k in 1:length(src)
+            dest[k] = op(dest[k], src[k])
+        end
+        @ffi ccall(b.ops.from_words, Cvoid, (Ptr{Cvoid}, Ptr{UInt64}, Csize_t), b.ptr, dest, length(b))
+    end
+    return b
+end
+
+"""
+    and_bits!(b::CppBitVector, other) -> b
+    or_bits!(b::CppBitVector, other) -> b
+    xor_bits!(b::CppBitVector, other) -> b
+
+Combine `b` in place with a `BitVector` or `CppBitVector` of the same length,
+one 64-bit word at a time.
+"""
+and_bits!(b::CppBitVector, other) = combine_bits!(&, b, other)
+or_bits!(b::CppBitVector, other) = combine_bits!(|, b, other)
+xor_bits!(b::CppBitVector, other) = combine_bits!(xor, b, other)
+
+function Base.show(io::IO, b::CppBitVector)
+    print(io, "CppBitVector(length=", length(b), ", count=", count(b), ")")
+end
+
+Base.show(io::IO, ::MIME"text/plain", b::CppBitVector) = show(io, b)
+
+export CppBitVector, bit_words, assign_bits!, and_bits!, or_bits!, xor_bits!
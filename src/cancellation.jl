@@ -0,0 +1,286 @@
+# Cancellable methods
+#
+# Member functions taking a std::stop_token are registered in C++ with
+# glz_jl::register_cancellable_method (see cpp_interface/glaze_jl/cancellation.hpp)
+# as extension members using the GLZ_JL_TYPE_CANCELLABLE kind. Each call gets a
+# token from a StopSource, a std::stop_source owned by Julia; Glaze.cancel
+# requests a stop on it, whether the call is still running on another thread or
+# returned a future that is.
+
+const GLZ_JL_TYPE_CANCELLABLE = UInt64(75)
+
+const RESULT_VOID = 0x00
+const RESULT_VALUE = 0x01
+const RESULT_STRING = 0x02
+
+# Matches glz_jl_cancellable_ops
+struct CancellableOps
+    call::Ptr{Cvoid}
+    ready::Ptr{Cvoid}
+    wait::Ptr{Cvoid}
+    get::Ptr{Cvoid}
+    destroy::Ptr{Cvoid}
+    cancel::Ptr{Cvoid}
+end
+
+# Matches glz_jl_cancellable_desc (payload after the descriptor kind)
+struct CancellableDesc
+    result_class::UInt8
+    result_kind::UInt8
+    arg_count::UInt8
+    is_future::UInt8
+    padding::NTuple{4, UInt8}
+    ops::Ptr{CancellableOps}
+    arg_kinds::Ptr{UInt8}
+    reserved::Ptr{Cvoid}
+end
+
+@inline cancellable_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{CancellableDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+cancellable_result_type(desc::CancellableDesc) =
+    desc.result_class == RESULT_VOID ? Nothing :
+    desc.result_class == RESULT_STRING ? String : pointee_element_type(desc.result_kind)
+
+"""
+    StopSource(lib)
+
+A C++ `std::stop_source` owned by Julia. Pass it as `stop = source` to a
+cancellable method to share one source between calls, or to cancel a
+synchronous call running on another thread. `Glaze.cancel(source)` requests a
+stop; tokens already handed to C++ stay valid after the source is collected.
+"""
+mutable struct StopSource
+    ptr::Ptr{Cvoid}
+    lib::Ptr{Cvoid}
+    request::Ptr{Cvoid}
+    requested::Ptr{Cvoid}
+
+    function StopSource(lib::Ptr{Cvoid})
+        ptr = @ffi ccall(get_cached_function(lib, :glz_jl_stop_source_create), Ptr{Cvoid}, ())
+        s = new(ptr, lib, get_cached_function(lib, :glz_jl_stop_source_request),
+                get_cached_function(lib, :glz_jl_stop_source_requested))
+        destroy = get_cached_function(lib, :glz_jl_stop_source_destroy)
+        finalizer(x -> @ffi(ccall(destroy, Cvoid, (Ptr{Cvoid},), x.ptr)), s)
+        return s
+    end
+end
+
+StopSource(lib::CppLibrary) = StopSource(lib.handle)
+
+"""
+    cancel(source::StopSource) -> Bool
+    cancel(future::CancellableFuture) -> Bool
+
+Request a stop on the `std::stop_token` passed to a cancellable method. Returns
+`true` if this call made the request, `false` if a stop was already requested.
+The C++ code stops when it next checks its token.
+"""
+cancel(s::StopSource) = @ffi ccall(s.request, Cint, (Ptr{Cvoid},), s.ptr) == 1
+
+"""
+    iscancelled(x) -> Bool
+
+Whether a stop has been requested on a `StopSource` or `CancellableFuture`.
+"""
+iscancelled(s::StopSource) = @ffi ccall(s.requested, Cint, (Ptr{Cvoid},), s.ptr) == 1
+
+Base.show(io::IO, s::StopSource) = print(io, "StopSource(", iscancelled(s) ? "stop requested" : "active", ")")
+
+"""
+    CancellableMethod
+
+A member function taking a `std::stop_token`, bound to its object. Calling it
+passes the remaining arguments and a token of the `stop` keyword's
+[`StopSource`](@ref) (a new one by default). Methods returning a
+`std::future` or `std::shared_future` return a [`CancellableFuture`](@ref);
+others return their result.
+"""
+struct CancellableMethod
+    obj_ptr::Ptr{Cvoid}
+    lib::Ptr{Cvoid}
+    desc::CancellableDesc
+    name::String
+    parent::Any
+end
+
+cancellable_method(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, lib::Ptr{Cvoid}, name::String, parent) =
+    CancellableMethod(ptr, lib, cancellable_desc(type_desc), name, parent)
+
+function check_cancellable_error(name::AbstractString, message::Ptr{UInt8})
+    message == C_NULL || error("C++ exception in '$name': $(unsafe_string(message))")
+    return nothing
+end
+
+# Run `call(out)` with an output buffer for a T result and return the result
+function cancellable_result(call, ::Type{T}, name) where {T}
+    if T === Nothing
+        check_cancellable_error(name, call(C_NULL))
+        return nothing
+    elseif T === String
+        out = Ref{StringRef}()
+        check_cancellable_error(name, call(out))
+        return unsafe_string(out[].data, out[].size)
+    else
+        out = Ref{T}()
+        check_cancellable_error(name, call(out))
+        return out[]
+    end
+end
+
+function (m::CancellableMethod)(args...; stop::Union{Nothing, StopSource}=nothing)
+    n = Int(m.desc.arg_count)
+    length(args) == n || error("Cancellable method '$(m.name)' takes $n arguments, got $(length(args))")
+    source = stop === nothing ? StopSource(m.lib) : stop
+    converted, arg_ptrs = method_args(m.desc.arg_kinds, args)
+    ops = unsafe_load(m.desc.ops)
+
+    invoke_method(out) = GC.@preserve converted arg_ptrs source begin
+        @ffi ccall(ops.call, Ptr{UInt8}, (Ptr{Cvoid}, Ptr{Ptr{Cvoid}}, Ptr{Cvoid}, Ptr{Cvoid}),
+              m.obj_ptr, arg_ptrs, source.ptr, out)
+    end
+
+    T = cancellable_result_type(m.desc)
+    m.desc.is_future == 0x01 || return cancellable_result(invoke_method, T, m.name)
+
+    handle = Ref{Ptr{Cvoid}}(C_NULL)
+    check_cancellable_error(m.name, invoke_method(handle))
+    return CancellableFuture{T}(handle[], ops, source, m.name, (m.parent, converted))
+end
+
+# Work behind a future handle, with the Julia objects it may use: the owning
+# object and the argument buffers. An entry stays until the work has finished
+# and the handle is released, so a future collected in the same collection as
+# its object cannot free either while C++ still runs.
+mutable struct PendingWork
+    ops::CancellableOps
+    keepalive::Any
+    orphaned::Bool   # the CancellableFuture was collected; release once ready
+end
+
+# Written by finalizers, so guarded by a spin lock like SnapshotDict writers
+const _pending_lock = Threads.SpinLock()
+const _pending_work = Dict{Ptr{Cvoid}, PendingWork}()
+
+work_ready(ops::CancellableOps, handle::Ptr{Cvoid}) = @ffi ccall(ops.ready, Cint, (Ptr{Cvoid},), handle) == 1
+
+# Release orphaned handles whose work has finished (caller holds _pending_lock)
+function reap_pending_locked!()
+    for (handle, work) in collect(_pending_work)
+        if work.orphaned && work_ready(work.ops, handle)
+            @ffi ccall(work.ops.destroy, Cvoid, (Ptr{Cvoid},), handle)
+            delete!(_pending_work, handle)
+        end
+    end
+    return nothing
+end
+
+function with_pending_lock(f)
+    GC.enable_finalizers(false)
+    lock(_pending_lock)
+    try
+        return f()
+    finally
+        unlock(_pending_lock)
+        GC.enable_finalizers(true)
+    end
+end
+
+"""
+    Glaze.reap_futures!()
+
+Release the handles of collected `CancellableFuture`s whose stopped work has
+finished. This also happens on every call that returns a new future.
+"""
+reap_futures!() = with_pending_lock(reap_pending_locked!)
+
+Base.show(io::IO, m::CancellableMethod) =
+    print(io, "CancellableMethod ", m.name, " (", m.desc.arg_count, " arguments",
+          m.desc.is_future == 0x01 ? ", returns a future" : "", ")")
+
+"""
+    CancellableFuture{T}
+
+Result of a cancellable method returning a `std::future` or `std::shared_future`.
+`isready`, `wait` and `fetch` (or `get`) work as for [`CppSharedFuture`](@ref),
+except that `wait` yields to other Julia tasks while the C++ work runs, so one
+of them can call [`Glaze.cancel`](@ref cancel) on it. An exception stored in the
+future is raised as an error by `fetch`.
+
+A future collected while still running is cancelled. Its handle, object and
+arguments are released once the C++ work has finished, so collection never
+blocks and never frees memory the work still uses.
+"""
+mutable struct CancellableFuture{T}
+    handle::Ptr{Cvoid}
+    ops::CancellableOps
+    source::StopSource
+    name::String
+    keepalive::Any   # object and arguments the C++ work may refer to
+
+    function CancellableFuture{T}(handle, ops, source, name, keepalive) where {T}
+        with_pending_lock() do
+            reap_pending_locked!()
+            _pending_work[handle] = PendingWork(ops, keepalive, false)
+        end
+        f = new{T}(handle, ops, source, name, keepalive)
+        finalizer(release!, f)
+        return f
+    end
+end
+
+# Finalizer. Touches no other Julia-finalized object: the StopSource and the
+# keepalive objects may already be finalized in the same collection. Releasing
+# an unfinished std::async future would block, so unfinished work is stopped
+# through the handle's own stop state and released later by reap_futures!.
+function release!(f::CancellableFuture)
+    f.handle == C_NULL && return nothing
+    # Finalizers must not block: retry on a later collection if the lock is busy
+    trylock(_pending_lock) || (finalizer(release!, f); return nothing)
+    try
+        work = _pending_work[f.handle]
+        if work_ready(f.ops, f.handle)
+            @ffi ccall(f.ops.destroy, Cvoid, (Ptr{Cvoid},), f.handle)
+            delete!(_pending_work, f.handle)
+        else
+            @ffi ccall(f.ops.cancel, Cvoid, (Ptr{Cvoid},), f.handle)
+            work.orphaned = true
+        end
+        f.handle = C_NULL
+        reap_pending_locked!()
+    finally
+        unlock(_pending_lock)
+    end
+    return nothing
+end
+
+cancel(f::CancellableFuture) = cancel(f.source)
+iscancelled(f::CancellableFuture) = iscancelled(f.source)
+
+Base.isready(f::CancellableFuture) = @ffi ccall(f.ops.ready, Cint, (Ptr{Cvoid},), f.handle) == 1
+
+function Base.wait(f::CancellableFuture)
+    delay = 0.001
+    while !isready(f)
+        sleep(delay)
+        delay = min(2delay, 0.016)
+    end
+    return nothing
+end
+
+function Base.fetch(f::CancellableFuture{T}) where {T}
+    f.handle == C_NULL && error("Future of '$(f.name)' has been released")
+    wait(f)
+    return cancellable_result(T, f.name) do out
+        @ffi ccall(f.ops.get, Ptr{UInt8}, (Ptr{Cvoid}, Ptr{Cvoid}), f.handle, out)
+    end
+end
+
+Base.get(f::CancellableFuture) = fetch(f)
+
+function Base.show(io::IO, f::CancellableFuture{T}) where {T}
+    state = f.handle == C_NULL ? "released" : isready(f) ? "ready" : iscancelled(f) ? "stopping" : "pending"
+    print(io, "CancellableFuture{", T, "}(", state, ")")
+end
+
+export StopSource, CancellableFuture
@@ -0,0 +1,175 @@
+# std::chrono members
+#
+# Durations and time points (and std::vectors of them) are registered in C++
+# with glz_jl::register_chrono_member (see cpp_interface/glaze_jl/chrono.hpp) as
+# extension members using the GLZ_JL_TYPE_CHRONO kind. Int64 durations with a
+# period Dates has a type for read as that Dates period, and time points as
+# TimePoint values wrapping one. Both have the layout of the Int64 count, so
+# vectors of them are viewed in place.
+
+const GLZ_JL_TYPE_CHRONO = UInt64(72)
+
+const CHRONO_DURATION = 0x00
+const CHRONO_TIME_POINT = 0x01
+
+const CHRONO_CLOCKS = (:none, :system, :steady, :other)
+
+# Matches glz_jl_chrono_ops
+struct ChronoOps
+    size::Ptr{Cvoid}
+    data::Ptr{Cvoid}
+    resize::Ptr{Cvoid}
+end
+
+# Matches glz_jl_chrono_desc (payload after the descriptor kind)
+struct ChronoDesc
+    rep_kind::UInt8
+    category::UInt8
+    clock::UInt8
+    is_vector::UInt8
+    padding::NTuple{4, UInt8}
+    period_num::Int64
+    period_den::Int64
+    ops::Ptr{ChronoOps}
+end
+
+@inline chrono_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{ChronoDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+"""
+    TimePoint{C, P<:Dates.Period}
+
+`std::chrono::time_point` of clock `C` (`:system`, `:steady` or `:other`) holding
+its time since the clock's epoch as the Dates period `P`. Has the layout of the
+C++ count, so vectors of time points are viewed without copying. System clock
+time points convert to `Dates.DateTime` (the Unix epoch) and from it.
+
+# Example
+```julia
+t = series.start                   # TimePoint{:system, Nanosecond}
+Dates.DateTime(t)                  # millisecond precision
+Dates.Nanosecond(t)                # full precision since the epoch
+series.timestamps[end] - series.timestamps[1]
+```
+"""
+struct TimePoint{C, P<:Dates.Period}
+    since_epoch::P
+end
+
+TimePoint{C}(p::P) where {C, P<:Dates.Period} = TimePoint{C, P}(p)
+
+@inline _nanoseconds(p::Dates.FixedPeriod) = Int64(Dates.tons(p))
+
+# Largest P-count not after `ns` nanoseconds
+@inline _floor_period(::Type{P}, ns::Integer) where {P<:Dates.FixedPeriod} =
+    P(fld(ns, _nanoseconds(oneunit(P))))
+
+Dates.Nanosecond(t::TimePoint) = Dates.Nanosecond(_nanoseconds(t.since_epoch))
+Dates.DateTime(t::TimePoint{:system}) =
+    Dates.DateTime(1970) + Dates.Millisecond(fld(_nanoseconds(t.since_epoch), 1_000_000))
+TimePoint{:system, P}(dt::Dates.DateTime) where {P<:Dates.FixedPeriod} =
+    TimePoint{:system, P}(_floor_period(P, _nanoseconds(dt - Dates.DateTime(1970))))
+Base.convert(::Type{TimePoint{C, P}}, t::TimePoint{C}) where {C, P<:Dates.FixedPeriod} =
+    TimePoint{C, P}(_floor_period(P, _nanoseconds(t.since_epoch)))
+Base.convert(::Type{TimePoint{C, P}}, t::TimePoint{C, P}) where {C, P<:Dates.FixedPeriod} = t
+Base.convert(::Type{TimePoint{:system, P}}, dt::Dates.DateTime) where {P<:Dates.FixedPeriod} = TimePoint{:system, P}(dt)
+
+Base.:-(a::TimePoint{C}, b::TimePoint{C}) where {C} = a.since_epoch - b.since_epoch
+Base.:+(t::TimePoint{C, P}, p::Dates.Period) where {C, P} = TimePoint{C, P}(t.since_epoch + convert(P, p))
+Base.:-(t::TimePoint{C, P}, p::Dates.Period) where {C, P} = TimePoint{C, P}(t.since_epoch - convert(P, p))
+Base.isless(a::TimePoint{C}, b::TimePoint{C}) where {C} = isless(_nanoseconds(a.since_epoch), _nanoseconds(b.since_epoch))
+Base.:(==)(a::TimePoint{C}, b::TimePoint{C}) where {C} = _nanoseconds(a.since_epoch) == _nanoseconds(b.since_epoch)
+
+function Base.show(io::IO, t::TimePoint{C}) where {C}
+    if C === :system
+        sub_ms = mod(_nanoseconds(t.since_epoch), 1_000_000)
+        print(io, "TimePoint{:system}(", Dates.DateTime(t), iszero(sub_ms) ? "" : " + $(sub_ms) ns", ")")
+    else
+        print(io, "TimePoint{:", C, "}(", t.since_epoch, " since epoch)")
+    end
+end
+
+# Dates period type with the same tick as a ratio of seconds, or nothing
+function chrono_period_type(num::Int64, den::Int64)
+    num == 1 && den == 1_000_000_000 && return Dates.Nanosecond
+    num == 1 && den == 1_000_000 && return Dates.Microsecond
+    num == 1 && den == 1_000 && return Dates.Millisecond
+    den == 1 && num == 1 && return Dates.Second
+    den == 1 && num == 60 && return Dates.Minute
+    den == 1 && num == 3600 && return Dates.Hour
+    den == 1 && num == 86400 && return Dates.Day
+    den == 1 && num == 604800 && return Dates.Week
+    return nothing
+end
+
+# Julia element type of a chrono descriptor, and whether it shares the C++ layout
+function chrono_element_type(desc::ChronoDesc)
+    P = chrono_period_type(desc.period_num, desc.period_den)
+    direct = P !== nothing && desc.rep_kind == 5   # Int64 count
+    P = direct ? P : Dates.Nanosecond
+    desc.category == CHRONO_TIME_POINT || return P, direct
+    return TimePoint{CHRONO_CLOCKS[desc.clock + 1], P}, direct
+end
+
+# Nanoseconds in one tick of the C++ period
+@inline chrono_tick_ns(desc::ChronoDesc) = desc.period_num * 1e9 / desc.period_den
+
+function chrono_scalar(ptr::Ptr{Cvoid}, desc::ChronoDesc)
+    T, direct = chrono_element_type(desc)
+    direct && return unsafe_load(Ptr{T}(ptr))
+    R = primitive_kind_to_julia_type(UInt64(desc.rep_kind))
+    ns = Dates.Nanosecond(round(Int64, unsafe_load(Ptr{R}(ptr)) * chrono_tick_ns(desc)))
+    return T <: TimePoint ? T(ns) : ns
+end
+
+function set_chrono_scalar!(ptr::Ptr{Cvoid}, desc::ChronoDesc, value)
+    T, direct = chrono_element_type(desc)
+    if T <: TimePoint && !(value isa TimePoint || value isa Dates.DateTime && T <: TimePoint{:system})
+        error("Cannot assign $(typeof(value)) to a $(T) member")
+    end
+    v = convert(T, value)
+    if direct
+        unsafe_store!(Ptr{T}(ptr), v)
+    else
+        R = primitive_kind_to_julia_type(UInt64(desc.rep_kind))
+        ns = _nanoseconds(v isa TimePoint ? v.since_epoch : v)
+        count = ns / chrono_tick_ns(desc)
+        unsafe_store!(Ptr{R}(ptr), R <: Integer ? round(R, count) : R(count))
+    end
+    return value
+end
+
+# Zero-copy view of a std::vector of durations or time points; vectors whose
+# representation is not an Int64 count of a Dates period are viewed as raw counts
+function chrono_vector(ptr::Ptr{Cvoid}, desc::ChronoDesc, parent)
+    ops = unsafe_load(desc.ops)
+    n = @ffi ccall(ops.size, Csize_t, (Ptr{Cvoid},), ptr)
+    data = @ffi ccall(ops.data, Ptr{Cvoid}, (Ptr{Cvoid},), ptr)
+    T, direct = chrono_element_type(desc)
+    T = direct ? T : primitive_kind_to_julia_type(UInt64(desc.rep_kind))
+    return CppArrayView{T,1}(Ptr{T}(data), (Int(n),), parent)
+end
+
+function set_chrono_vector!(ptr::Ptr{Cvoid}, desc::ChronoDesc, value::AbstractVector)
+    ops = unsafe_load(desc.ops)
+    @ffi ccall(ops.resize, Cvoid, (Ptr{Cvoid}, Csize_t), ptr, length(value))
+    dest = chrono_vector(ptr, desc, nothing)
+    eltype(dest) <: Real ? copyto!(dest, value) : copyto!(dest, convert.(eltype(dest), value))
+    return value
+end
+
+function chrono_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, parent)
+    desc = chrono_desc(type_desc)
+    desc.is_vector == 0x01 ? chrono_vector(ptr, desc, parent) : chrono_scalar(ptr, desc)
+end
+
+function set_chrono!(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, value)
+    desc = chrono_desc(type_desc)
+    if desc.is_vector == 0x01
+        value isa AbstractVector || error("Cannot assign $(typeof(value)) to a vector of chrono values")
+        return set_chrono_vector!(ptr, desc, value)
+    end
+    return set_chrono_scalar!(ptr, desc, value)
+end
+
+export TimePoint
@@ -0,0 +1,87 @@
+# Shared state read from many Julia threads
+
+"""
+    SnapshotDict{K, V}()
+
+A read-mostly map for caches that are filled once and then read on every
+interop call: resolved entry points, the library registry, descriptor and
+layout caches.
+
+Reads use the current table without locking. Writers copy the table under a
+spin lock and then publish the copy, so a reader never sees a `Dict` that is
+being rehashed and never waits behind another thread. Insertion costs a copy
+of the table, so this suits maps that stop growing after warm-up. Stored
+values must not be `nothing`.
+
+Writers hold a spin lock, which never yields, with finalizers disabled. A
+finalizer therefore cannot start on a thread that holds the lock, and writers
+may run inside finalizers.
+"""
+mutable struct SnapshotDict{K, V}
+    @atomic table::Dict{K, V}
+    lock::Threads.SpinLock
+end
+
+SnapshotDict{K, V}() where {K, V} = SnapshotDict{K, V}(Dict{K, V}(), Threads.SpinLock())
+
+# Current table. Never mutated once published, so it is safe to iterate. The
+# acquire pairs with the writer's release, so the table's contents are visible.
+@inline snapshot(d::SnapshotDict) = @atomic :acquire d.table
+
+@inline Base.get(d::SnapshotDict, key, default) = get(snapshot(d), key, default)
+@inline Base.haskey(d::SnapshotDict, key) = haskey(snapshot(d), key)
+Base.length(d::SnapshotDict) = length(snapshot(d))
+Base.isempty(d::SnapshotDict) = isempty(snapshot(d))
+
+# A finalizer that interrupted the writer on its own thread and then wrote to
+# the same map would spin on the lock forever
+@inline function lock_writer(d::SnapshotDict)
+    GC.enable_finalizers(false)
+    lock(d.lock)
+end
+
+@inline function unlock_writer(d::SnapshotDict)
+    unlock(d.lock)
+    GC.enable_finalizers(true)
+end
+
+# Insert `value` unless `key` is present; returns the value stored for `key`
+@noinline function publish_entry!(d::SnapshotDict{K, V}, key::K, value::V) where {K, V}
+    lock_writer(d)
+    try
+        existing = get(snapshot(d), key, nothing)
+        existing === nothing || return existing
+        table = copy(snapshot(d))
+        table[key] = value
+        @atomic :release d.table = table  # the copy is complete before readers can see it
+        return value
+    finally
+        unlock_writer(d)
+    end
+end
+
+"""
+    get!(f, d::SnapshotDict, key)
+
+Return the value for `key`, or compute `f()` and insert it. `f` runs outside
+the lock. When several threads miss the same key at once, each may run `f`.
+The first value published wins and is returned to all of them. Wrap the call
+in a lock of your own if `f` must run only once.
+"""
+@inline function Base.get!(f::Base.Callable, d::SnapshotDict{K, V}, key) where {K, V}
+    value = get(snapshot(d), key, nothing)
+    value === nothing || return value
+    return publish_entry!(d, convert(K, key), convert(V, f()))
+end
+
+function Base.setindex!(d::SnapshotDict{K, V}, value, key) where {K, V}
+    lock_writer(d)
+    try
+        table = copy(snapshot(d))
+        table[convert(K, key)] = convert(V, value)
+        @atomic :release d.table = table
+    finally
+        unlock_writer(d)
+    end
+    return d
+end
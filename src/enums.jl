@@ -0,0 +1,116 @@
+# Enum members
+#
+# Enum members are registered in C++ with glz_jl::register_enum_member (see
+# cpp_interface/glaze_jl/enums.hpp) as extension members using the
+# GLZ_JL_TYPE_ENUM kind. Each C++ enum gets a generated Julia @enum, built once
+# from the descriptor's name table; members are then read with a direct
+# integer load.
+
+const GLZ_JL_TYPE_ENUM = UInt64(70)
+
+# Matches glz_jl_enum_desc (payload after the descriptor kind)
+struct EnumDesc
+    underlying_kind::UInt8
+    padding::NTuple{3, UInt8}
+    count::UInt32
+    type_name::Cstring
+    names::Ptr{Cstring}
+    values::Ptr{Int64}
+end
+
+@inline enum_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{EnumDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+# Generated Julia enum type and its name -> value table
+struct EnumTable
+    type::DataType
+    underlying::DataType
+    by_name::Dict{Symbol, Int64}
+end
+
+# Keyed by the C++ name table, which is shared by every member of the same enum type
+const _enum_tables = SnapshotDict{Ptr{Cstring}, EnumTable}()
+const _enum_lock = ReentrantLock()  # generates each enum type once
+
+# Holds one module per generated enum, so enumerators of different enums cannot clash
+module Enums end
+
+function generate_enum(desc::EnumDesc)
+    desc.count == 0 && error("Enum $(unsafe_string(desc.type_name)) has no reflected enumerators")
+    T = primitive_kind_to_julia_type(UInt64(desc.underlying_kind))
+    name = Symbol(last(split(unsafe_string(desc.type_name), "::")))
+
+    by_name = Dict{Symbol, Int64}()
+    seen = Set{Int64}()
+    entries = Expr[]
+    for i in 1:desc.count
+        sym = Symbol(unsafe_string(unsafe_load(desc.names, i)))
+        value = unsafe_load(desc.values, i)
+        by_name[sym] = value
+        # Aliases read back as the first enumerator with their value
+        value in seen && continue
+        push!(seen, value)
+        push!(entries, :($sym = $(T(value))))
+    end
+
+    modname = isdefined(Enums, name) ? gensym(name) : name
+    m = Core.eval(Enums, Expr(:module, true, modname, Expr(:block, :(@enum $name::$T $(entries...)))))
+    return EnumTable(Base.invokelatest(getfield, m, name), T, by_name)
+end
+
+function enum_table(type_desc::Ptr{TypeDescriptor})
+    desc = enum_desc(type_desc)
+    table = get(_enum_tables, desc.names, nothing)
+    table === nothing || return table
+    lock(_enum_lock) do
+        get!(() -> generate_enum(desc), _enum_tables, desc.names)
+    end
+end
+
+function enum_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor})
+    table = enum_table(type_desc)
+    return reinterpret(table.type, unsafe_load(Ptr{table.underlying}(ptr)))
+end
+
+# Assign an enum value of the generated type, an enumerator name or a raw integer
+function set_enum!(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, value)
+    table = enum_table(type_desc)
+    raw = if value isa table.type
+        Integer(value)
+    elseif value isa Union{Symbol, AbstractString}
+        get(table.by_name, Symbol(value)) do
+            error("'$value' is not an enumerator of $(table.type)")
+        end
+    elseif value isa Integer
+        value
+    else
+        error("Cannot assign $(typeof(value)) to an enum member of type $(table.type)")
+    end
+    unsafe_store!(Ptr{table.underlying}(ptr), convert(table.underlying, raw))
+    return value
+end
+
+"""
+    enum_type(obj::CppStruct, name::Symbol) -> Type{<:Enum}
+
+Julia `@enum` type generated for the enum member `name` of `obj`. Its instances
+have the C++ enumerator names and values; reading the member returns one of them.
+The type is generated on first use, so methods such as `instances` and `show`
+on it are available from the next top-level statement.
+
+# Example
+```julia
+Color = enum_type(light, :color)
+light.color == Color(2)
+light.color = :Green             # or a Color value, or a raw integer
+```
+"""
+function enum_type(obj::CppStruct, name::Symbol)
+    member = find_extension_member(obj, name)
+    if member === nothing || unsafe_load(Ptr{UInt64}(member.type)) != GLZ_JL_TYPE_ENUM
+        error("Member '$name' is not an enum member")
+    end
+    return enum_table(member.type).type
+end
+
+export enum_type
@@ -0,0 +1,89 @@
+# Fixed-size array members
+#
+# std::array members (nested up to three levels) are registered in C++ with
+# glz_jl::register_array_member (see cpp_interface/glaze_jl/fixed_arrays.hpp)
+# as extension members of their owner type, using the GLZ_JL_TYPE_FIXED_ARRAY kind.
+
+const GLZ_JL_TYPE_FIXED_ARRAY = UInt64(66)
+
+# Arrays with at most this many elements are read as isbits NTuples
+const FIXED_ARRAY_TUPLE_LIMIT = 16
+
+# Matches glz_jl_fixed_array_desc (payload after the descriptor kind)
+struct FixedArrayDesc
+    element_kind::UInt8
+    rank::UInt8
+    padding::NTuple{6, UInt8}
+    extents::NTuple{3, UInt64}   # outermost first
+end
+
+@inline fixed_array_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{FixedArrayDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+# Extents in C++ order (outermost first)
+fixed_array_extents(desc::FixedArrayDesc) = ntuple(i -> Int(desc.extents[i]), Int(desc.rank))
+
+# Nested NTuple with the same layout as the std::array, e.g.
+# std::array<std::array<float, 4>, 4> -> NTuple{4, NTuple{4, Float32}}
+function fixed_array_tuple_type(desc::FixedArrayDesc)
+    T = pointee_element_type(desc.element_kind)
+    for n in reverse(fixed_array_extents(desc))
+        T = NTuple{n, T}
+    end
+    return T
+end
+
+# Zero-copy view indexed like the C++ array: A[i, j] is a[i-1][j-1]
+function fixed_array_view(ptr::Ptr{Cvoid}, desc::FixedArrayDesc, parent)
+    T = pointee_element_type(desc.element_kind)
+    return row_major_view(Ptr{T}(ptr), fixed_array_extents(desc), parent)
+end
+
+function fixed_array_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, parent)
+    desc = fixed_array_desc(type_desc)
+    if prod(fixed_array_extents(desc)) <= FIXED_ARRAY_TUPLE_LIMIT
+        return unsafe_load(Ptr{fixed_array_tuple_type(desc)}(ptr))
+    end
+    return fixed_array_view(ptr, desc, parent)
+end
+
+# Assign a (nested) tuple or an array of matching size to a std::array member
+function set_fixed_array!(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, value)
+    desc = fixed_array_desc(type_desc)
+    if value isa Tuple
+        TT = fixed_array_tuple_type(desc)
+        unsafe_store!(Ptr{TT}(ptr), convert(TT, value))
+    elseif value isa AbstractArray
+        extents = fixed_array_extents(desc)
+        dest = fixed_array_view(ptr, desc, nothing)
+        size(value) == extents || length(extents) == 1 && length(value) == extents[1] ||
+            throw(DimensionMismatch("cannot assign array of size $(size(value)) to std::array of extents $extents"))
+        copyto!(dest, value)
+    else
+        error("Cannot assign $(typeof(value)) to a std::array member")
+    end
+    return value
+end
+
+"""
+    array_view(obj::CppStruct, name::Symbol)
+
+Zero-copy view of the `std::array` member `name` of `obj`, whatever its size.
+Nested arrays are viewed with one dimension per level, indexed like the C++
+array (`A[i, j]` is `a[i-1][j-1]`). Reading the member with `obj.name` returns
+an isbits `NTuple` instead when it has at most $(FIXED_ARRAY_TUPLE_LIMIT) elements.
+
+# Example
+```julia
+m = array_view(body, :inertia)   # std::array<std::array<double, 3>, 3>
+m[1, 2] = 0.5                    # writes body.inertia[0][1]
+```
+"""
+function array_view(obj::CppStruct, name::Symbol)
+    member = find_extension_member(obj, name)
+    if member === nothing || unsafe_load(Ptr{UInt64}(member.type)) != GLZ_JL_TYPE_FIXED_ARRAY
+        error("Member '$name' is not a std::array member")
+    end
+    ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), getfield(obj, :ptr))
+    return fixed_array_view(ptr, fixed_array_desc(member.type), obj)
+end
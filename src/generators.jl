@@ -0,0 +1,191 @@
+# Generator methods
+#
+# Member functions returning a C++23 std::generator are registered in C++ with
+# glz_jl::register_generator_method (see cpp_interface/glaze_jl/generators.hpp)
+# as extension members using the GLZ_JL_TYPE_GENERATOR kind. Calling one starts
+# the coroutine and returns a CppGenerator, which resumes it one batch at a
+# time into a reusable buffer.
+
+const GLZ_JL_TYPE_GENERATOR = UInt64(74)
+
+const GENERATOR_VALUES = 0x00
+const GENERATOR_STRINGS = 0x01
+const GENERATOR_STRUCTS = 0x02
+
+# Argument kind of std::string and std::string_view parameters (GLZ_JL_ARG_STRING)
+const METHOD_ARG_STRING = 0x40
+
+# Elements pulled per resume call unless `batch` is given
+const DEFAULT_GENERATOR_BATCH = 1024
+
+# Matches glz_jl_generator_ops
+struct GeneratorOps
+    start::Ptr{Cvoid}
+    next::Ptr{Cvoid}
+    close::Ptr{Cvoid}
+    destroy_element::Ptr{Cvoid}
+end
+
+# Matches glz_jl_generator_desc (payload after the descriptor kind)
+struct GeneratorDesc
+    element_class::UInt8
+    element_kind::UInt8
+    arg_count::UInt8
+    padding::NTuple{5, UInt8}
+    ops::Ptr{GeneratorOps}
+    arg_kinds::Ptr{UInt8}
+    element_type::Ptr{UInt8}
+end
+
+@inline generator_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{GeneratorDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+"""
+    GeneratorMethod
+
+A generator member function bound to its object. Calling it with the method's
+arguments starts the C++ coroutine and returns a [`CppGenerator`](@ref); the
+`batch` keyword sets how many elements each resume pulls.
+
+```julia
+for r in reader.records("trades.csv"; batch = 4096)
+    total += r.price
+end
+```
+"""
+struct GeneratorMethod
+    obj_ptr::Ptr{Cvoid}
+    lib::Ptr{Cvoid}
+    desc::GeneratorDesc
+    name::String
+    parent::Any
+end
+
+generator_method(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, lib::Ptr{Cvoid}, name::String, parent) =
+    GeneratorMethod(ptr, lib, generator_desc(type_desc), name, parent)
+
+"""
+    CppGenerator{T}
+
+Single-pass iterator over a running C++ generator. Elements are pulled in
+batches into a buffer reused across batches: arithmetic elements are copied,
+strings become `String`s, and struct elements are `CppStruct`s owned by Julia.
+Iterating again continues where the last loop stopped. `close(g)` destroys the
+coroutine early; otherwise that happens when it finishes or `g` is collected.
+"""
+mutable struct CppGenerator{T, B}
+    cursor::Ptr{Cvoid}
+    ops::GeneratorOps
+    lib::Ptr{Cvoid}
+    info::Union{Nothing, ConcreteTypeInfo}   # element type info for struct elements
+    buffer::Vector{B}
+    count::Int
+    index::Int
+    keepalive::Any   # object and arguments the coroutine frame may refer to
+
+    function CppGenerator{T, B}(cursor, ops, lib, info, batch, keepalive) where {T, B}
+        g = new{T, B}(cursor, ops, lib, info, Vector{B}(undef, batch), 0, 0, keepalive)
+        finalizer(close, g)
+        return g
+    end
+end
+
+generator_element_type(desc::GeneratorDesc) =
+    desc.element_class == GENERATOR_VALUES ? pointee_element_type(desc.element_kind) :
+    desc.element_class == GENERATOR_STRINGS ? String : CppStruct
+
+generator_buffer_type(desc::GeneratorDesc) =
+    desc.element_class == GENERATOR_VALUES ? pointee_element_type(desc.element_kind) :
+    desc.element_class == GENERATOR_STRINGS ? StringRef : Ptr{Cvoid}
+
+# Argument of an extension member method in the form C++ reads it (see
+# glz_jl::detail::call_arg), with the string it points into, if any
+function method_arg(kind::UInt8, x)
+    if kind == METHOD_ARG_STRING
+        s = String(x)
+        return s, Ref(StringRef(pointer(s), sizeof(s)))
+    end
+    return nothing, Ref(convert(pointee_element_type(kind), x))
+end
+
+# Converted arguments (to keep alive across the call) and the pointer array passed to C++
+function method_args(arg_kinds::Ptr{UInt8}, args)
+    converted = [method_arg(unsafe_load(arg_kinds, i), args[i]) for i in 1:length(args)]
+    return converted, Ptr{Cvoid}[Base.unsafe_convert(Ptr{Cvoid}, ref) for (_, ref) in converted]
+end
+
+function (m::GeneratorMethod)(args...; batch::Integer=DEFAULT_GENERATOR_BATCH)
+    n = Int(m.desc.arg_count)
+    length(args) == n || error("Generator method '$(m.name)' takes $n arguments, got $(length(args))")
+    batch > 0 || error("Generator batch size must be positive, got $batch")
+
+    converted, arg_ptrs = method_args(m.desc.arg_kinds, args)
+    ops = unsafe_load(m.desc.ops)
+    cursor = GC.@preserve converted arg_ptrs @ffi ccall(ops.start, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{Ptr{Cvoid}}),
+                                                    m.obj_ptr, arg_ptrs)
+
+    info = m.desc.element_class == GENERATOR_STRUCTS ? pointee_info(m.lib, m.desc.element_type) : nothing
+    T = generator_element_type(m.desc)
+    return CppGenerator{T, generator_buffer_type(m.desc)}(cursor, ops, m.lib, info, Int(batch),
+                                                          (m.parent, converted))
+end
+
+function Base.show(io::IO, m::GeneratorMethod)
+    print(io, "GeneratorMethod ", m.name, " (", m.desc.arg_count, " arguments, yields ",
+          generator_element_type(m.desc), ")")
+end
+
+function Base.close(g::CppGenerator{T}) where {T}
+    if g.cursor != C_NULL
+        if T === CppStruct
+            # Struct elements already pulled but not yet handed out
+            for i in (g.index + 1):g.count
+                @ffi ccall(g.ops.destroy_element, Cvoid, (Ptr{Cvoid},), g.buffer[i])
+            end
+        end
+        @ffi ccall(g.ops.close, Cvoid, (Ptr{Cvoid},), g.cursor)
+        g.cursor = C_NULL
+        g.count = g.index = 0
+    end
+    return nothing
+end
+
+Base.isopen(g::CppGenerator) = g.cursor != C_NULL
+Base.eltype(::Type{<:CppGenerator{T}}) where {T} = T
+Base.IteratorSize(::Type{<:CppGenerator}) = Base.SizeUnknown()
+
+# Resume the coroutine for the next batch when the buffer is used up; false when done
+function advance!(g::CppGenerator)
+    g.index += 1
+    g.index <= g.count && return true
+    g.cursor == C_NULL && return false
+    g.count = GC.@preserve g Int(@ffi ccall(g.ops.next, Csize_t, (Ptr{Cvoid}, Ptr{Cvoid}, Csize_t),
+                                        g.cursor, pointer(g.buffer), length(g.buffer)))
+    g.index = 1
+    if g.count == 0
+        close(g)
+        return false
+    end
+    return true
+end
+
+@inline generator_element(g::CppGenerator, x) = x
+@inline generator_element(g::CppGenerator{String}, s::StringRef) = unsafe_string(s.data, s.size)
+
+function generator_element(g::CppGenerator{CppStruct}, p::Ptr{Cvoid})
+    obj = CppStruct(p, g.info, g.lib, false)
+    destroy = g.ops.destroy_element
+    finalizer(x -> @ffi(ccall(destroy, Cvoid, (Ptr{Cvoid},), x.ptr)), obj)
+    return obj
+end
+
+function Base.iterate(g::CppGenerator, state=nothing)
+    advance!(g) || return nothing
+    return generator_element(g, @inbounds g.buffer[g.index]), nothing
+end
+
+function Base.show(io::IO, g::CppGenerator{T}) where {T}
+    print(io, "CppGenerator{", T, "} (", isopen(g) ? "running" : "finished", ", batch ", length(g.buffer), ")")
+end
+
+export CppGenerator, GeneratorMethod
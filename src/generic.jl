@@ -0,0 +1,266 @@
+# glz::generic (JSON) members
+#
+# glz::generic members are registered in C++ with glz_jl::register_generic_member
+# (see cpp_interface/glaze_jl/generic.hpp) as extension members using the
+# GLZ_JL_TYPE_GENERIC kind. Objects and arrays read as lazy views that walk the
+# C++ tree one node at a time; scalars read as Julia values. `copy` converts a
+# view to Dict/Vector in one pass, and assignments edit the tree in place.
+
+const GLZ_JL_TYPE_GENERIC = UInt64(76)
+
+const GENERIC_NULL = 0x00
+const GENERIC_NUMBER = 0x01
+const GENERIC_STRING = 0x02
+const GENERIC_BOOL = 0x03
+const GENERIC_ARRAY = 0x04
+const GENERIC_OBJECT = 0x05
+const GENERIC_INT64 = 0x06
+const GENERIC_UINT64 = 0x07
+
+# Matches glz_jl_generic_ops
+struct GenericOps
+    type::Ptr{Cvoid}
+    size::Ptr{Cvoid}
+    number::Ptr{Cvoid}
+    int64::Ptr{Cvoid}
+    uint64::Ptr{Cvoid}
+    boolean::Ptr{Cvoid}
+    string::Ptr{Cvoid}
+    at::Ptr{Cvoid}
+    find::Ptr{Cvoid}
+    items::Ptr{Cvoid}
+    set_null::Ptr{Cvoid}
+    set_number::Ptr{Cvoid}
+    set_int64::Ptr{Cvoid}
+    set_uint64::Ptr{Cvoid}
+    set_bool::Ptr{Cvoid}
+    set_string::Ptr{Cvoid}
+    set_array::Ptr{Cvoid}
+    set_object::Ptr{Cvoid}
+    insert::Ptr{Cvoid}
+    erase::Ptr{Cvoid}
+    push::Ptr{Cvoid}
+    resize::Ptr{Cvoid}
+    erase_at::Ptr{Cvoid}
+    assign::Ptr{Cvoid}
+end
+
+# Matches glz_jl_generic_desc (payload after the descriptor kind)
+struct GenericDesc
+    ops::Ptr{GenericOps}
+    reserved::NTuple{3, Ptr{Cvoid}}
+end
+
+@inline generic_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{GenericDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+"""
+    CppJsonObject <: AbstractDict{String, Any}
+
+Lazy view of a JSON object inside a C++ `glz::generic`. Lookups run in C++;
+nested objects and arrays are views too, and scalars are read as `nothing`,
+`Float64`, `Int64`/`UInt64`, `Bool` or `String`. `d[key] = value` and
+`delete!` edit the C++ tree; `copy(d)` converts it to a `Dict{String, Any}`.
+
+Views point at C++ nodes: a view into an array element is invalidated when the
+array grows, and any view is invalidated when an ancestor is reassigned.
+"""
+struct CppJsonObject <: AbstractDict{String, Any}
+    node::Ptr{Cvoid}
+    ops::GenericOps
+    parent::Any
+end
+
+"""
+    CppJsonArray <: AbstractVector{Any}
+
+Lazy view of a JSON array inside a C++ `glz::generic`, with the same element
+rules and invalidation as [`CppJsonObject`](@ref). Supports `push!`,
+`resize!`, `deleteat!` and `setindex!` in place; `copy(a)` converts it to a
+`Vector{Any}`.
+"""
+struct CppJsonArray <: AbstractVector{Any}
+    node::Ptr{Cvoid}
+    ops::GenericOps
+    parent::Any
+end
+
+const CppJsonView = Union{CppJsonObject, CppJsonArray}
+
+@inline generic_type(node::Ptr{Cvoid}, ops::GenericOps) = @ffi ccall(ops.type, UInt8, (Ptr{Cvoid},), node)
+@inline generic_size(node::Ptr{Cvoid}, ops::GenericOps) = Int(@ffi ccall(ops.size, Csize_t, (Ptr{Cvoid},), node))
+
+function generic_node_value(node::Ptr{Cvoid}, ops::GenericOps, parent)
+    t = generic_type(node, ops)
+    if t == GENERIC_OBJECT
+        return CppJsonObject(node, ops, parent)
+    elseif t == GENERIC_ARRAY
+        return CppJsonArray(node, ops, parent)
+    elseif t == GENERIC_NUMBER
+        return @ffi ccall(ops.number, Cdouble, (Ptr{Cvoid},), node)
+    elseif t == GENERIC_STRING
+        out = Ref{StringRef}()
+        @ffi ccall(ops.string, Cvoid, (Ptr{Cvoid}, Ptr{StringRef}), node, out)
+        return unsafe_string(out[].data, out[].size)
+    elseif t == GENERIC_BOOL
+        return @ffi ccall(ops.boolean, Cint, (Ptr{Cvoid},), node) == 1
+    elseif t == GENERIC_INT64
+        return @ffi ccall(ops.int64, Int64, (Ptr{Cvoid},), node)
+    elseif t == GENERIC_UINT64
+        return @ffi ccall(ops.uint64, UInt64, (Ptr{Cvoid},), node)
+    end
+    return nothing
+end
+
+generic_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, parent) =
+    generic_node_value(ptr, unsafe_load(generic_desc(type_desc).ops), parent)
+
+set_generic!(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, value) =
+    assign_generic!(ptr, unsafe_load(generic_desc(type_desc).ops), value)
+
+# Write a Julia value into a C++ node
+function assign_generic!(node::Ptr{Cvoid}, ops::GenericOps, value)
+    if value isa CppJsonView
+        # Deep copy in C++; safe when the source lies inside the destination
+        @ffi ccall(ops.assign, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), node, value.node)
+    elseif value === nothing || value === missing
+        @ffi ccall(ops.set_null, Cvoid, (Ptr{Cvoid},), node)
+    elseif value isa Bool
+        @ffi ccall(ops.set_bool, Cvoid, (Ptr{Cvoid}, Cint), node, value)
+    elseif value isa Signed
+        @ffi ccall(ops.set_int64, Cvoid, (Ptr{Cvoid}, Int64), node, value)
+    elseif value isa Unsigned
+        @ffi ccall(ops.set_uint64, Cvoid, (Ptr{Cvoid}, UInt64), node, value)
+    elseif value isa Real
+        @ffi ccall(ops.set_number, Cvoid, (Ptr{Cvoid}, Cdouble), node, value)
+    elseif value isa Union{AbstractString, Symbol}
+        s = String(value)
+        GC.@preserve s @ffi ccall(ops.set_string, Cvoid, (Ptr{Cvoid}, Ptr{UInt8}, Csize_t), node, pointer(s), sizeof(s))
+    elseif value isa AbstractDict
+        @ffi ccall(ops.set_object, Cvoid, (Ptr{Cvoid},), node)
+        for (k, v) in value
+            assign_generic!(generic_insert(node, ops, k), ops, v)
+        end
+    elseif value isa Union{AbstractVector, Tuple}
+        @ffi ccall(ops.set_array, Cvoid, (Ptr{Cvoid}, Csize_t), node, length(value))
+        for (i, v) in enumerate(value)
+            assign_generic!(@ffi(ccall(ops.at, Ptr{Cvoid}, (Ptr{Cvoid}, Csize_t), node, i - 1)), ops, v)
+        end
+    else
+        error("Cannot store $(typeof(value)) in a glz::generic value")
+    end
+    return value
+end
+
+# Object entry for `key`, created as null if missing
+function generic_insert(node::Ptr{Cvoid}, ops::GenericOps, key)
+    k = String(key)
+    return GC.@preserve k @ffi ccall(ops.insert, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{UInt8}, Csize_t), node, pointer(k), sizeof(k))
+end
+
+function generic_find(d::CppJsonObject, key)
+    k = String(key)
+    return GC.@preserve k @ffi ccall(d.ops.find, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{UInt8}, Csize_t), d.node, pointer(k), sizeof(k))
+end
+
+# Objects
+
+Base.length(d::CppJsonObject) = generic_size(d.node, d.ops)
+Base.haskey(d::CppJsonObject, key::Union{AbstractString, Symbol}) = generic_find(d, key) != C_NULL
+
+function Base.get(d::CppJsonObject, key::Union{AbstractString, Symbol}, default)
+    child = generic_find(d, key)
+    return child == C_NULL ? default : generic_node_value(child, d.ops, d.parent)
+end
+
+function Base.getindex(d::CppJsonObject, key::Union{AbstractString, Symbol})
+    child = generic_find(d, key)
+    child == C_NULL && throw(KeyError(key))
+    return generic_node_value(child, d.ops, d.parent)
+end
+
+function Base.setindex!(d::CppJsonObject, value, key::Union{AbstractString, Symbol})
+    assign_generic!(generic_insert(d.node, d.ops, key), d.ops, value)
+    return d
+end
+
+function Base.delete!(d::CppJsonObject, key::Union{AbstractString, Symbol})
+    k = String(key)
+    GC.@preserve k @ffi ccall(d.ops.erase, Csize_t, (Ptr{Cvoid}, Ptr{UInt8}, Csize_t), d.node, pointer(k), sizeof(k))
+    return d
+end
+
+function Base.empty!(d::CppJsonObject)
+    @ffi ccall(d.ops.set_object, Cvoid, (Ptr{Cvoid},), d.node)
+    return d
+end
+
+# Entries are fetched in one call when iteration starts
+function Base.iterate(d::CppJsonObject)
+    n = length(d)
+    keys = Vector{StringRef}(undef, n)
+    values = Vector{Ptr{Cvoid}}(undef, n)
+    n = Int(@ffi ccall(d.ops.items, Csize_t, (Ptr{Cvoid}, Ptr{StringRef}, Ptr{Ptr{Cvoid}}, Csize_t),
+                  d.node, keys, values, n))
+    return iterate(d, (keys, values, n, 1))
+end
+
+function Base.iterate(d::CppJsonObject, state)
+    keys, values, n, i = state
+    i > n && return nothing
+    key = unsafe_string(keys[i].data, keys[i].size)
+    return key => generic_node_value(values[i], d.ops, d.parent), (keys, values, n, i + 1)
+end
+
+# Arrays
+
+Base.size(a::CppJsonArray) = (generic_size(a.node, a.ops),)
+Base.IndexStyle(::Type{CppJsonArray}) = IndexLinear()
+
+@inline function generic_at(a::CppJsonArray, i::Int)
+    @boundscheck checkbounds(a, i)
+    return @ffi ccall(a.ops.at, Ptr{Cvoid}, (Ptr{Cvoid}, Csize_t), a.node, i - 1)
+end
+
+Base.@propagate_inbounds Base.getindex(a::CppJsonArray, i::Int) =
+    generic_node_value(generic_at(a, i), a.ops, a.parent)
+
+Base.@propagate_inbounds function Base.setindex!(a::CppJsonArray, value, i::Int)
+    assign_generic!(generic_at(a, i), a.ops, value)
+    return a
+end
+
+function Base.push!(a::CppJsonArray, value)
+    assign_generic!(@ffi(ccall(a.ops.push, Ptr{Cvoid}, (Ptr{Cvoid},), a.node)), a.ops, value)
+    return a
+end
+
+function Base.resize!(a::CppJsonArray, n::Integer)
+    n >= 0 || throw(ArgumentError("new length must be ≥ 0"))
+    @ffi ccall(a.ops.resize, Cvoid, (Ptr{Cvoid}, Csize_t), a.node, n)
+    return a
+end
+
+function Base.deleteat!(a::CppJsonArray, i::Integer)
+    checkbounds(a, i)
+    @ffi ccall(a.ops.erase_at, Cvoid, (Ptr{Cvoid}, Csize_t), a.node, i - 1)
+    return a
+end
+
+Base.empty!(a::CppJsonArray) = resize!(a, 0)
+
+# Bulk conversion
+
+"""
+    copy(d::CppJsonObject) -> Dict{String, Any}
+    copy(a::CppJsonArray) -> Vector{Any}
+
+Convert a `glz::generic` view and everything below it to Julia values in one pass.
+"""
+Base.copy(d::CppJsonObject) = Dict{String, Any}(k => generic_copy(v) for (k, v) in d)
+Base.copy(a::CppJsonArray) = Any[generic_copy(v) for v in a]
+
+generic_copy(x) = x
+generic_copy(x::CppJsonView) = copy(x)
+
+export CppJsonObject, CppJsonArray
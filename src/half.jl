@@ -0,0 +1,80 @@
+# Half-precision element types
+#
+# std::float16_t maps to Julia's Float16. std::bfloat16_t (and other 16-bit
+# brain floats with the same layout) maps to Glaze.BFloat16, a bits type with
+# the upper half of a Float32. Both use primitive kinds 12 and 13.
+
+const PRIMITIVE_KIND_FLOAT16 = UInt64(12)
+const PRIMITIVE_KIND_BFLOAT16 = UInt64(13)
+
+"""
+    BFloat16 <: AbstractFloat
+
+16-bit brain floating point value (1 sign, 8 exponent and 7 mantissa bits),
+layout-compatible with `std::bfloat16_t`. Arithmetic is carried out in
+`Float32` and rounded back to nearest-even.
+"""
+primitive type BFloat16 <: AbstractFloat 16 end
+
+BFloat16(x::Float32) = isnan(x) ? reinterpret(BFloat16, UInt16(0x7fc0) | (UInt16(reinterpret(UInt32, x) >> 16) & 0x8000)) :
+    reinterpret(BFloat16, UInt16((reinterpret(UInt32, x) + 0x7fff + ((reinterpret(UInt32, x) >> 16) & 0x1)) >> 16))
+BFloat16(x::BFloat16) = x
+BFloat16(x::Real) = BFloat16(Float32(x))
+
+Base.Float32(x::BFloat16) = reinterpret(Float32, UInt32(reinterpret(UInt16, x)) << 16)
+Base.Float64(x::BFloat16) = Float64(Float32(x))
+Base.Float16(x::BFloat16) = Float16(Float32(x))
+
+Base.promote_rule(::Type{BFloat16}, ::Type{Float16}) = Float32
+Base.promote_rule(::Type{BFloat16}, ::Type{Float32}) = Float32
+Base.promote_rule(::Type{BFloat16}, ::Type{Float64}) = Float64
+Base.promote_rule(::Type{BFloat16}, ::Type{<:Integer}) = BFloat16
+
+for op in (:+, :-, :*, :/, :^)
+    @eval Base.$op(a::BFloat16, b::BFloat16) = BFloat16($op(Float32(a), Float32(b)))
+end
+Base.:-(x::BFloat16) = reinterpret(BFloat16, reinterpret(UInt16, x) ⊻ 0x8000)
+Base.abs(x::BFloat16) = reinterpret(BFloat16, reinterpret(UInt16, x) & 0x7fff)
+for f in (:sqrt, :exp, :log, :sin, :cos, :tan)
+    @eval Base.$f(x::BFloat16) = BFloat16($f(Float32(x)))
+end
+
+Base.:(==)(a::BFloat16, b::BFloat16) = Float32(a) == Float32(b)
+Base.:<(a::BFloat16, b::BFloat16) = Float32(a) < Float32(b)
+Base.:<=(a::BFloat16, b::BFloat16) = Float32(a) <= Float32(b)
+Base.isless(a::BFloat16, b::BFloat16) = isless(Float32(a), Float32(b))
+Base.isnan(x::BFloat16) = reinterpret(UInt16, x) & 0x7fff > 0x7f80
+Base.isinf(x::BFloat16) = reinterpret(UInt16, x) & 0x7fff == 0x7f80
+Base.isfinite(x::BFloat16) = reinterpret(UInt16, x) & 0x7f80 != 0x7f80
+Base.signbit(x::BFloat16) = reinterpret(UInt16, x) & 0x8000 != 0
+Base.hash(x::BFloat16, h::UInt) = hash(Float32(x), h)
+
+Base.zero(::Type{BFloat16}) = reinterpret(BFloat16, 0x0000)
+Base.one(::Type{BFloat16}) = reinterpret(BFloat16, 0x3f80)
+Base.eps(::Type{BFloat16}) = reinterpret(BFloat16, 0x3c00)
+Base.typemin(::Type{BFloat16}) = reinterpret(BFloat16, 0xff80)
+Base.typemax(::Type{BFloat16}) = reinterpret(BFloat16, 0x7f80)
+Base.floatmin(::Type{BFloat16}) = reinterpret(BFloat16, 0x0080)
+Base.floatmax(::Type{BFloat16}) = reinterpret(BFloat16, 0x7f7f)
+
+Base.show(io::IO, x::BFloat16) = print(io, "BFloat16(", Float32(x), ")")
+
+# Primitive kind of a Julia element type, or nothing if it has none
+function julia_type_to_primitive_kind(T::Type)
+    T === Bool && return UInt64(1)
+    T === Int8 && return UInt64(2)
+    T === Int16 && return UInt64(3)
+    T === Int32 && return UInt64(4)
+    T === Int64 && return UInt64(5)
+    T === UInt8 && return UInt64(6)
+    T === UInt16 && return UInt64(7)
+    T === UInt32 && return UInt64(8)
+    T === UInt64 && return UInt64(9)
+    T === Float32 && return UInt64(10)
+    T === Float64 && return UInt64(11)
+    T === Float16 && return PRIMITIVE_KIND_FLOAT16
+    T === BFloat16 && return PRIMITIVE_KIND_BFLOAT16
+    return nothing
+end
+
+export BFloat16
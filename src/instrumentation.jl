@@ -0,0 +1,392 @@
+# Opt-in instrumentation of FFI crossings: per-entry-point call counts,
+# latency histograms and a Chrome trace-format timeline
+
+# log2 latency buckets: bucket k counts calls taking [2^(k-1), 2^k) ns, the first
+# also those under 1 ns (matches GLZ_JL_LATENCY_BUCKETS in cpp_interface/glaze_jl/instrumentation.hpp)
+const LATENCY_BUCKETS = 40
+
+# Trace events kept before further events are dropped
+const MAX_TRACE_EVENTS = 1_000_000
+
+# Fast-path flags checked at every crossing so instrumentation costs one load until enabled
+const _instrumentation_active = Ref(false)
+const _trace_active = Ref(false)
+
+mutable struct EntryCounters
+    count::Int
+    total_ns::UInt64
+    max_ns::UInt64
+    histogram::Vector{Int}
+end
+
+EntryCounters() = EntryCounters(0, UInt64(0), UInt64(0), zeros(Int, LATENCY_BUCKETS))
+
+struct TraceEvent
+    name::String         # entry point for FFI crossings, user label for spans
+    fptr::Ptr{Cvoid}     # C_NULL for spans
+    site::String
+    start_ns::UInt64
+    duration_ns::UInt64
+    tid::Int
+end
+
+# A spin lock: crossings are recorded from finalizers, and recording must not yield
+# between a ccall and the read of a result the C++ side keeps in thread-local storage
+const _stats_lock = Threads.SpinLock()
+# (function pointer, call site) -> counters
+const _entry_counters = Dict{Tuple{Ptr{Cvoid}, String}, EntryCounters}()
+# (function pointer, call site) -> name derived from the ccall expression
+const _fallback_names = Dict{Tuple{Ptr{Cvoid}, String}, String}()
+# Exported symbol name of every function pointer resolved through get_cached_function
+const _entry_names = Dict{Ptr{Cvoid}, Symbol}()
+const _trace_events = TraceEvent[]
+const _dropped_events = Ref(0)
+const _trace_origin = Ref(UInt64(0))
+
+"""
+    FFIStats
+
+Calls through one C entry point, as returned by `Glaze.stats()`.
+
+# Fields
+- `name`: Exported symbol of the entry point, or the Julia expression that
+  produced the function pointer (e.g. `member.getter`) for unexported ones
+- `site`: Calling Glaze wrapper as `file:line`, empty when aggregated over call sites
+- `native`: `true` for timings recorded inside C++ by `GLZ_JL_TIMED`
+- `count`: Number of calls
+- `total_ns`, `max_ns`: Total and largest latency in nanoseconds
+- `histogram`: Calls per log2 latency bucket; bucket `k` holds latencies in
+  `[2^(k-1), 2^k)` ns
+"""
+struct FFIStats
+    name::String
+    site::String
+    native::Bool
+    count::Int
+    total_ns::UInt64
+    max_ns::UInt64
+    histogram::Vector{Int}
+end
+
+mean_ns(s::FFIStats) = s.count == 0 ? 0.0 : s.total_ns / s.count
+
+# Upper bound of the log2 bucket containing quantile p
+function quantile_ns(s::FFIStats, p::Real)
+    s.count == 0 && return 0.0
+    target = p * s.count
+    seen = 0
+    for (k, n) in enumerate(s.histogram)
+        seen += n
+        seen >= target && return Float64(min(UInt64(1) << k, s.max_ns))
+    end
+    return Float64(s.max_ns)
+end
+
+function Base.show(io::IO, s::FFIStats)
+    print(io, "FFIStats(", s.native ? "native " : "", s.name)
+    isempty(s.site) || print(io, " @ ", s.site)
+    print(io, ": ", s.count, " calls, ", round(mean_ns(s); digits=1), " ns mean)")
+end
+
+@inline latency_bucket(ns::UInt64) = clamp(64 - leading_zeros(ns), 1, LATENCY_BUCKETS)
+
+# Called after every instrumented ccall while instrumentation is enabled
+function record_ffi!(fptr::Ptr, site::String, fallback::String, start_ns::UInt64, stop_ns::UInt64)
+    fptr = Ptr{Cvoid}(fptr)
+    ns = stop_ns - start_ns
+    lock(_stats_lock)
+    try
+        counters = get!(EntryCounters, _entry_counters, (fptr, site))
+        if counters.count == 0
+            _fallback_names[(fptr, site)] = fallback
+        end
+        counters.count += 1
+        counters.total_ns += ns
+        counters.max_ns = max(counters.max_ns, ns)
+        counters.histogram[latency_bucket(ns)] += 1
+        if _trace_active[]
+            record_event!(TraceEvent(fallback, fptr, site, start_ns, ns, Threads.threadid()))
+        end
+    finally
+        unlock(_stats_lock)
+    end
+    return nothing
+end
+
+function record_event!(event::TraceEvent)
+    if length(_trace_events) < MAX_TRACE_EVENTS
+        push!(_trace_events, event)
+    else
+        _dropped_events[] += 1
+    end
+end
+
+# Remember which exported symbol a cached function pointer belongs to
+function register_entry_name!(fptr::Ptr{Cvoid}, symbol::Symbol)
+    lock(_stats_lock) do
+        _entry_names[fptr] = symbol
+    end
+    return fptr
+end
+
+entry_name(fptr::Ptr{Cvoid}, fallback::String) = string(get(_entry_names, fptr, fallback))
+
+# Name shown for a ccall whose function pointer was not resolved through get_cached_function
+function ffi_fallback_name(fexpr)
+    if fexpr isa Expr && fexpr.head === :call && length(fexpr.args) >= 3 &&
+       fexpr.args[1] in (:get_cached_function, :(Libdl.dlsym)) && fexpr.args[3] isa QuoteNode
+        return string(fexpr.args[3].value)
+    end
+    return string(fexpr)
+end
+
+# Wrap every ccall through a runtime function pointer in `ex` with timing
+function instrument_ccalls(ex, file::String, line::Int)
+    ex isa Expr || return ex
+    # Calls to a library function by name (ccall(:strlen, ...)) are not crossings into Glaze
+    if ex.head === :call && ex.args[1] === :ccall && !(ex.args[2] isa QuoteNode || Meta.isexpr(ex.args[2], :tuple))
+        fptr, t0, result = gensym("fptr"), gensym("t0"), gensym("result")
+        site = string(basename(file), ":", line)
+        fallback = ffi_fallback_name(ex.args[2])
+        call = Expr(:call, :ccall, fptr, ex.args[3:end]...)
+        return quote
+            $fptr = $(ex.args[2])
+            if _instrumentation_active[]
+                $t0 = time_ns()
+                $result = $call
+                record_ffi!($fptr, $site, $fallback, $t0, time_ns())
+                $result
+            else
+                $call
+            end
+        end
+    end
+    return Expr(ex.head, map(a -> instrument_ccalls(a, file, line), ex.args)...)
+end
+
+"""
+    @ffi ccall(fptr, ...)
+
+Record the `ccall`s in an expression in `Glaze.stats()` and the trace while
+instrumentation is enabled. When it is disabled this costs one flag check.
+"""
+macro ffi(ex)
+    file = __source__.file === nothing ? "none" : string(__source__.file)
+    return esc(instrument_ccalls(ex, file, __source__.line))
+end
+
+# Optional native entry points, per library handle (C_NULL when not exported)
+const _native_stats_funcs = Dict{Ptr{Cvoid}, NTuple{3, Ptr{Cvoid}}}()
+
+# Matches glz_jl_entry_stats in cpp_interface/glaze_jl/instrumentation.hpp
+struct NativeEntryStats
+    name::Ptr{UInt8}
+    count::UInt64
+    total_ns::UInt64
+    max_ns::UInt64
+    histogram::NTuple{LATENCY_BUCKETS, UInt64}
+end
+
+function native_stats_funcs(handle::Ptr{Cvoid})
+    lock(_stats_lock) do
+        get!(_native_stats_funcs, handle) do
+            sym(name) = something(Libdl.dlsym(handle, name; throw_error=false), C_NULL)
+            (sym(:glz_jl_set_instrumentation), sym(:glz_jl_native_stats), sym(:glz_jl_reset_native_stats))
+        end
+    end
+end
+
+function set_native_instrumentation!(handle::Ptr{Cvoid}, enabled::Bool)
+    set_func = native_stats_funcs(handle)[1]
+    set_func == C_NULL || ccall(set_func, Cvoid, (Cint,), enabled)
+    return nothing
+end
+
+function native_stats(handle::Ptr{Cvoid})
+    stats_func = native_stats_funcs(handle)[2]
+    stats_func == C_NULL && return NativeEntryStats[]
+    buffer = Vector{NativeEntryStats}(undef, 64)
+    n = Int(ccall(stats_func, Csize_t, (Ptr{NativeEntryStats}, Csize_t), buffer, length(buffer)))
+    if n > length(buffer)
+        resize!(buffer, n)
+        n = Int(ccall(stats_func, Csize_t, (Ptr{NativeEntryStats}, Csize_t), buffer, length(buffer)))
+    end
+    return buffer[1:min(n, length(buffer))]
+end
+
+"""
+    enable_instrumentation!(; trace::Bool=false)
+
+Start recording every FFI crossing made by Glaze wrappers: which C entry point
+was called, from which wrapper, how often and how long it took. C++ entry points
+that open a `GLZ_JL_TIMED` scope are timed on the C++ side as well.
+
+With `trace=true` each crossing is also kept as a timeline event for
+`export_trace`. Counters accumulate until `reset_stats()`.
+
+# Example
+```julia
+Glaze.enable_instrumentation!()
+Glaze.reset_stats()
+result = process(obj)
+foreach(println, Glaze.stats())   # crossings made by process
+Glaze.disable_instrumentation!()
+```
+"""
+function enable_instrumentation!(; trace::Bool=false)
+    lock(_stats_lock) do
+        if trace && !_trace_active[]
+            _trace_origin[] = time_ns()
+        end
+        _trace_active[] = trace
+        _instrumentation_active[] = true
+    end
+    for handle in keys(snapshot(_library_registry))
+        set_native_instrumentation!(handle, true)
+    end
+    return nothing
+end
+
+"""
+    disable_instrumentation!()
+
+Stop recording crossings. Counters and trace events are kept until `reset_stats()`.
+"""
+function disable_instrumentation!()
+    _instrumentation_active[] = false
+    _trace_active[] = false
+    for handle in keys(snapshot(_library_registry))
+        set_native_instrumentation!(handle, false)
+    end
+    return nothing
+end
+
+instrumentation_enabled() = _instrumentation_active[]
+
+"""
+    reset_stats()
+
+Discard all counters and trace events, on the Julia and C++ side.
+"""
+function reset_stats()
+    lock(_stats_lock) do
+        empty!(_entry_counters)
+        empty!(_fallback_names)
+        empty!(_trace_events)
+        _dropped_events[] = 0
+        _trace_origin[] = time_ns()
+    end
+    for handle in keys(snapshot(_library_registry))
+        reset_func = native_stats_funcs(handle)[3]
+        reset_func == C_NULL || ccall(reset_func, Cvoid, ())
+    end
+    return nothing
+end
+
+function merge_counters!(into::Dict{Tuple{String, String, Bool}, EntryCounters}, key, count, total_ns, max_ns, histogram)
+    c = get!(EntryCounters, into, key)
+    c.count += count
+    c.total_ns += total_ns
+    c.max_ns = max(c.max_ns, max_ns)
+    for k in 1:LATENCY_BUCKETS
+        c.histogram[k] += histogram[k]
+    end
+    return c
+end
+
+"""
+    stats(; by_site::Bool=false) -> Vector{FFIStats}
+
+Return the recorded crossings per C entry point, most total time first. With
+`by_site=true` each entry point is split further by the Glaze wrapper (`file:line`)
+that called it. Native timings from `GLZ_JL_TIMED` scopes are included with
+`native == true`.
+"""
+function stats(; by_site::Bool=false)
+    merged = Dict{Tuple{String, String, Bool}, EntryCounters}()
+    lock(_stats_lock) do
+        for ((fptr, site), c) in _entry_counters
+            name = entry_name(fptr, _fallback_names[(fptr, site)])
+            merge_counters!(merged, (name, by_site ? site : "", false), c.count, c.total_ns, c.max_ns, c.histogram)
+        end
+    end
+    for handle in keys(snapshot(_library_registry)), s in native_stats(handle)
+        s.count == 0 && continue
+        merge_counters!(merged, (unsafe_string(s.name), "", true), Int(s.count), s.total_ns, s.max_ns, s.histogram)
+    end
+
+    result = [FFIStats(name, site, native, c.count, c.total_ns, c.max_ns, c.histogram)
+              for ((name, site, native), c) in merged]
+    return sort!(result; by=s -> (s.native, -Int128(s.total_ns), s.name, s.site))
+end
+
+"""
+    trace_span(f, name::AbstractString)
+
+Run `f()` and, while tracing, record it as a span named `name` so the crossings
+it makes are grouped under it in the exported timeline.
+"""
+function trace_span(f, name::AbstractString)
+    _trace_active[] || return f()
+    start_ns = time_ns()
+    try
+        return f()
+    finally
+        stop_ns = time_ns()
+        lock(_stats_lock) do
+            record_event!(TraceEvent(String(name), C_NULL, "", start_ns, stop_ns - start_ns, Threads.threadid()))
+        end
+    end
+end
+
+function write_json_string(io::IO, s::AbstractString)
+    print(io, '"')
+    for c in s
+        if c == '"' || c == '\\'
+            print(io, '\\', c)
+        elseif c < ' '
+            print(io, "\\u", string(UInt32(c); base=16, pad=4))
+        else
+            print(io, c)
+        end
+    end
+    print(io, '"')
+end
+
+"""
+    export_trace(path::AbstractString) -> path
+    export_trace(io::IO)
+
+Write the events recorded with `enable_instrumentation!(trace=true)` as a Chrome
+trace-format JSON timeline, viewable in `chrome://tracing` or Perfetto. FFI
+crossings have category `ffi` and carry their call site; `trace_span` regions
+have category `span`.
+"""
+function export_trace(io::IO)
+    events, origin, dropped = lock(_stats_lock) do
+        copy(_trace_events), _trace_origin[], _dropped_events[]
+    end
+    pid = getpid()
+    println(io, "{\"displayTimeUnit\": \"ns\", \"otherData\": {\"dropped_events\": ", dropped, "}, \"traceEvents\": [")
+    for (i, e) in enumerate(events)
+        span = e.fptr == C_NULL
+        print(io, "  {\"name\": ")
+        write_json_string(io, span ? e.name : entry_name(e.fptr, e.name))
+        print(io, ", \"cat\": \"", span ? "span" : "ffi", "\", \"ph\": \"X\"")
+        print(io, ", \"ts\": ", (Int128(e.start_ns) - Int128(origin)) / 1000, ", \"dur\": ", e.duration_ns / 1000)
+        print(io, ", \"pid\": ", pid, ", \"tid\": ", e.tid)
+        if !span
+            print(io, ", \"args\": {\"site\": ")
+            write_json_string(io, e.site)
+            print(io, "}")
+        end
+        println(io, i < length(events) ? "}," : "}")
+    end
+    println(io, "]}")
+    return nothing
+end
+
+function export_trace(path::AbstractString)
+    open(io -> export_trace(io), path, "w")
+    return path
+end
@@ -0,0 +1,129 @@
+# Jagged vector members
+#
+# std::vector<std::vector<T>> members are registered in C++ with
+# glz_jl::register_jagged_member (see cpp_interface/glaze_jl/jagged.hpp) as
+# extension members using the GLZ_JL_TYPE_JAGGED kind.
+
+const GLZ_JL_TYPE_JAGGED = UInt64(68)
+
+# Matches glz_jl_jagged_ops
+struct JaggedOps
+    size::Ptr{Cvoid}
+    inner_data::Ptr{Cvoid}
+    total::Ptr{Cvoid}
+    flatten::Ptr{Cvoid}
+    assign::Ptr{Cvoid}
+end
+
+# Matches glz_jl_jagged_desc (payload after the descriptor kind)
+struct JaggedDesc
+    element_kind::UInt8
+    padding::NTuple{7, UInt8}
+    ops::Ptr{JaggedOps}
+    reserved::NTuple{2, Ptr{Cvoid}}
+end
+
+@inline jagged_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{JaggedDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+"""
+    CppJaggedVector{T}
+
+Julia wrapper for a `std::vector<std::vector<T>>` member registered with
+`glz_jl::register_jagged_member`. Indexing returns a zero-copy `CppArrayView`
+of the inner vector. [`flatten_jagged`](@ref) and [`assign_jagged!`](@ref) move
+the whole member to and from flat buffers in one call each.
+"""
+struct CppJaggedVector{T} <: AbstractVector{CppArrayView{T,1}}
+    ptr::Ptr{Cvoid}
+    ops::JaggedOps
+
+    # Keep reference to the owner to prevent GC
+    parent::Any
+end
+
+function jagged_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, parent)
+    desc = jagged_desc(type_desc)
+    T = pointee_element_type(desc.element_kind)
+    return CppJaggedVector{T}(ptr, unsafe_load(desc.ops), parent)
+end
+
+Base.size(j::CppJaggedVector) = (Int(@ffi ccall(j.ops.size, Csize_t, (Ptr{Cvoid},), j.ptr)),)
+Base.IndexStyle(::Type{<:CppJaggedVector}) = IndexLinear()
+
+# Views are invalidated when the outer or inner vector reallocates
+function Base.getindex(j::CppJaggedVector{T}, i::Int) where T
+    @boundscheck checkbounds(j, i)
+    len = Ref{Csize_t}(0)
+    data = @ffi ccall(j.ops.inner_data, Ptr{Cvoid}, (Ptr{Cvoid}, Csize_t, Ref{Csize_t}), j.ptr, i - 1, len)
+    return CppArrayView{T,1}(Ptr{T}(data), (Int(len[]),), j)
+end
+
+"""
+    flatten_jagged(j::CppJaggedVector{T}) -> (values::Vector{T}, offsets::Vector{Int})
+
+Copy all elements of `j` into one buffer in a single C++ pass. Inner vector `i`
+is `values[offsets[i]:offsets[i+1]-1]`; `offsets` has `length(j) + 1` entries.
+"""
+function flatten_jagged(j::CppJaggedVector{T}) where T
+    n = length(j)
+    values = Vector{T}(undef, Int(@ffi ccall(j.ops.total, Csize_t, (Ptr{Cvoid},), j.ptr)))
+    offsets = Vector{Int64}(undef, n + 1)
+    @ffi ccall(j.ops.flatten, Cvoid, (Ptr{Cvoid}, Ptr{T}, Ptr{Int64}), j.ptr, values, offsets)
+    offsets .+= 1
+    return values, offsets
+end
+
+"""
+    assign_jagged!(j::CppJaggedVector{T}, values, offsets) -> j
+
+Rebuild the C++ `std::vector<std::vector<T>>` from flat buffers in one call, with
+inner vector `i` set to `values[offsets[i]:offsets[i+1]-1]` (the layout returned
+by [`flatten_jagged`](@ref)).
+"""
+function assign_jagged!(j::CppJaggedVector{T}, values::AbstractVector, offsets::AbstractVector{<:Integer}) where T
+    Base.isempty(offsets) && throw(ArgumentError("offsets must have at least one entry"))
+    first(offsets) == 1 || throw(ArgumentError("offsets must start at 1"))
+    last(offsets) == length(values) + 1 ||
+        throw(DimensionMismatch("last offset $(last(offsets)) does not match $(length(values)) values"))
+    issorted(offsets) || throw(ArgumentError("offsets must be nondecreasing"))
+    data = convert(Vector{T}, values)
+    zero_based = Int64[o - 1 for o in offsets]
+    @ffi ccall(j.ops.assign, Cvoid, (Ptr{Cvoid}, Ptr{T}, Ptr{Int64}, Csize_t),
+          j.ptr, data, zero_based, length(offsets) - 1)
+    return j
+end
+
+# Flat buffers for a vector of vectors
+function jagged_buffers(::Type{T}, inner_vectors) where T
+    offsets = Vector{Int}(undef, length(inner_vectors) + 1)
+    offsets[1] = 1
+    for (i, v) in enumerate(inner_vectors)
+        offsets[i + 1] = offsets[i] + length(v)
+    end
+    values = Vector{T}(undef, offsets[end] - 1)
+    for (i, v) in enumerate(inner_vectors)
+        copyto!(values, offsets[i], v, 1, length(v))
+    end
+    return values, offsets
+end
+
+# Assign a vector of vectors to a jagged member
+function set_jagged!(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, value)
+    j = jagged_value(ptr, type_desc, nothing)
+    assign_jagged!(j, jagged_buffers(eltype(eltype(j)), value)...)
+    return value
+end
+
+function Base.collect(j::CppJaggedVector{T}) where T
+    values, offsets = flatten_jagged(j)
+    return Vector{T}[values[offsets[i]:offsets[i + 1] - 1] for i in 1:length(offsets) - 1]
+end
+
+function Base.show(io::IO, j::CppJaggedVector{T}) where T
+    print(io, "CppJaggedVector{", T, "}(length=", length(j), ")")
+end
+
+Base.show(io::IO, ::MIME"text/plain", j::CppJaggedVector) = show(io, j)
+
+export CppJaggedVector, flatten_jagged, assign_jagged!
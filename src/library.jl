@@ -3,14 +3,15 @@
 struct CppLibrary
     handle::Ptr{Cvoid}
     types::Dict{String, ConcreteTypeInfo}
-    # Function pointer cache to avoid repeated dlsym calls
-    function_cache::Dict{Symbol, Ptr{Cvoid}}
+    # Function pointer cache to avoid repeated dlsym calls (read without locking)
+    function_cache::SnapshotDict{Symbol, Ptr{Cvoid}}
     
     function CppLibrary(path::String)
         handle = Libdl.dlopen(path)
-        obj = new(handle, Dict{String, ConcreteTypeInfo}(), Dict{Symbol, Ptr{Cvoid}}())
+        obj = new(handle, Dict{String, ConcreteTypeInfo}(), SnapshotDict{Symbol, Ptr{Cvoid}}())
         # Register this library for function caching
         _library_registry[handle] = obj
+        _instrumentation_active[] && set_native_instrumentation!(handle, true)
         return obj
     end
 end
@@ -20,15 +21,21 @@ end
 
 Get a cached function pointer, performing dlsym only if not already cached.
 This provides significant performance improvement for repeated operations.
+Lookups take no lock, so calls from many threads do not contend.
 """
 @inline function get_cached_function(lib::CppLibrary, symbol::Symbol)
-    get!(lib.function_cache, symbol) do
-        Libdl.dlsym(lib.handle, symbol)
-    end
+    fptr = get(lib.function_cache, symbol, nothing)
+    fptr === nothing || return fptr
+    return resolve_function!(lib, symbol)
+end
+
+@noinline function resolve_function!(lib::CppLibrary, symbol::Symbol)
+    fptr = get!(() -> Libdl.dlsym(lib.handle, symbol), lib.function_cache, symbol)
+    return register_entry_name!(fptr, symbol)
 end
 
 # Global registry to map library handles to CppLibrary objects for caching
-const _library_registry = Dict{Ptr{Cvoid}, CppLibrary}()
+const _library_registry = SnapshotDict{Ptr{Cvoid}, CppLibrary}()
 
 # For compatibility with code that uses Ptr{Cvoid} as lib handle
 @inline function get_cached_function(lib_handle::Ptr{Cvoid}, symbol::Symbol)
@@ -38,7 +45,9 @@ const _library_registry = Dict{Ptr{Cvoid}, CppLibrary}()
         return get_cached_function(lib_obj, symbol)
     else
         # Fallback to direct dlsym for raw handles when no CppLibrary object is found
-        return Libdl.dlsym(lib_handle, symbol)
+        fptr = Libdl.dlsym(lib_handle, symbol)
+        _instrumentation_active[] && register_entry_name!(fptr, symbol)
+        return fptr
     end
 end
 
@@ -70,7 +79,7 @@ function Base.getproperty(lib::CppLibrary, name::Symbol)
     # Try to create an instance of the C++ type
     type_name = String(name)
     create_func = get_cached_function(lib, :glz_create_instance)
-    ptr = ccall(create_func, Ptr{Cvoid}, (Cstring,), type_name)
+    ptr = @ffi ccall(create_func, Ptr{Cvoid}, (Cstring,), type_name)
     
     if ptr == C_NULL
         error("Type $type_name not found in library")
@@ -78,7 +87,7 @@ function Base.getproperty(lib::CppLibrary, name::Symbol)
     
     # Get type info
     info_func = get_cached_function(lib, :glz_get_type_info)
-    info_ptr = ccall(info_func, Ptr{ConcreteTypeInfo}, (Cstring,), type_name)
+    info_ptr = @ffi ccall(info_func, Ptr{ConcreteTypeInfo}, (Cstring,), type_name)
     info = unsafe_load(info_ptr)
     
     # Create Julia wrapper type dynamically
@@ -94,16 +103,50 @@ mutable struct CppStruct
     function CppStruct(ptr::Ptr{Cvoid}, info::ConcreteTypeInfo, lib::Ptr{Cvoid}, owned::Bool=true)
         obj = new(ptr, info, lib, owned)
         if owned
-            finalizer(obj) do x
-                destroy_func = get_cached_function(x.lib, :glz_destroy_instance)
-                ccall(destroy_func, Cvoid, (Cstring, Ptr{Cvoid}), 
-                      unsafe_string(x.info.name), x.ptr)
-            end
+            note_created!(info.name, info.size)
+            finalizer(destroy_owned!, obj)
         end
         return obj
     end
 end
 
+# Finalizer of owned instances. Runs for every owned instance, often many at once
+# after a collection: free of allocation and locks unless change tracking is on.
+function destroy_owned!(x::CppStruct)
+    # Tracking state is keyed by address: drop it before the address can be reused
+    if _tracking_active[] && !untrack_finalized!(x)
+        finalizer(destroy_owned!, x)   # tracking lock busy: retry on a later collection
+        return nothing
+    end
+    destroy_func = get_cached_function(x.lib, :glz_destroy_instance)
+    @ffi ccall(destroy_func, Cvoid, (Ptr{UInt8}, Ptr{Cvoid}), x.info.name, x.ptr)
+    note_destroyed!(x.info.name, x.info.size)
+    return nothing
+end
+
+# Kind of a type descriptor, read in place (loading the whole mutable
+# ConcreteTypeDescriptor would allocate)
+@inline descriptor_kind(desc::Ptr{TypeDescriptor}) = unsafe_load(Ptr{TypeKind}(desc))
+
+@inline primitive_kind(desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{PrimitiveDesc}(Ptr{UInt8}(desc) + fieldoffset(ConcreteTypeDescriptor, 2))).kind
+
+# 1-based index of the member called `name`, or 0. Names are compared as C
+# strings so lookups do not allocate.
+function member_index(info::ConcreteTypeInfo, name::Symbol)
+    for i in 1:Int(info.member_count)
+        member = unsafe_load(info.members, i)
+        if ccall(:strcmp, Cint, (Ptr{UInt8}, Ptr{UInt8}), member.name, name) == 0
+            return i
+        end
+    end
+    return 0
+end
+
+# Write an isbits member through its setter
+@inline store_member!(member::MemberInfo, obj::CppStruct, value::T) where {T} =
+    @ffi ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ref{T}), getfield(obj, :ptr), value)
+
 function Base.getproperty(obj::CppStruct, name::Symbol)
     if name in (:ptr, :info, :lib, :owned)
         return getfield(obj, name)
@@ -111,14 +154,12 @@ function Base.getproperty(obj::CppStruct, name::Symbol)
     
     # Find member
     info = getfield(obj, :info)
-    # Iterate through MemberInfo structs
-    for i in 0:(info.member_count-1)
-        member_ptr = info.members + i * sizeof(MemberInfo)
-        member = unsafe_load(member_ptr)
-        if unsafe_string(member.name) == String(name)
-            return get_member_value(obj, member)
-        end
-    end
+    i = member_index(info, name)
+    i == 0 || return get_member_value(obj, unsafe_load(info.members, i))
+    
+    # Extension members registered with the glaze_jl helpers (pointers, arrays, views)
+    member = find_extension_member(obj, name)
+    member === nothing || return get_member_value(obj, member)
     
     error("Member $name not found")
 end
@@ -130,19 +171,62 @@ function Base.setproperty!(obj::CppStruct, name::Symbol, value)
     
     # Find member
     info = getfield(obj, :info)
-    # Iterate through MemberInfo structs
-    for i in 0:(info.member_count-1)
-        member_ptr = info.members + i * sizeof(MemberInfo)
-        member = unsafe_load(member_ptr)
-        if unsafe_string(member.name) == String(name)
-            set_member_value(obj, member, value)
-            return value
-        end
+    i = member_index(info, name)
+    if i != 0
+        set_member_value(obj, unsafe_load(info.members, i), value)
+        _tracking_active[] && record_member_change!(getfield(obj, :ptr), i)
+        return value
+    end
+    
+    # Extension members registered with the glaze_jl helpers
+    member = find_extension_member(obj, name)
+    if member !== nothing
+        set_member_value(obj, member, value)
+        _tracking_active[] && record_extension_change!(obj, member)
+        return value
     end
     
     error("Member $name not found")
 end
 
+"""
+    getmember(obj::CppStruct, name::Symbol, ::Type{T}) -> T
+
+Type-stable read of a primitive (`Bool`, integer, floating point) or complex
+member. `obj.name` returns the same value, but its result type depends on the
+C++ member, so the value is boxed; `getmember` does not allocate and suits hot
+loops. Throws if the C++ member is not a `T`.
+
+# Example
+```julia
+total = 0.0
+for _ in 1:n
+    total += Glaze.getmember(obj, :value, Float64)
+end
+```
+"""
+function getmember(obj::CppStruct, name::Symbol, ::Type{T}) where {T}
+    info = getfield(obj, :info)
+    i = member_index(info, name)
+    i == 0 && error("Member $name not found")
+    member = unsafe_load(info.members, i)
+    member_holds(member, T) || error("Member $name is not a $T")
+    ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), getfield(obj, :ptr))
+    return unsafe_load(Ptr{T}(ptr))
+end
+
+# Whether a data member stores exactly the isbits type T
+function member_holds(member::MemberInfo, ::Type{T}) where {T}
+    (member.kind == UInt8(MEMBER_FUNCTION) || member.type == C_NULL) && return false
+    kind = descriptor_kind(member.type)
+    if T === ComplexF32 || T === ComplexF64
+        kind == GLZ_TYPE_COMPLEX || return false
+        complex_desc = unsafe_load(Ptr{ComplexDesc}(Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)))
+        return (complex_desc.kind == 0) == (T === ComplexF32)
+    end
+    return kind == GLZ_TYPE_PRIMITIVE && julia_type_to_primitive_kind(T) == primitive_kind(member.type)
+end
+
 function get_member_value(obj::CppStruct, member::MemberInfo)
     # Check if this is a member function
     if member.kind == UInt8(MEMBER_FUNCTION)
@@ -167,17 +251,17 @@ function get_member_value(obj::CppStruct, member::MemberInfo)
         return CppMemberFunction(obj.ptr, member_ptr, obj.lib, name, type_name)
     end
     
-    ptr = ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+    ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
     
     # Load type descriptor
     if member.type == C_NULL
         error("Member has no type descriptor")
     end
     
-    type_desc = unsafe_load(Ptr{ConcreteTypeDescriptor}(member.type))
+    kind = descriptor_kind(member.type)
     
     # Handle based on type descriptor kind
-    if type_desc.index == GLZ_TYPE_PRIMITIVE
+    if kind == GLZ_TYPE_PRIMITIVE
         # Extract just the first byte for PrimitiveDesc
         # Get PrimitiveDesc from the union data
         prim_desc = unsafe_load(Ptr{PrimitiveDesc}(Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)))
@@ -204,55 +288,61 @@ function get_member_value(obj::CppStruct, member::MemberInfo)
             return unsafe_load(Ptr{Float32}(ptr))
         elseif prim_desc.kind == 11  # F64
             return unsafe_load(Ptr{Float64}(ptr))
+        elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16  # F16
+            return unsafe_load(Ptr{Float16}(ptr))
+        elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16  # BF16
+            return unsafe_load(Ptr{BFloat16}(ptr))
         else
             error("Unknown primitive type: $(prim_desc.kind)")
         end
-    elseif type_desc.index == GLZ_TYPE_STRING
+    elseif kind == GLZ_TYPE_STRING
         return CppString(ptr, obj.lib)
-    elseif type_desc.index == GLZ_TYPE_COMPLEX
+    elseif kind == GLZ_TYPE_COMPLEX
         complex_desc = unsafe_load(Ptr{ComplexDesc}(Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)))
         if complex_desc.kind == 0  # float
             return unsafe_load(Ptr{ComplexF32}(ptr))
         else  # double
             return unsafe_load(Ptr{ComplexF64}(ptr))
         end
-    elseif type_desc.index == GLZ_TYPE_VECTOR
+    elseif kind == GLZ_TYPE_VECTOR
         # Check element type to return specialized vector if possible
-        td = unsafe_load(Ptr{ConcreteTypeDescriptor}(member.type))
         data_ptr = Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)
         element_ptr = unsafe_load(Ptr{Ptr{TypeDescriptor}}(data_ptr))
         
         # Get element type descriptor
-        elem_td = unsafe_load(Ptr{ConcreteTypeDescriptor}(element_ptr))
-        if elem_td.index == GLZ_TYPE_PRIMITIVE
+        elem_kind = descriptor_kind(element_ptr)
+        if elem_kind == GLZ_TYPE_PRIMITIVE
             prim_desc = unsafe_load(Ptr{PrimitiveDesc}(Ptr{UInt8}(element_ptr) + fieldoffset(ConcreteTypeDescriptor, 2)))
-            if prim_desc.kind == 10  # F32
+            if prim_desc.kind == 1  # Bool: std::vector<bool> is bit-packed
+                # Use the registration from glz_jl::register_bits_member when present
+                bits = registered_member(obj, member)
+                bits === nothing || return get_member_value(obj, bits)
+            elseif prim_desc.kind == 10  # F32
                 return CppVectorFloat32(ptr, obj.lib)
             elseif prim_desc.kind == 11  # F64
                 return CppVectorFloat64(ptr, obj.lib)
             elseif prim_desc.kind == 4  # I32
                 return CppVectorInt32(ptr, obj.lib)
             end
-        elseif elem_td.index == GLZ_TYPE_COMPLEX
+        elseif elem_kind == GLZ_TYPE_COMPLEX
             complex_desc = unsafe_load(Ptr{ComplexDesc}(Ptr{UInt8}(element_ptr) + fieldoffset(ConcreteTypeDescriptor, 2)))
             if complex_desc.kind == 0  # float complex
                 return CppVectorComplexF32(ptr, obj.lib)
             else  # double complex
                 return CppVectorComplexF64(ptr, obj.lib)
             end
+        elseif elem_kind == GLZ_TYPE_VECTOR
+            # Nested vectors registered with glz_jl::register_jagged_member
+            jagged = registered_member(obj, member)
+            jagged === nothing || return get_member_value(obj, jagged)
         end
         
         # Fall back to generic vector
         return CppVector(ptr, obj.lib, member.type)
-    elseif type_desc.index == GLZ_TYPE_STRUCT
+    elseif kind == GLZ_TYPE_STRUCT
         # Handle nested struct - the data field contains the struct descriptor
         # Use unsafe_load to reinterpret the bytes
-        GC.@preserve type_desc begin
-            # Get pointer to the data field within the type descriptor
-            data_ptr = Ptr{UInt8}(pointer_from_objref(type_desc)) + fieldoffset(ConcreteTypeDescriptor, 2)
-            struct_desc_ptr = Ptr{StructDesc}(data_ptr)
-            struct_desc = unsafe_load(struct_desc_ptr)
-        end
+        struct_desc = unsafe_load(Ptr{StructDesc}(Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)))
         
         
         # If info is null, we need to find the type dynamically
@@ -260,7 +350,7 @@ function get_member_value(obj::CppStruct, member::MemberInfo)
             # Use type hash to resolve the type
             if struct_desc.type_hash != 0
                 get_type_info_by_hash_func = get_cached_function(obj.lib, :glz_get_type_info_by_hash)
-                info_ptr = ccall(get_type_info_by_hash_func, Ptr{ConcreteTypeInfo}, (UInt64,), struct_desc.type_hash)
+                info_ptr = @ffi ccall(get_type_info_by_hash_func, Ptr{ConcreteTypeInfo}, (UInt64,), struct_desc.type_hash)
                 if info_ptr == C_NULL
                     error("Could not resolve nested struct type with hash $(struct_desc.type_hash)")
                 end
@@ -273,25 +363,52 @@ function get_member_value(obj::CppStruct, member::MemberInfo)
         end
         
         return CppStruct(ptr, info, obj.lib, false)  # Not owned by Julia
-    elseif type_desc.index == GLZ_TYPE_OPTIONAL
+    elseif kind == GLZ_TYPE_OPTIONAL
         # Handle optional type - extract the element type from OptionalDesc
-        GC.@preserve type_desc begin
-            # Get pointer to the data field within the type descriptor
-            data_ptr = Ptr{UInt8}(pointer_from_objref(type_desc)) + fieldoffset(ConcreteTypeDescriptor, 2)
-            optional_desc_ptr = Ptr{OptionalDesc}(data_ptr)
-            optional_desc = unsafe_load(optional_desc_ptr)
-        end
+        optional_desc = unsafe_load(Ptr{OptionalDesc}(Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)))
         
         # Create optional wrapper with element type information
         return create_optional_wrapper(ptr, obj.lib, optional_desc.element_type)
-    elseif type_desc.index == GLZ_TYPE_VARIANT
+    elseif kind == GLZ_TYPE_VARIANT
         # Handle variant type - return variant wrapper
         return CppVariant(ptr, obj.lib, member.type)
-    elseif type_desc.index == GLZ_TYPE_FUNCTION
+    elseif kind == GLZ_JL_TYPE_POINTER
+        # Pointer member: non-owned view of the pointee's dynamic type, or nothing
+        return pointer_member_value(ptr, member.type, obj.lib)
+    elseif kind == GLZ_JL_TYPE_POINTER_VECTOR
+        return CppPointerVector(ptr, obj.lib, member.type)
+    elseif kind == GLZ_JL_TYPE_FIXED_ARRAY
+        # std::array member: NTuple for small arrays, zero-copy view otherwise
+        return fixed_array_value(ptr, member.type, obj)
+    elseif kind == GLZ_JL_TYPE_MDSPAN
+        # std::mdspan member or method result: zero-copy view of the mapped data
+        return mdspan_value(ptr, member.type, obj)
+    elseif kind == GLZ_JL_TYPE_JAGGED
+        return jagged_value(ptr, member.type, obj)
+    elseif kind == GLZ_JL_TYPE_BITS
+        return bits_value(ptr, member.type, obj)
+    elseif kind == GLZ_JL_TYPE_ENUM
+        return enum_value(ptr, member.type)
+    elseif kind == GLZ_JL_TYPE_TUPLE
+        return tuple_value(ptr, member.type)
+    elseif kind == GLZ_JL_TYPE_CHRONO
+        return chrono_value(ptr, member.type, obj)
+    elseif kind == GLZ_JL_TYPE_RANGE
+        return range_value(ptr, member.type, obj.lib, obj)
+    elseif kind == GLZ_JL_TYPE_GENERATOR
+        # Generator member function: calling it starts the coroutine
+        return generator_method(ptr, member.type, obj.lib, unsafe_string(member.name), obj)
+    elseif kind == GLZ_JL_TYPE_CANCELLABLE
+        # Member function taking a std::stop_token
+        return cancellable_method(ptr, member.type, obj.lib, unsafe_string(member.name), obj)
+    elseif kind == GLZ_JL_TYPE_GENERIC
+        # glz::generic member: lazy view of objects and arrays, scalars by value
+        return generic_value(ptr, member.type, obj)
+    elseif kind == GLZ_TYPE_FUNCTION
         # This should not happen in get_member_value as we handle functions above
         error("Unexpected function type descriptor in data member access")
     else
-        error("Unknown type kind: $(type_desc.index)")
+        error("Unknown type kind: $(kind)")
     end
 end
 
@@ -306,78 +423,107 @@ function set_member_value(obj::CppStruct, member::MemberInfo, value)
         error("Member has no type descriptor")
     end
     
-    type_desc = unsafe_load(Ptr{ConcreteTypeDescriptor}(member.type))
+    kind = descriptor_kind(member.type)
     
     # Handle based on type descriptor kind
-    if type_desc.index == GLZ_TYPE_PRIMITIVE
+    if kind == GLZ_TYPE_PRIMITIVE
         # Extract just the first byte for PrimitiveDesc
         # Get PrimitiveDesc from the union data
         prim_desc = unsafe_load(Ptr{PrimitiveDesc}(Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)))
         # Handle primitive types
         if prim_desc.kind == 1  # Bool
-            val = Bool(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, Bool(value))
         elseif prim_desc.kind == 2  # I8
-            val = Int8(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, Int8(value))
         elseif prim_desc.kind == 3  # I16
-            val = Int16(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, Int16(value))
         elseif prim_desc.kind == 4  # I32
-            val = Int32(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, Int32(value))
         elseif prim_desc.kind == 5  # I64
-            val = Int64(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, Int64(value))
         elseif prim_desc.kind == 6  # U8
-            val = UInt8(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, UInt8(value))
         elseif prim_desc.kind == 7  # U16
-            val = UInt16(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, UInt16(value))
         elseif prim_desc.kind == 8  # U32
-            val = UInt32(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, UInt32(value))
         elseif prim_desc.kind == 9  # U64
-            val = UInt64(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, UInt64(value))
         elseif prim_desc.kind == 10  # F32
-            val = Float32(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, Float32(value))
         elseif prim_desc.kind == 11  # F64
-            val = Float64(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, Float64(value))
+        elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16  # F16
+            store_member!(member, obj, Float16(value))
+        elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16  # BF16
+            store_member!(member, obj, BFloat16(value))
         else
             error("Unknown primitive type: $(prim_desc.kind)")
         end
-    elseif type_desc.index == GLZ_TYPE_STRING
+    elseif kind == GLZ_TYPE_STRING
         # For strings, we need to call the C++ string assignment
         if isa(value, AbstractString)
             set_string_func = get_cached_function(obj.lib, :glz_string_set)
-            ptr = ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
-            ccall(set_string_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
+            ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+            @ffi ccall(set_string_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
                   ptr, value, sizeof(value))
         else
             error("Value must be a string")
         end
-    elseif type_desc.index == GLZ_TYPE_COMPLEX
+    elseif kind == GLZ_TYPE_COMPLEX
         complex_desc = unsafe_load(Ptr{ComplexDesc}(Ptr{UInt8}(member.type) + fieldoffset(ConcreteTypeDescriptor, 2)))
         if complex_desc.kind == 0  # float
-            val = ComplexF32(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, ComplexF32(value))
         else  # double
-            val = ComplexF64(value)
-            ccall(member.setter, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), obj.ptr, Ref(val))
+            store_member!(member, obj, ComplexF64(value))
         end
-    elseif type_desc.index == GLZ_TYPE_OPTIONAL
+    elseif kind == GLZ_TYPE_OPTIONAL
         # Handle optional type setting
         # For now, we'll implement basic support but note that this needs C++ interface functions
         error("Setting optional values is not yet implemented - requires C++ interface functions")
-    elseif type_desc.index == GLZ_TYPE_VARIANT
+    elseif kind == GLZ_TYPE_VARIANT
         # Handle variant type setting
         error("Setting variant values directly is not yet implemented - use variant methods instead")
+    elseif kind == GLZ_TYPE_VECTOR
+        # Nested or bool vectors registered with glz_jl::register_jagged_member/register_bits_member
+        registered = registered_member(obj, member)
+        registered === nothing && error("Setting type kind $(kind) not yet implemented")
+        set_member_value(obj, registered, value)
+    elseif kind == GLZ_JL_TYPE_JAGGED
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        set_jagged!(ptr, member.type, value)
+    elseif kind == GLZ_JL_TYPE_BITS
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        assign_bits!(bits_value(ptr, member.type, nothing), value)
+    elseif kind == GLZ_JL_TYPE_ENUM
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        set_enum!(ptr, member.type, value)
+    elseif kind == GLZ_JL_TYPE_TUPLE
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        set_tuple!(ptr, member.type, value)
+    elseif kind == GLZ_JL_TYPE_CHRONO
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        set_chrono!(ptr, member.type, value)
+    elseif kind == GLZ_JL_TYPE_RANGE
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        assign_range!(range_value(ptr, member.type, obj.lib, nothing), value)
+    elseif kind == GLZ_JL_TYPE_GENERATOR
+        error("Generator method '$(unsafe_string(member.name))' cannot be assigned from Julia")
+    elseif kind == GLZ_JL_TYPE_CANCELLABLE
+        error("Cancellable method '$(unsafe_string(member.name))' cannot be assigned from Julia")
+    elseif kind == GLZ_JL_TYPE_GENERIC
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        set_generic!(ptr, member.type, value)
+    elseif kind == GLZ_JL_TYPE_FIXED_ARRAY
+        # std::array members are written in place through the member address
+        ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj.ptr)
+        set_fixed_array!(ptr, member.type, value)
+    elseif kind == GLZ_JL_TYPE_POINTER || kind == GLZ_JL_TYPE_POINTER_VECTOR
+        error("Pointer member '$(unsafe_string(member.name))' cannot be assigned from Julia; modify the pointee instead")
+    elseif kind == GLZ_JL_TYPE_MDSPAN
+        error("mdspan member '$(unsafe_string(member.name))' cannot be assigned from Julia; write through its view instead")
     else
-        error("Setting type kind $(type_desc.index) not yet implemented")
+        error("Setting type kind $(kind) not yet implemented")
     end
 end
 
@@ -0,0 +1,51 @@
+# std::mdspan members
+#
+# std::mdspan members, and const methods returning one, are registered in C++
+# with glz_jl::register_mdspan_member / register_mdspan_method (see
+# cpp_interface/glaze_jl/mdspan.hpp) as extension members using the
+# GLZ_JL_TYPE_MDSPAN kind.
+
+const GLZ_JL_TYPE_MDSPAN = UInt64(67)
+
+# Matches glz_jl_mdspan_desc (payload after the descriptor kind)
+struct MdspanDesc
+    element_kind::UInt8
+    rank::UInt8
+    padding::NTuple{6, UInt8}
+    extract::Ptr{Cvoid}
+    reserved::NTuple{2, Ptr{Cvoid}}
+end
+
+# Matches glz_jl_mdspan_view
+struct MdspanView
+    data::Ptr{Cvoid}
+    rank::UInt64
+    extents::NTuple{8, Int64}
+    strides::NTuple{8, Int64}
+end
+
+@inline mdspan_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{MdspanDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+# Zero-copy view of the mdspan at `ptr`, indexed with the mdspan's own index order
+function mdspan_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, parent)
+    desc = mdspan_desc(type_desc)
+    out = Ref{MdspanView}()
+    @ffi ccall(desc.extract, Cvoid, (Ptr{Cvoid}, Ptr{MdspanView}), ptr, out)
+    view = out[]
+
+    T = pointee_element_type(desc.element_kind)
+    N = Int(view.rank)
+    dims = ntuple(i -> Int(view.extents[i]), N)
+    strides = ntuple(i -> Int(view.strides[i]), N)
+    data = Ptr{T}(view.data)
+
+    if strides == Base.size_to_strides(1, dims...)
+        # std::layout_left
+        return CppArrayView{T,N}(data, dims, parent)
+    elseif strides == reverse(Base.size_to_strides(1, reverse(dims)...))
+        # std::layout_right
+        return row_major_view(data, dims, parent)
+    end
+    return CppStridedView{T,N}(data, dims, strides, parent)
+end
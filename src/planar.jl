@@ -0,0 +1,112 @@
+# Split real/imaginary access to complex vectors
+#
+# real_view/imag_view are zero-copy strided views of the interleaved storage.
+# to_planar/from_planar! convert whole buffers in one call to the vectorized
+# kernels in cpp_interface/glaze_jl/planar.hpp, falling back to a Julia loop
+# when the library does not export them.
+
+const ComplexVector = Union{CppVectorComplexF32, CppVectorComplexF64}
+
+planar_symbol(::Type{Float32}, direction::Symbol) = Symbol(:glz_jl_complexf32_, direction, :_planar)
+planar_symbol(::Type{Float64}, direction::Symbol) = Symbol(:glz_jl_complexf64_, direction, :_planar)
+
+# Kernel pointer per (library, symbol), C_NULL when not exported
+const _planar_kernels = SnapshotDict{Tuple{Ptr{Cvoid}, Symbol}, Ptr{Cvoid}}()
+
+function planar_kernel(lib::Ptr{Cvoid}, sym::Symbol)
+    get!(_planar_kernels, (lib, sym)) do
+        kernel = something(Libdl.dlsym(lib, sym; throw_error=false), C_NULL)
+        kernel == C_NULL ? kernel : register_entry_name!(kernel, sym)
+    end
+end
+
+complex_view(v::ComplexVector) = array_view(v)
+complex_view(A::CppArrayView{<:Complex}) = A
+
+"""
+    real_view(v)
+
+Zero-copy view of the real parts of a complex Glaze vector (or a
+complex `CppArrayView`), strided over the interleaved C++ storage. Writes go to
+the C++ vector, and the views can be passed to BLAS as stride-2 vectors.
+"""
+function real_view(v)
+    A = complex_view(v)
+    R = real(eltype(A))
+    return view(reinterpret(R, A), 1:2:2 * length(A))
+end
+
+"""
+    imag_view(v)
+
+Zero-copy view of the imaginary parts of a complex Glaze vector; see [`real_view`](@ref).
+"""
+function imag_view(v)
+    A = complex_view(v)
+    R = real(eltype(A))
+    return view(reinterpret(R, A), 2:2:2 * length(A))
+end
+
+"""
+    to_planar!(re, im, v)
+
+Copy the real and imaginary parts of the complex Glaze vector `v` into the
+preallocated buffers `re` and `im` in one call into C++.
+"""
+function to_planar!(re::Vector{R}, im::Vector{R}, v::ComplexVector) where R
+    A = array_view(v)
+    real(eltype(A)) === R || throw(ArgumentError("buffers must have element type $(real(eltype(A)))"))
+    n = length(A)
+    length(re) == n && length(im) == n ||
+        throw(DimensionMismatch("buffers of length $(length(re)) and $(length(im)) for $n elements"))
+    kernel = planar_kernel(v.lib, planar_symbol(R, :to))
+    if kernel != C_NULL
+        GC.@preserve v @ffi ccall(kernel, Cvoid, (Ptr{Cvoid}, Csize_t, Ptr{R}, Ptr{R}), pointer(A), n, re, im)
+    else
+        @inbounds @simd for i in 1:n
+            re[i] = real(A[i])
+            im[i] = imag(A[i])
+        end
+    end
+    return re, im
+end
+
+"""
+    to_planar(v) -> (re, im)
+
+Split the complex Glaze vector `v` into new real and imaginary buffers.
+"""
+function to_planar(v::ComplexVector)
+    R = real(eltype(v))
+    n = length(v)
+    return to_planar!(Vector{R}(undef, n), Vector{R}(undef, n), v)
+end
+
+"""
+    from_planar!(v, re, im)
+
+Resize the complex Glaze vector `v` to `length(re)` and fill it from the planar
+buffers `re` and `im` in one call into C++.
+"""
+function from_planar!(v::ComplexVector, re::AbstractVector{<:Real}, im::AbstractVector{<:Real})
+    length(re) == length(im) ||
+        throw(DimensionMismatch("real and imaginary parts have lengths $(length(re)) and $(length(im))"))
+    R = real(eltype(v))
+    re_buf = convert(Vector{R}, re)
+    im_buf = convert(Vector{R}, im)
+    n = length(re_buf)
+    resize!(v, n)
+    A = array_view(v)
+    kernel = planar_kernel(v.lib, planar_symbol(R, :from))
+    if kernel != C_NULL
+        GC.@preserve v @ffi ccall(kernel, Cvoid, (Ptr{Cvoid}, Csize_t, Ptr{R}, Ptr{R}), pointer(A), n, re_buf, im_buf)
+    else
+        @inbounds @simd for i in 1:n
+            A[i] = complex(re_buf[i], im_buf[i])
+        end
+    end
+    note_container_write(v.ptr, 1:n)
+    return v
+end
+
+export real_view, imag_view, to_planar, to_planar!, from_planar!
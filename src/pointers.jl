@@ -0,0 +1,350 @@
+# Pointer members and dynamic type resolution
+#
+# Pointer members (T*, std::unique_ptr<T>, std::shared_ptr<T> and vectors of them)
+# are registered in C++ with glz_jl::register_pointer_member (see
+# cpp_interface/glaze_jl/pointers.hpp) as extension members of their owner type.
+# Their descriptors use the GLZ_JL_TYPE_POINTER / GLZ_JL_TYPE_POINTER_VECTOR kinds.
+
+const GLZ_JL_TYPE_POINTER = UInt64(64)
+const GLZ_JL_TYPE_POINTER_VECTOR = UInt64(65)
+
+# Pointee kinds (PointerDesc.pointee_kind)
+const POINTEE_STRUCT = 0x00
+const POINTEE_STRING = 0x01
+const POINTEE_VECTOR = 0x02
+const POINTEE_PRIMITIVE = 0x03
+
+# Dynamic type resolution strategies (PointerDesc.resolution)
+const POINTER_STATIC = 0x00
+const POINTER_RTTI = 0x01
+const POINTER_DISCRIMINATOR = 0x02
+
+# Matches glz_jl_pointer_desc (payload after the descriptor kind)
+struct PointerDesc
+    pointer_kind::UInt8   # 0 raw, 1 unique_ptr, 2 shared_ptr
+    resolution::UInt8
+    pointee_kind::UInt8
+    element_kind::UInt8   # primitive kind of the pointee or of its elements (32/33 complex)
+    padding::NTuple{4, UInt8}
+    pointee_type::Ptr{UInt8}
+    deref::Ptr{Cvoid}
+    resolve::Ptr{Cvoid}
+end
+
+# Matches glz_jl_pointer_vector_desc (payload after the descriptor kind)
+struct PointerVectorDesc
+    element::Ptr{TypeDescriptor}
+    size::Ptr{Cvoid}
+    element_at::Ptr{Cvoid}
+    collect::Ptr{Cvoid}
+end
+
+# Matches glz_jl_dynamic_type
+struct DynamicType
+    type_name::Ptr{UInt8}
+    offset::Int64
+    cache_key::Ptr{Cvoid}
+end
+
+# A resolved dynamic type: the derived type and the base-to-derived address offset
+struct ResolvedType
+    info::ConcreteTypeInfo
+    offset::Int
+end
+
+# Extension members of one owner type as of a registration count
+struct ExtensionMembers
+    generation::UInt64
+    members::Vector{MemberInfo}
+end
+
+# A vtable and its resolution. Never mutated after construction, so one atomic
+# reference publishes both together.
+mutable struct ResolveEntry
+    key::Ptr{Cvoid}
+    resolved::ResolvedType
+end
+
+# Last resolution seen through one descriptor; walks over homogeneous runs of
+# elements hit this without touching the shared caches. Read from any thread.
+mutable struct ResolveCache
+    @atomic entry::Union{Nothing, ResolveEntry}
+    ResolveCache() = new(nothing)
+end
+
+# Read on every pointer dereference, from any thread: lookups take no lock
+# vtable pointer -> resolved dynamic type (RTTI resolution)
+const _vtable_cache = SnapshotDict{Ptr{Cvoid}, ResolveEntry}()
+# (library, registered type name pointer) -> type info
+const _pointee_infos = SnapshotDict{Tuple{Ptr{Cvoid}, Ptr{UInt8}}, ConcreteTypeInfo}()
+# (library, owner type name pointer) -> extension members
+const _extension_members = SnapshotDict{Tuple{Ptr{Cvoid}, Ptr{UInt8}}, ExtensionMembers}()
+# library -> address of its registration counter (C_NULL when not exported)
+const _extension_generations = SnapshotDict{Ptr{Cvoid}, Ptr{UInt64}}()
+# (library, owner type name pointer, regular member name pointer) -> extension
+# member registered under that name
+const _registered_members = SnapshotDict{Tuple{Ptr{Cvoid}, Ptr{UInt8}, Ptr{UInt8}}, MemberInfo}()
+# pointer descriptor -> last-seen resolution
+const _resolve_caches = SnapshotDict{Ptr{TypeDescriptor}, ResolveCache}()
+
+@inline pointer_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{PointerDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+@inline pointer_vector_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{PointerVectorDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+extension_generation(lib::Ptr{Cvoid}) = get!(_extension_generations, lib) do
+    func = Libdl.dlsym(lib, :glz_jl_extension_generation; throw_error=false)
+    func === nothing ? Ptr{UInt64}(C_NULL) : @ffi ccall(func, Ptr{UInt64}, ())
+end
+
+# Extension members registered for the type of `info`. The list is reloaded
+# when the library registers more members; registrations only append, so
+# positions in the list are stable.
+function extension_members(lib::Ptr{Cvoid}, info::ConcreteTypeInfo)
+    counter = extension_generation(lib)
+    # A stale read only delays the reload to the next lookup
+    generation = counter == C_NULL ? UInt64(0) : unsafe_load(counter)
+    key = (lib, info.name)
+    cached = get(_extension_members, key, nothing)
+    cached !== nothing && cached.generation == generation && return cached.members
+    return load_extension_members!(key, generation)
+end
+
+@noinline function load_extension_members!(key::Tuple{Ptr{Cvoid}, Ptr{UInt8}}, generation::UInt64)
+    lib, type_name = key
+    func = Libdl.dlsym(lib, :glz_jl_extension_members; throw_error=false)
+    members = if func === nothing
+        MemberInfo[]
+    else
+        out = Ref{Ptr{MemberInfo}}(C_NULL)
+        n = @ffi ccall(func, Csize_t, (Ptr{UInt8}, Ptr{Ptr{MemberInfo}}), type_name, out)
+        n == 0 ? MemberInfo[] : copy(unsafe_wrap(Array, out[], n))
+    end
+    _extension_members[key] = ExtensionMembers(generation, members)
+    return members
+end
+
+function find_extension_member(lib::Ptr{Cvoid}, info::ConcreteTypeInfo, name::Union{Symbol, Ptr{UInt8}})
+    for member in extension_members(lib, info)
+        if ccall(:strcmp, Cint, (Ptr{UInt8}, Ptr{UInt8}), member.name, name) == 0
+            return member
+        end
+    end
+    return nothing
+end
+
+find_extension_member(obj::CppStruct, name::Symbol) =
+    find_extension_member(getfield(obj, :lib), getfield(obj, :info), name)
+
+# Extension member registered under the name of the regular member `member`
+# (vector<bool> and nested vectors, which the interop descriptors report as
+# plain vectors). Resolved once per member.
+@inline function registered_member(obj::CppStruct, member::MemberInfo)
+    lib = getfield(obj, :lib)
+    info = getfield(obj, :info)
+    registered = get(_registered_members, (lib, info.name, member.name), nothing)
+    registered === nothing || return registered
+    return resolve_registered_member!(lib, info, member)
+end
+
+@noinline function resolve_registered_member!(lib::Ptr{Cvoid}, info::ConcreteTypeInfo, member::MemberInfo)
+    registered = find_extension_member(lib, info, member.name)
+    registered === nothing && return nothing
+    _registered_members[(lib, info.name, member.name)] = registered
+    return registered
+end
+
+# Type info for a registered type name owned by C++ (the pointer identifies the name)
+function pointee_info(lib::Ptr{Cvoid}, type_name::Ptr{UInt8})
+    get!(_pointee_infos, (lib, type_name)) do
+        info_func = get_cached_function(lib, :glz_get_type_info)
+        info_ptr = @ffi ccall(info_func, Ptr{ConcreteTypeInfo}, (Ptr{UInt8},), type_name)
+        info_ptr == C_NULL && error("Type '$(unsafe_string(type_name))' is not registered")
+        unsafe_load(info_ptr)
+    end
+end
+
+resolve_cache(type_desc::Ptr{TypeDescriptor}) = get!(ResolveCache, _resolve_caches, type_desc)
+
+# Determine the dynamic type of `pointee` (non-null) declared through `desc`
+function resolve_dynamic_type(lib::Ptr{Cvoid}, desc::PointerDesc, pointee::Ptr{Cvoid}, cache::ResolveCache)
+    if desc.resolution == POINTER_RTTI
+        vtable = unsafe_load(Ptr{Ptr{Cvoid}}(pointee))
+        last = @atomic :acquire cache.entry
+        last !== nothing && last.key == vtable && return last.resolved
+        entry = get(_vtable_cache, vtable, nothing)
+        if entry !== nothing
+            @atomic :release cache.entry = entry
+            return entry.resolved
+        end
+    end
+
+    if desc.resolution != POINTER_STATIC
+        out = Ref{DynamicType}()
+        if @ffi ccall(desc.resolve, Cint, (Ptr{Cvoid}, Ptr{DynamicType}), pointee, out) != 0
+            dynamic = out[]
+            resolved = ResolvedType(pointee_info(lib, dynamic.type_name), Int(dynamic.offset))
+            if dynamic.cache_key != C_NULL
+                entry = get!(() -> ResolveEntry(dynamic.cache_key, resolved), _vtable_cache, dynamic.cache_key)
+                @atomic :release cache.entry = entry
+            end
+            return resolved
+        end
+    end
+
+    # Not resolved: use the declared pointee type
+    return ResolvedType(pointee_info(lib, desc.pointee_type), 0)
+end
+
+# Element kinds from the glaze_jl helpers: primitive kinds, or 32/33 for std::complex
+pointee_element_type(kind::UInt8) =
+    kind == 0x20 ? ComplexF32 : kind == 0x21 ? ComplexF64 : primitive_kind_to_julia_type(UInt64(kind))
+
+# Zero-copy view of a std::vector pointee
+function pointee_vector(lib::Ptr{Cvoid}, desc::PointerDesc, pointee::Ptr{Cvoid})
+    T = pointee_element_type(desc.element_kind)
+    T === Float32 && return CppVectorFloat32(pointee, lib)
+    T === Float64 && return CppVectorFloat64(pointee, lib)
+    T === Int32 && return CppVectorInt32(pointee, lib)
+    T === ComplexF32 && return CppVectorComplexF32(pointee, lib)
+    T === ComplexF64 && return CppVectorComplexF64(pointee, lib)
+    # Libraries built before std::vector<bool> pointees were rejected: the bits are packed
+    T === Bool && error("std::vector<bool> pointees are not supported")
+    return CppVector(pointee, lib, create_vector_descriptor(create_primitive_descriptor(T)))
+end
+
+# Wrapper for a non-null pointee: non-owned CppStruct of its dynamic type,
+# CppString or vector view, or the value itself for arithmetic pointees
+function wrap_pointee(lib::Ptr{Cvoid}, desc::PointerDesc, pointee::Ptr{Cvoid}, cache::ResolveCache)
+    if desc.pointee_kind == POINTEE_STRUCT
+        resolved = resolve_dynamic_type(lib, desc, pointee, cache)
+        return CppStruct(pointee + resolved.offset, resolved.info, lib, false)
+    elseif desc.pointee_kind == POINTEE_STRING
+        return CppString(pointee, lib)
+    elseif desc.pointee_kind == POINTEE_VECTOR
+        return pointee_vector(lib, desc, pointee)
+    else
+        return unsafe_load(Ptr{pointee_element_type(desc.element_kind)}(pointee))
+    end
+end
+
+# Wrapper for the object `pointer_object` points to, or nothing when null
+function pointee_value(lib::Ptr{Cvoid}, desc::PointerDesc, pointer_object::Ptr{Cvoid}, cache::ResolveCache)
+    pointee = @ffi ccall(desc.deref, Ptr{Cvoid}, (Ptr{Cvoid},), pointer_object)
+    pointee == C_NULL && return nothing
+    return wrap_pointee(lib, desc, pointee, cache)
+end
+
+function pointer_member_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, lib::Ptr{Cvoid})
+    return pointee_value(lib, pointer_desc(type_desc), ptr, resolve_cache(type_desc))
+end
+
+const POINTER_KIND_SYMBOLS = (:raw, :unique, :shared)
+
+"""
+    pointer_kind(obj::CppStruct, name::Symbol) -> Symbol
+
+Ownership of the pointer member `name` of `obj`: `:raw` (`T*`), `:unique`
+(`std::unique_ptr<T>`) or `:shared` (`std::shared_ptr<T>`). For vectors of
+pointers this is the kind of the elements.
+"""
+function pointer_kind(obj::CppStruct, name::Symbol)
+    member = find_extension_member(obj, name)
+    member === nothing && error("Pointer member '$name' not found")
+    type_desc = Ptr{TypeDescriptor}(member.type)
+    index = unsafe_load(Ptr{UInt64}(type_desc))
+    if index == GLZ_JL_TYPE_POINTER_VECTOR
+        type_desc = pointer_vector_desc(type_desc).element
+    elseif index != GLZ_JL_TYPE_POINTER
+        error("Member '$name' is not a pointer member")
+    end
+    return POINTER_KIND_SYMBOLS[pointer_desc(type_desc).pointer_kind + 1]
+end
+
+"""
+    CppPointerVector
+
+Julia wrapper for a `std::vector` of pointers (`T*`, `std::unique_ptr<T>` or
+`std::shared_ptr<T>`). Indexing returns a non-owned `CppStruct` of the pointee's
+dynamic type (or a string/vector view or value for non-struct pointees), or
+`nothing` for null elements. Iteration and [`collect_pointees`](@ref) fetch all
+pointee addresses in a single call into C++.
+"""
+mutable struct CppPointerVector
+    ptr::Ptr{Cvoid}
+    lib::Ptr{Cvoid}
+    type_desc::Ptr{TypeDescriptor}
+    cache::ResolveCache
+end
+
+CppPointerVector(ptr::Ptr{Cvoid}, lib::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}) =
+    CppPointerVector(ptr, lib, type_desc, ResolveCache())
+
+function Base.length(v::CppPointerVector)
+    desc = pointer_vector_desc(v.type_desc)
+    return Int(@ffi ccall(desc.size, Csize_t, (Ptr{Cvoid},), v.ptr))
+end
+
+Base.size(v::CppPointerVector) = (length(v),)
+Base.firstindex(::CppPointerVector) = 1
+Base.lastindex(v::CppPointerVector) = length(v)
+
+function Base.getindex(v::CppPointerVector, i::Integer)
+    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
+    desc = pointer_vector_desc(v.type_desc)
+    element = @ffi ccall(desc.element_at, Ptr{Cvoid}, (Ptr{Cvoid}, Csize_t), v.ptr, i - 1)
+    return pointee_value(v.lib, pointer_desc(desc.element), element, v.cache)
+end
+
+"""
+    pointee_addresses(v::CppPointerVector) -> Vector{Ptr{Cvoid}}
+
+Addresses of all pointees of `v` (`C_NULL` for null elements), fetched in one
+call into C++.
+"""
+function pointee_addresses(v::CppPointerVector)
+    desc = pointer_vector_desc(v.type_desc)
+    out = Vector{Ptr{Cvoid}}(undef, length(v))
+    n = @ffi ccall(desc.collect, Csize_t, (Ptr{Cvoid}, Ptr{Ptr{Cvoid}}, Csize_t), v.ptr, out, length(out))
+    return resize!(out, Int(n))
+end
+
+"""
+    collect_pointees(v::CppPointerVector) -> Vector
+
+Wrappers for all pointees of `v` (`nothing` for null elements), gathered with a
+single call into C++ instead of one dereference per element. Dynamic types are
+resolved through the per-vtable cache.
+"""
+function collect_pointees(v::CppPointerVector)
+    desc = pointer_desc(pointer_vector_desc(v.type_desc).element)
+    return [p == C_NULL ? nothing : wrap_pointee(v.lib, desc, p, v.cache) for p in pointee_addresses(v)]
+end
+
+Base.collect(v::CppPointerVector) = collect_pointees(v)
+
+function Base.iterate(v::CppPointerVector)
+    addresses = pointee_addresses(v)
+    return iterate(v, (addresses, 1))
+end
+
+function Base.iterate(v::CppPointerVector, state::Tuple{Vector{Ptr{Cvoid}}, Int})
+    addresses, i = state
+    i > length(addresses) && return nothing
+    p = addresses[i]
+    desc = pointer_desc(pointer_vector_desc(v.type_desc).element)
+    value = p == C_NULL ? nothing : wrap_pointee(v.lib, desc, p, v.cache)
+    return (value, (addresses, i + 1))
+end
+
+function Base.show(io::IO, v::CppPointerVector)
+    desc = pointer_desc(pointer_vector_desc(v.type_desc).element)
+    pointee = desc.pointee_kind == POINTEE_STRUCT ? unsafe_string(desc.pointee_type) :
+              desc.pointee_kind == POINTEE_STRING ? "String" :
+              desc.pointee_kind == POINTEE_VECTOR ? "Vector{$(pointee_element_type(desc.element_kind))}" :
+              string(pointee_element_type(desc.element_kind))
+    print(io, "CppPointerVector{", pointee, "}(length=", length(v), ")")
+end
+
+export CppPointerVector, collect_pointees, pointer_kind
@@ -0,0 +1,191 @@
+# Non-contiguous range members
+#
+# std::deque, std::list, std::set and std::unordered_set members are registered
+# in C++ with glz_jl::register_range_member (see cpp_interface/glaze_jl/ranges.hpp)
+# as extension members using the GLZ_JL_TYPE_RANGE kind. Iteration pulls
+# elements through a C++ cursor one chunk at a time; `in` runs in C++.
+
+const GLZ_JL_TYPE_RANGE = UInt64(73)
+
+const RANGE_VALUES = 0x00
+const RANGE_STRINGS = 0x01
+const RANGE_STRUCTS = 0x02
+
+# Elements fetched per cursor call
+const RANGE_CHUNK = 256
+
+# Matches glz_jl_range_ops
+struct RangeOps
+    size::Ptr{Cvoid}
+    open::Ptr{Cvoid}
+    next::Ptr{Cvoid}
+    close::Ptr{Cvoid}
+    contains::Ptr{Cvoid}
+    insert::Ptr{Cvoid}
+    erase::Ptr{Cvoid}
+    clear::Ptr{Cvoid}
+end
+
+# Matches glz_jl_range_desc (payload after the descriptor kind)
+struct RangeDesc
+    element_class::UInt8
+    element_kind::UInt8
+    is_set::UInt8
+    padding::NTuple{5, UInt8}
+    ops::Ptr{RangeOps}
+    element_type::Ptr{UInt8}
+    reserved::Ptr{Cvoid}
+end
+
+# Matches glz_jl_string_ref
+struct StringRef
+    data::Ptr{UInt8}
+    size::Csize_t
+end
+
+@inline range_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{RangeDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+"""
+    CppRange{T}
+
+Wrapper for a non-contiguous C++ range member (`std::deque`, `std::list`,
+`std::set`, `std::unordered_set`) registered with `glz_jl::register_range_member`.
+Iterating fetches elements from C++ in chunks of $(RANGE_CHUNK); arithmetic
+elements are copied, strings and structs are non-owned views. `x in r` runs in
+C++ with the container's own lookup. `push!`, `delete!` and `empty!` modify the
+C++ container.
+"""
+struct CppRange{T}
+    ptr::Ptr{Cvoid}
+    lib::Ptr{Cvoid}
+    desc::RangeDesc
+    ops::RangeOps
+    info::Union{Nothing, ConcreteTypeInfo}   # element type info for struct elements
+    parent::Any
+end
+
+range_element_type(desc::RangeDesc) =
+    desc.element_class == RANGE_VALUES ? pointee_element_type(desc.element_kind) :
+    desc.element_class == RANGE_STRINGS ? CppString : CppStruct
+
+function range_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, lib::Ptr{Cvoid}, parent)
+    desc = range_desc(type_desc)
+    info = desc.element_class == RANGE_STRUCTS ? pointee_info(lib, desc.element_type) : nothing
+    return CppRange{range_element_type(desc)}(ptr, lib, desc, unsafe_load(desc.ops), info, parent)
+end
+
+Base.length(r::CppRange) = Int(@ffi ccall(r.ops.size, Csize_t, (Ptr{Cvoid},), r.ptr))
+Base.eltype(::Type{CppRange{T}}) where {T} = T
+Base.IteratorSize(::Type{<:CppRange}) = Base.HasLength()
+Base.isempty(r::CppRange) = length(r) == 0
+
+# C++ cursor, closed when exhausted or collected
+mutable struct RangeCursor{B}
+    handle::Ptr{Cvoid}
+    ops::RangeOps
+    buffer::Vector{B}
+    count::Int
+    index::Int
+
+    function RangeCursor{B}(r::CppRange) where {B}
+        c = new{B}(@ffi(ccall(r.ops.open, Ptr{Cvoid}, (Ptr{Cvoid},), r.ptr)), r.ops, Vector{B}(undef, RANGE_CHUNK), 0, 0)
+        finalizer(close_cursor!, c)
+        return c
+    end
+end
+
+function close_cursor!(c::RangeCursor)
+    if c.handle != C_NULL
+        @ffi ccall(c.ops.close, Cvoid, (Ptr{Cvoid},), c.handle)
+        c.handle = C_NULL
+    end
+    return nothing
+end
+
+# Advance to the next element; false at the end
+function advance!(c::RangeCursor)
+    c.index += 1
+    c.index <= c.count && return true
+    c.handle == C_NULL && return false
+    c.count = GC.@preserve c Int(@ffi ccall(c.ops.next, Csize_t, (Ptr{Cvoid}, Ptr{Cvoid}, Csize_t),
+                                        c.handle, pointer(c.buffer), length(c.buffer)))
+    c.index = 1
+    if c.count == 0
+        close_cursor!(c)
+        return false
+    end
+    return true
+end
+
+cursor_buffer_type(::CppRange{T}) where {T} = T <: Union{CppString, CppStruct} ? Ptr{Cvoid} : T
+
+@inline wrap_range_element(r::CppRange{T}, x) where {T} = x
+@inline wrap_range_element(r::CppRange{CppString}, p::Ptr{Cvoid}) = CppString(p, r.lib)
+@inline wrap_range_element(r::CppRange{CppStruct}, p::Ptr{Cvoid}) = CppStruct(p, r.info, r.lib, false)
+
+function Base.iterate(r::CppRange, c = RangeCursor{cursor_buffer_type(r)}(r))
+    advance!(c) || return nothing
+    return wrap_range_element(r, @inbounds c.buffer[c.index]), c
+end
+
+Base.collect(r::CppRange{T}) where {T} = T[x for x in r]
+
+# Call f with a pointer to `x` in the form the range's C++ operations take
+function with_range_key(f, r::CppRange{T}, x) where {T}
+    if T === CppString
+        s = String(x)
+        return GC.@preserve s f(Ref(StringRef(pointer(s), sizeof(s))))
+    elseif T === CppStruct
+        x isa CppStruct || error("Expected a CppStruct, got $(typeof(x))")
+        return GC.@preserve x f(x.ptr)
+    else
+        return f(Ref(convert(T, x)))
+    end
+end
+
+function Base.in(x, r::CppRange)
+    found = with_range_key(r, x) do key
+        @ffi ccall(r.ops.contains, Cint, (Ptr{Cvoid}, Ptr{Cvoid}), r.ptr, key)
+    end
+    found < 0 && error("Elements of this range cannot be compared")
+    return found == 1
+end
+
+function Base.push!(r::CppRange, x)
+    with_range_key(r, x) do value
+        @ffi ccall(r.ops.insert, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}), r.ptr, value)
+    end
+    note_container_write(r.ptr)
+    return r
+end
+
+function Base.delete!(r::CppRange, x)
+    with_range_key(r, x) do key
+        @ffi ccall(r.ops.erase, Csize_t, (Ptr{Cvoid}, Ptr{Cvoid}), r.ptr, key)
+    end
+    note_container_write(r.ptr)
+    return r
+end
+
+function Base.empty!(r::CppRange)
+    @ffi ccall(r.ops.clear, Cvoid, (Ptr{Cvoid},), r.ptr)
+    note_container_write(r.ptr)
+    return r
+end
+
+# Replace the contents of a range member with the elements of `values`
+function assign_range!(r::CppRange, values)
+    empty!(r)
+    for x in values
+        push!(r, x)
+    end
+    return r
+end
+
+function Base.show(io::IO, r::CppRange{T}) where {T}
+    kind = r.desc.is_set == 0x01 ? "set" : "range"
+    print(io, "CppRange{", T, "} (C++ ", kind, " of ", length(r), " elements)")
+end
+
+export CppRange
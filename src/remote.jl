@@ -0,0 +1,541 @@
+# Out-of-process execution of C++ libraries over REPE
+#
+# `load_remote` starts a child Julia process that loads the library and serves REPE
+# requests over a local socket (a Unix domain socket, or a named pipe on Windows).
+# The parent works with proxies that support the same property and call syntax as
+# CppStruct and CppMemberFunction, so a crash in C++ code only takes down the child.
+#
+# Queries are JSON pointers to instances and members on the server, e.g.
+# "/global_person/address/city"; bodies are BEVE. An empty body reads the target, a
+# non-empty body writes it, and for member functions the body holds the arguments.
+# Requests carry ids, so any number can be in flight on the connection at once.
+
+const REPE_SPEC = 0x1507
+const REPE_VERSION = 0x01
+const REPE_QUERY_JSON_POINTER = 0x0001
+const REPE_BODY_BEVE = 0x0001
+const REPE_BODY_UTF8 = 0x0003
+const REPE_EC_OK = UInt32(0)
+const REPE_EC_ERROR = UInt32(1)  # body holds the error message as UTF-8
+
+struct RepeHeader
+    length::UInt64        # total message size including this header
+    spec::UInt16
+    version::UInt8
+    notify::UInt8         # 1 when no response is expected
+    reserved::UInt32
+    id::UInt64
+    query_length::UInt64
+    body_length::UInt64
+    query_format::UInt16
+    body_format::UInt16
+    ec::UInt32
+end
+
+function write_repe_message(io::IO, id::UInt64, query::String, body::AbstractVector{UInt8};
+                            notify::Bool=false, ec::UInt32=REPE_EC_OK, body_format::UInt16=REPE_BODY_BEVE)
+    header = Ref(RepeHeader(sizeof(RepeHeader) + ncodeunits(query) + length(body), REPE_SPEC, REPE_VERSION,
+                            UInt8(notify), 0, id, ncodeunits(query), length(body),
+                            REPE_QUERY_JSON_POINTER, body_format, ec))
+    GC.@preserve header unsafe_write(io, Base.unsafe_convert(Ptr{RepeHeader}, header), sizeof(RepeHeader))
+    write(io, query)
+    write(io, body)
+    return nothing
+end
+
+function read_repe_message(io::IO)
+    bytes = read(io, sizeof(RepeHeader))
+    length(bytes) == sizeof(RepeHeader) || throw(EOFError())
+    header = GC.@preserve bytes unsafe_load(Ptr{RepeHeader}(pointer(bytes)))
+    header.spec == REPE_SPEC || error("Invalid REPE message (spec 0x$(string(header.spec; base=16)))")
+    query = String(read(io, header.query_length))
+    body = read(io, header.body_length)
+    return header, query, body
+end
+
+json_pointer_token(s::AbstractString) = replace(replace(s, "~" => "~0"), "/" => "~1")
+
+function split_json_pointer(query::AbstractString)
+    startswith(query, "/") || error("Invalid query '$query': expected a JSON pointer")
+    return [replace(replace(t, "~1" => "/"), "~0" => "~") for t in split(query[2:end], '/')]
+end
+
+# ---------------------------------------------------------------------------
+# Server (runs in the child process)
+# ---------------------------------------------------------------------------
+
+mutable struct RemoteServer
+    lib::CppLibrary
+    objects::Dict{String, CppStruct}  # instance names and "#n" handles of client-created objects
+    next_handle::Int
+end
+
+function resolve_remote_object(server::RemoteServer, tokens)
+    root = String(tokens[1])
+    obj = get(server.objects, root, nothing)
+    if obj === nothing
+        startswith(root, "#") && error("Unknown object handle '$root'")
+        obj = get_instance(server.lib, root)
+        server.objects[root] = obj
+    end
+    for token in tokens[2:end]
+        obj isa CppStruct || error("Cannot access member '$token' of a non-struct value")
+        obj = getproperty(obj, Symbol(token))
+    end
+    return obj
+end
+
+remote_value_kind(value) = value isa CppStruct ? "struct:" * unsafe_string(value.info.name) : "value"
+
+# Member names and kinds, so the client can build proxies without round trips.
+# Extension members are included; those that are methods (generators, cancellable
+# methods) are listed as "unsupported" so the client can reject them by name.
+function remote_schema(obj::CppStruct, handle::AbstractString)
+    names = String[]
+    kinds = String[]
+    for member in unsafe_wrap(Array, obj.info.members, obj.info.member_count)
+        push!(names, unsafe_string(member.name))
+        if member.kind == UInt8(MEMBER_FUNCTION)
+            push!(kinds, "function")
+        else
+            push!(kinds, remote_value_kind(get_member_value(obj, member)))
+        end
+    end
+    for member in extension_members(obj.lib, obj.info)
+        name = unsafe_string(member.name)
+        name in names && continue   # shadows a regular member listed above
+        push!(names, name)
+        push!(kinds, is_data_extension(member) ? remote_value_kind(get_member_value(obj, member)) : "unsupported")
+    end
+    return Dict{String, Any}("handle" => String(handle), "type" => unsafe_string(obj.info.name),
+                             "names" => names, "kinds" => kinds)
+end
+
+function handle_remote_request(server::RemoteServer, query::String, body::Vector{UInt8})
+    tokens = split_json_pointer(query)
+    root = tokens[1]
+
+    if root == "\$new"
+        obj = getproperty(server.lib, Symbol(tokens[2]))
+        server.next_handle += 1
+        handle = "#$(server.next_handle)"
+        server.objects[handle] = obj
+        return to_beve(remote_schema(obj, handle))
+    elseif root == "\$free"
+        delete!(server.objects, tokens[2])
+        return UInt8[]
+    elseif root == "\$schema"
+        obj = resolve_remote_object(server, tokens[2:end])
+        obj isa CppStruct || error("'$query' does not refer to a struct")
+        return to_beve(remote_schema(obj, tokens[2]))
+    end
+
+    if length(tokens) == 1
+        obj = resolve_remote_object(server, tokens)
+        Base.isempty(body) && return to_beve(obj)
+        assign_plain!(obj, from_beve(body))
+        return UInt8[]
+    end
+
+    parent = resolve_remote_object(server, tokens[1:end-1])
+    parent isa CppStruct || error("'$query' does not refer to a struct member")
+    name = Symbol(tokens[end])
+    target = getproperty(parent, name)
+    if target isa CppMemberFunction
+        args = Base.isempty(body) ? Any[] : from_beve(body)
+        return to_beve(target(args...))
+    elseif Base.isempty(body)
+        return to_beve(target)
+    else
+        assign_member!(parent, name, from_beve(body))
+        return UInt8[]
+    end
+end
+
+"""
+    serve_remote(lib_path, socket_path; init=nothing)
+
+Load the library at `lib_path` and serve REPE requests from one client on
+`socket_path` until the client disconnects. `init` optionally names an exported
+`void()` function to call after loading (e.g. to register types). This is the
+entry point of the child process started by `load_remote`.
+"""
+function serve_remote(lib_path::AbstractString, socket_path::AbstractString; init=nothing)
+    lib = CppLibrary(String(lib_path))
+    init === nothing || @ffi ccall(Libdl.dlsym(lib.handle, Symbol(init)), Cvoid, ())
+    server = RemoteServer(lib, Dict{String, CppStruct}(), 0)
+
+    listener = Sockets.listen(socket_path)
+    try
+        sock = Sockets.accept(listener)
+        out = IOBuffer()
+        while !eof(sock)
+            header, query, body = read_repe_message(sock)
+            response, ec = try
+                handle_remote_request(server, query, body), REPE_EC_OK
+            catch err
+                Vector{UInt8}(sprint(showerror, err)), REPE_EC_ERROR
+            end
+            if header.notify == 0x00
+                write_repe_message(out, header.id, query, response; ec=ec,
+                                   body_format=(ec == REPE_EC_OK ? REPE_BODY_BEVE : REPE_BODY_UTF8))
+            end
+            # Answer a pipelined batch with a single write
+            if bytesavailable(sock) == 0 && position(out) > 0
+                write(sock, take!(out))
+            end
+        end
+    finally
+        close(listener)
+        Sys.iswindows() || rm(socket_path; force=true)
+    end
+    return nothing
+end
+
+# ---------------------------------------------------------------------------
+# Client (runs in the calling process)
+# ---------------------------------------------------------------------------
+
+struct RemoteSchema
+    type_name::String
+    names::Vector{Symbol}
+    kinds::Dict{Symbol, String}
+end
+
+RemoteSchema(d::AbstractDict) =
+    RemoteSchema(d["type"], Symbol.(d["names"]), Dict(Symbol(n) => k for (n, k) in zip(d["names"], d["kinds"])))
+
+"""
+    RemoteLibrary
+
+A C++ library running in a child process, created with `load_remote`. Supports the
+same `lib.TypeName` and `get_instance` access as `CppLibrary`; the returned
+`RemoteStruct` proxies forward member access and calls to the child.
+"""
+mutable struct RemoteLibrary
+    process::Base.Process
+    socket::IO
+    lock::ReentrantLock        # guards outbox, pending, next_id, batch_depth, alive
+    write_lock::ReentrantLock  # serializes socket writes
+    outbox::IOBuffer           # requests not yet written to the socket
+    pending::Dict{UInt64, Channel{Tuple{UInt32, Vector{UInt8}}}}
+    next_id::UInt64
+    batch_depth::Int
+    alive::Bool
+    schemas::Dict{String, RemoteSchema}
+    # Handles of collected RemoteStructs; filled by finalizers, so guarded by a spin lock
+    release_lock::Threads.SpinLock
+    released::Vector{String}
+end
+
+"""
+    RemoteStruct
+
+Proxy for a C++ struct living in a `RemoteLibrary` child process. Reading a member
+returns plain Julia data (vectors are transferred in bulk), nested structs return
+further proxies and member functions return `RemoteMemberFunction`s.
+"""
+mutable struct RemoteStruct
+    remote::RemoteLibrary
+    path::String          # JSON pointer of the object on the server
+    schema::RemoteSchema
+    handle::String        # server handle released when the proxy is collected; "" if not owned
+
+    function RemoteStruct(remote::RemoteLibrary, path::String, schema::RemoteSchema, handle::String="")
+        obj = new(remote, path, schema, handle)
+        Base.isempty(handle) || finalizer(release_remote_struct, obj)
+        return obj
+    end
+end
+
+struct RemoteMemberFunction
+    remote::RemoteLibrary
+    path::String
+    name::String
+    type_name::String
+end
+
+"""
+    RemoteFuture
+
+Pending result of a request to a `RemoteLibrary`. `fetch` waits for and decodes the
+response.
+"""
+struct RemoteFuture
+    remote::RemoteLibrary
+    channel::Channel{Tuple{UInt32, Vector{UInt8}}}
+    query::String
+end
+
+function remote_socket_path()
+    name = "glaze_remote_$(getpid())_$(string(rand(UInt32); base=16))"
+    return Sys.iswindows() ? "\\\\.\\pipe\\" * name : joinpath(tempdir(), name * ".sock")
+end
+
+"""
+    load_remote(path::String; init=nothing, timeout=60.0) -> RemoteLibrary
+
+Load a C++ shared library into a separate child process and connect to it. Crashes
+in the library terminate only the child: pending and later requests then throw in
+the parent. `init` optionally names an exported `void()` function to call after
+loading (e.g. to register types).
+
+# Example
+```julia
+remote = Glaze.load_remote("libplugin.so"; init=:register_types)
+calc = remote.Calculator       # instance created in the child
+calc.value = 2.0
+calc.add(3.0)                  # executed in the child
+close(remote)
+```
+"""
+function load_remote(path::String; init=nothing, timeout::Real=60.0)
+    socket_path = remote_socket_path()
+    init_arg = init === nothing ? "nothing" : repr(String(init))
+    code = "using Glaze; Glaze.serve_remote($(repr(abspath(path))), $(repr(socket_path)); init=$init_arg)"
+    project = Base.active_project()
+    project_arg = project === nothing ? String[] : ["--project=$project"]
+    cmd = `$(Base.julia_cmd()) --startup-file=no $project_arg -e $code`
+    process = run(pipeline(cmd; stdout=stdout, stderr=stderr); wait=false)
+
+    deadline = time() + timeout
+    socket = nothing
+    while socket === nothing
+        try
+            socket = Sockets.connect(socket_path)
+        catch
+            process_running(process) || error("Remote library process exited during startup (exit code $(process.exitcode))")
+            if time() > deadline
+                kill(process)
+                error("Timed out waiting for remote library process to start")
+            end
+            sleep(0.05)
+        end
+    end
+
+    remote = RemoteLibrary(process, socket, ReentrantLock(), ReentrantLock(), IOBuffer(),
+                           Dict{UInt64, Channel{Tuple{UInt32, Vector{UInt8}}}}(), 0, 0, true,
+                           Dict{String, RemoteSchema}(), Threads.SpinLock(), String[])
+    @async remote_reader_loop(remote)
+    return remote
+end
+
+# Dispatch responses to their futures; fail everything pending once the child is gone
+function remote_reader_loop(remote::RemoteLibrary)
+    try
+        while !eof(getfield(remote, :socket))
+            header, _, body = read_repe_message(getfield(remote, :socket))
+            channel = lock(() -> pop!(getfield(remote, :pending), header.id, nothing), getfield(remote, :lock))
+            channel === nothing || put!(channel, (header.ec, body))
+        end
+    catch err
+        err isa Union{EOFError, Base.IOError} || @error "Remote library connection failed" exception=err
+    finally
+        lock(getfield(remote, :lock)) do
+            setfield!(remote, :alive, false)
+            foreach(close, values(getfield(remote, :pending)))
+            empty!(getfield(remote, :pending))
+        end
+    end
+    return nothing
+end
+
+function release_remote_struct(obj::RemoteStruct)
+    remote = getfield(obj, :remote)
+    # Finalizers must not block: retry on a later collection if the lock is busy
+    if trylock(getfield(remote, :release_lock))
+        push!(getfield(remote, :released), getfield(obj, :handle))
+        unlock(getfield(remote, :release_lock))
+    else
+        finalizer(release_remote_struct, obj)
+    end
+    return nothing
+end
+
+# Queue release notifications for collected proxies (caller holds remote.lock)
+function queue_released!(remote::RemoteLibrary)
+    lock(getfield(remote, :release_lock))
+    handles = copy(getfield(remote, :released))
+    empty!(getfield(remote, :released))
+    unlock(getfield(remote, :release_lock))
+    for handle in handles
+        write_repe_message(getfield(remote, :outbox), UInt64(0), "/\$free/" * handle, UInt8[]; notify=true)
+    end
+    return nothing
+end
+
+function submit(remote::RemoteLibrary, query::String, body::Vector{UInt8}=UInt8[])
+    channel = Channel{Tuple{UInt32, Vector{UInt8}}}(1)
+    batching = lock(getfield(remote, :lock)) do
+        getfield(remote, :alive) || error("Remote library process is not running")
+        queue_released!(remote)
+        id = getfield(remote, :next_id) + 1
+        setfield!(remote, :next_id, id)
+        getfield(remote, :pending)[id] = channel
+        write_repe_message(getfield(remote, :outbox), id, query, body)
+        getfield(remote, :batch_depth) > 0
+    end
+    batching || flush_requests(remote)
+    return RemoteFuture(remote, channel, query)
+end
+
+function flush_requests(remote::RemoteLibrary)
+    lock(getfield(remote, :write_lock)) do
+        bytes = lock(() -> take!(getfield(remote, :outbox)), getfield(remote, :lock))
+        try
+            Base.isempty(bytes) || write(getfield(remote, :socket), bytes)
+        catch err
+            err isa Base.IOError || rethrow()
+            error("Remote library process is not running")
+        end
+    end
+    return nothing
+end
+
+function Base.fetch(f::RemoteFuture)
+    flush_requests(f.remote)
+    ec, body = try
+        fetch(f.channel)
+    catch err
+        err isa InvalidStateException || rethrow()
+        error("Remote library process exited before answering '$(f.query)'")
+    end
+    ec == REPE_EC_OK || error("Remote request '$(f.query)' failed: $(String(copy(body)))")
+    return Base.isempty(body) ? nothing : from_beve(body)
+end
+
+"""
+    batch(f, remote::RemoteLibrary)
+
+Run `f()` with request sending deferred: requests issued inside (e.g. through
+`remote_get`/`remote_call`) are written to the child in one batch when `f` returns
+or when a result is first needed.
+
+# Example
+```julia
+futures = Glaze.batch(remote) do
+    [Glaze.remote_get(obj, name) for name in (:x, :y, :z)]
+end
+x, y, z = fetch.(futures)   # one write, one round trip
+```
+"""
+function batch(f, remote::RemoteLibrary)
+    lock(() -> setfield!(remote, :batch_depth, getfield(remote, :batch_depth) + 1), getfield(remote, :lock))
+    try
+        return f()
+    finally
+        lock(() -> setfield!(remote, :batch_depth, getfield(remote, :batch_depth) - 1), getfield(remote, :lock))
+        flush_requests(remote)
+    end
+end
+
+Base.isopen(remote::RemoteLibrary) = lock(() -> getfield(remote, :alive), getfield(remote, :lock))
+
+function Base.close(remote::RemoteLibrary)
+    close(getfield(remote, :socket))
+    wait(getfield(remote, :process))
+    return nothing
+end
+
+# Fields are only read with getfield, so every property name is a C++ type
+function Base.getproperty(remote::RemoteLibrary, name::Symbol)
+    # Create an instance of the C++ type in the child process
+    schema = fetch(submit(remote, "/\$new/" * json_pointer_token(String(name))))
+    handle = schema["handle"]
+    return RemoteStruct(remote, "/" * json_pointer_token(handle), cached_schema!(remote, schema), handle)
+end
+
+function cached_schema!(remote::RemoteLibrary, d::AbstractDict)
+    lock(() -> get!(() -> RemoteSchema(d), getfield(remote, :schemas), d["type"]), getfield(remote, :lock))
+end
+
+function get_instance(remote::RemoteLibrary, instance_name::String)
+    path = "/" * json_pointer_token(instance_name)
+    schema = fetch(submit(remote, "/\$schema" * path))
+    return RemoteStruct(remote, path, cached_schema!(remote, schema))
+end
+
+function member_kind(obj::RemoteStruct, name::Symbol)
+    kind = get(getfield(obj, :schema).kinds, name, nothing)
+    kind === nothing && error("Member $name not found")
+    kind == "unsupported" &&
+        error("Member $name is a generator or cancellable method, which cannot be used through a RemoteLibrary")
+    return kind
+end
+
+# Fields are only read with getfield, so C++ members may share their names
+member_path(obj::RemoteStruct, name::Symbol) = getfield(obj, :path) * "/" * json_pointer_token(String(name))
+
+function Base.getproperty(obj::RemoteStruct, name::Symbol)
+    remote = getfield(obj, :remote)
+    path = member_path(obj, name)
+    kind = member_kind(obj, name)
+    if kind == "function"
+        return RemoteMemberFunction(remote, path, String(name), getfield(obj, :schema).type_name)
+    elseif startswith(kind, "struct:")
+        type_name = kind[8:end]
+        schema = lock(() -> get(getfield(remote, :schemas), type_name, nothing), getfield(remote, :lock))
+        if schema === nothing
+            schema = cached_schema!(remote, fetch(submit(remote, "/\$schema" * path)))
+        end
+        return RemoteStruct(remote, path, schema)
+    end
+    return fetch(submit(remote, path))
+end
+
+function Base.setproperty!(obj::RemoteStruct, name::Symbol, value)
+    member_kind(obj, name) == "function" &&
+        error("Cannot set value of member function '$name'. Member functions are not modifiable.")
+    payload = value isa RemoteStruct ? value[] : value
+    fetch(submit(getfield(obj, :remote), member_path(obj, name), to_beve(payload)))
+    return value
+end
+
+Base.propertynames(obj::RemoteStruct) = getfield(obj, :schema).names
+
+"""
+    obj[] -> Dict{String,Any}
+    obj[] = data
+
+Read or write the whole remote object as plain data in one round trip.
+"""
+Base.getindex(obj::RemoteStruct) = fetch(submit(getfield(obj, :remote), getfield(obj, :path)))
+
+function Base.setindex!(obj::RemoteStruct, data::AbstractDict)
+    fetch(submit(getfield(obj, :remote), getfield(obj, :path), to_beve(data)))
+    return obj
+end
+
+(f::RemoteMemberFunction)(args...) = fetch(remote_call(f, args...))
+
+"""
+    remote_get(obj::RemoteStruct, name::Symbol) -> RemoteFuture
+
+Request member `name` without waiting for the answer, so several reads can be
+pipelined.
+"""
+function remote_get(obj::RemoteStruct, name::Symbol)
+    member_kind(obj, name) == "value" || error("remote_get only supports data members")
+    return submit(getfield(obj, :remote), member_path(obj, name))
+end
+
+"""
+    remote_call(f::RemoteMemberFunction, args...) -> RemoteFuture
+
+Call a remote member function without waiting for the result.
+"""
+remote_call(f::RemoteMemberFunction, args...) = submit(f.remote, f.path, to_beve(collect(Any, args)))
+
+function Base.show(io::IO, remote::RemoteLibrary)
+    print(io, "RemoteLibrary(pid=", getpid(getfield(remote, :process)), isopen(remote) ? "" : ", exited", ")")
+end
+
+function Base.show(io::IO, obj::RemoteStruct)
+    print(io, getfield(obj, :schema).type_name, " (remote at ", getfield(obj, :path), ")")
+end
+
+function Base.show(io::IO, f::RemoteMemberFunction)
+    print(io, "RemoteMemberFunction(", f.type_name, "::", f.name, ")")
+end
+
+export RemoteLibrary, RemoteStruct, RemoteMemberFunction, RemoteFuture, load_remote, remote_get, remote_call
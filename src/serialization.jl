@@ -0,0 +1,99 @@
+# Serialization support for Glaze wrappers
+#
+# Wrappers hold raw pointers into C++ memory, which are meaningless in another
+# process. Instead the underlying C++ data is written as BEVE. A CppStruct is
+# recreated as a new instance in the receiving process's copy of the library; the
+# container wrappers (vectors, strings, optionals, variants) are views into a parent
+# object and deserialize to their plain Julia equivalents, ready to be assigned to
+# a member of a recreated struct.
+#
+# Types registered with glz_jl::register_beve (cpp_interface/glaze_jl/beve.hpp) are
+# encoded by Glaze in C++, so every member Glaze can write is included. Other types
+# are encoded from Julia through their interop members, which fails for types with
+# extension members (pointers, enums, tuples, ...) rather than dropping them.
+
+# glz_jl_write_beve and glz_jl_read_beve of one library (C_NULL when not exported)
+struct NativeBeveFuncs
+    write::Ptr{Cvoid}
+    read::Ptr{Cvoid}
+end
+
+const _native_beve_funcs = SnapshotDict{Ptr{Cvoid}, NativeBeveFuncs}()
+
+native_beve_funcs(lib::Ptr{Cvoid}) = get!(_native_beve_funcs, lib) do
+    sym(name) = something(Libdl.dlsym(lib, name; throw_error=false), C_NULL)
+    NativeBeveFuncs(sym(:glz_jl_write_beve), sym(:glz_jl_read_beve))
+end
+
+# Glaze's own BEVE encoding of `obj`, or nothing when its type is not registered
+# with glz_jl::register_beve
+function native_beve(obj::CppStruct)
+    write_func = native_beve_funcs(obj.lib).write
+    write_func == C_NULL && return nothing
+    buffer = Vector{UInt8}(undef, 4096)
+    while true
+        n = @ffi ccall(write_func, Csize_t, (Ptr{UInt8}, Ptr{Cvoid}, Ptr{UInt8}, Csize_t),
+                       obj.info.name, obj.ptr, buffer, length(buffer))
+        n == typemax(Csize_t) && return nothing
+        if n <= length(buffer)
+            return resize!(buffer, n)
+        end
+        resize!(buffer, n)
+    end
+end
+
+function read_native_beve!(obj::CppStruct, data::Vector{UInt8})
+    read_func = native_beve_funcs(obj.lib).read
+    type_name = unsafe_string(obj.info.name)
+    read_func == C_NULL && error("Library does not export glz_jl_read_beve; cannot decode natively encoded $type_name")
+    status = @ffi ccall(read_func, Cint, (Ptr{UInt8}, Ptr{Cvoid}, Ptr{UInt8}, Csize_t),
+                        obj.info.name, obj.ptr, data, length(data))
+    status == -1 && error("Type $type_name is not registered with glz_jl::register_beve in this process")
+    status == 0 || error("BEVE data does not match type $type_name")
+    return obj
+end
+
+# Find the CppLibrary loaded in this process from the same file as the library
+# at `path` in the sending process
+function library_for_path(path::String)
+    target = ispath(path) ? realpath(path) : path
+    for lib in values(snapshot(_library_registry))
+        loaded = Libdl.dlpath(lib.handle)
+        if loaded == path || (ispath(loaded) && realpath(loaded) == target)
+            return lib
+        end
+    end
+    error("Library '$path' is not loaded in this process; load it with Glaze.load before deserializing")
+end
+
+function Serialization.serialize(s::Serialization.AbstractSerializer, obj::CppStruct)
+    Serialization.serialize_type(s, CppStruct)
+    Serialization.serialize(s, Libdl.dlpath(obj.lib))
+    Serialization.serialize(s, unsafe_string(obj.info.name))
+    native = native_beve(obj)
+    Serialization.serialize(s, native !== nothing)
+    Serialization.serialize(s, native === nothing ? to_beve(obj) : native)
+end
+
+function Serialization.deserialize(s::Serialization.AbstractSerializer, ::Type{CppStruct})
+    path = Serialization.deserialize(s)::String
+    type_name = Serialization.deserialize(s)::String
+    native = Serialization.deserialize(s)::Bool
+    data = Serialization.deserialize(s)::Vector{UInt8}
+    obj = getproperty(library_for_path(path), Symbol(type_name))
+    return native ? read_native_beve!(obj, data) : assign_plain!(obj, from_beve(data))
+end
+
+const SerializedContainer = Union{CppString, CppVector, CppVectorFloat32, CppVectorFloat64, CppVectorInt32,
+                                  CppVectorComplexF32, CppVectorComplexF64, CppOptional, CppVariant}
+
+function Serialization.serialize(s::Serialization.AbstractSerializer, v::T) where {T <: SerializedContainer}
+    Serialization.serialize_type(s, T)
+    Serialization.serialize(s, to_beve(v))
+end
+
+# Strings, vectors, optionals and variants come back as String, Vector{T}, value-or-nothing
+# and the active alternative's value respectively
+function Serialization.deserialize(s::Serialization.AbstractSerializer, ::Type{<:SerializedContainer})
+    return from_beve(Serialization.deserialize(s)::Vector{UInt8})
+end
@@ -0,0 +1,477 @@
+# Named shared-memory segments for sharing C++ data across Julia processes
+#
+# A segment is a memory-mapped file (POSIX shared memory under /dev/shm on Linux)
+# laid out as a header, a fixed-size entry table and a data area. Entries refer to
+# their payload by offset from the segment base, so every process can map the
+# segment at a different address and still read it without copying.
+
+const SHM_MAGIC = 0x31304d48535a4c47  # "GLZSHM01"
+const SHM_VERSION = UInt32(1)
+const SHM_DEFAULT_ENTRIES = 1024
+const SHM_ALIGNMENT = 64
+
+# Entry kinds. Element kinds index into SHM_ELTYPES; SHM_ARRAY_FLAG marks arrays.
+const SHM_ELTYPES = (Bool, Int8, Int16, Int32, Int64, UInt8, UInt16, UInt32, UInt64,
+                     Float32, Float64, ComplexF32, ComplexF64)
+const SHM_KIND_STRING = UInt32(0x100)
+const SHM_KIND_STRUCT = UInt32(0x101)
+const SHM_ARRAY_FLAG = UInt32(0x10000)
+
+struct ShmHeader
+    magic::UInt64
+    version::UInt32
+    entry_capacity::UInt32
+    entry_count::UInt64
+    data_offset::UInt64  # offset of the data area
+    data_end::UInt64     # bump pointer: first free byte of the data area
+    capacity::UInt64     # total segment size in bytes
+    reserved::NTuple{2, UInt64}
+end
+
+struct ShmEntry
+    name::NTuple{96, UInt8}  # NUL-terminated path, e.g. "config/weights"
+    kind::UInt32
+    reserved::UInt32
+    offset::UInt64           # payload offset from the segment base
+    length::UInt64           # element count (arrays) or byte count (strings)
+    reserved2::UInt64
+end
+
+"""
+    SharedSegment
+
+A named shared-memory segment holding published C++ data. Created by the publishing
+process with `create_segment` and mapped read-only by other processes through
+`attach`. Only the creating process maps a segment writable, so each segment has a
+single writer; threads of that process publishing at once are serialized by `lock`.
+"""
+mutable struct SharedSegment
+    name::String
+    path::String
+    data::Vector{UInt8}  # memory-mapped segment; empty once closed
+    writable::Bool
+    index::Dict{String, Int}  # entry name -> entry position (1-based)
+    lock::ReentrantLock       # serializes publishers in this process
+end
+
+SharedSegment(name, path, data, writable) =
+    SharedSegment(name, path, data, writable, Dict{String, Int}(), ReentrantLock())
+
+Base.isopen(seg::SharedSegment) = !Base.isempty(seg.data)
+
+"""
+    SharedMemoryView{T,N}
+
+Read-only zero-copy view of an array stored in a `SharedSegment`.
+"""
+struct SharedMemoryView{T,N} <: AbstractArray{T,N}
+    ptr::Ptr{T}
+    dims::NTuple{N,Int}
+    segment::SharedSegment  # keeps the mapping alive
+end
+
+Base.size(A::SharedMemoryView) = A.dims
+Base.IndexStyle(::Type{<:SharedMemoryView}) = IndexLinear()
+
+@inline function Base.getindex(A::SharedMemoryView{T}, i::Int) where T
+    @boundscheck checkbounds(A, i)
+    unsafe_load(A.ptr, i)
+end
+
+Base.setindex!(::SharedMemoryView, val, i::Int) = error("Shared memory views are read-only")
+Base.pointer(A::SharedMemoryView) = A.ptr
+Base.similar(A::SharedMemoryView{T}, ::Type{S}, dims::Dims) where {T,S} = Vector{S}(undef, dims)
+
+"""
+    SharedInstance
+
+Read-only view of a `CppStruct` published into a shared-memory segment. It is not a
+C++ object: it cannot be passed to C++ functions and has no member functions. Members
+are accessed with property syntax: numbers are loaded directly, vectors are returned
+as `SharedMemoryView`s and nested structs as `SharedInstance`s.
+"""
+struct SharedInstance
+    segment::SharedSegment
+    path::String
+    type_name::String
+end
+
+# Segments mapped by this process, by name
+const _open_segments = Dict{String, SharedSegment}()
+const _segments_lock = ReentrantLock()
+
+function segment_path(name::AbstractString)
+    occursin(r"^[A-Za-z0-9_.-]+$", name) || error("Invalid segment name '$name'")
+    if Sys.islinux() && isdir("/dev/shm")
+        return joinpath("/dev/shm", "glaze_" * name)
+    else
+        return joinpath(tempdir(), "glaze_shm_" * name)
+    end
+end
+
+@inline shm_base(seg::SharedSegment) = pointer(seg.data)
+
+@inline function shm_header(seg::SharedSegment)
+    isopen(seg) || error("Shared memory segment '$(seg.name)' is closed")
+    return GC.@preserve seg unsafe_load(Ptr{ShmHeader}(shm_base(seg)))
+end
+
+function shm_store_header!(seg::SharedSegment, header::ShmHeader)
+    GC.@preserve seg unsafe_store!(Ptr{ShmHeader}(shm_base(seg)), header)
+end
+
+@inline shm_entry_ptr(seg::SharedSegment, i::Integer) =
+    Ptr{ShmEntry}(shm_base(seg) + sizeof(ShmHeader) + (i - 1) * sizeof(ShmEntry))
+
+function entry_name(e::ShmEntry)
+    bytes = collect(e.name)
+    n = something(findfirst(iszero, bytes), length(bytes) + 1) - 1
+    return String(bytes[1:n])
+end
+
+# Pick up entries published since the index was last built
+function refresh_index!(seg::SharedSegment)
+    count = Int(shm_header(seg).entry_count)
+    for i in (length(seg.index) + 1):count
+        entry = GC.@preserve seg unsafe_load(shm_entry_ptr(seg, i))
+        seg.index[entry_name(entry)] = i
+    end
+    return seg
+end
+
+"""
+    create_segment(name::AbstractString, capacity::Integer; max_entries=1024) -> SharedSegment
+
+Create (or replace) the named shared-memory segment with room for `capacity` bytes of
+data. The creating process publishes data with `publish!`; other processes read it
+with `attach`. Remove the segment with `unlink_segment` when it is no longer needed.
+
+An existing segment of that name is unlinked and a new file is created in its place,
+so processes that mapped the old segment keep reading their copy.
+"""
+function create_segment(name::AbstractString, capacity::Integer; max_entries::Integer=SHM_DEFAULT_ENTRIES)
+    path = segment_path(name)
+    data_offset = cld(sizeof(ShmHeader) + max_entries * sizeof(ShmEntry), SHM_ALIGNMENT) * SHM_ALIGNMENT
+    total = data_offset + cld(capacity, SHM_ALIGNMENT) * SHM_ALIGNMENT
+
+    lock(_segments_lock) do
+        # Truncating the file in place would fault every process that still maps it,
+        # including views of the old segment held in this one
+        rm(path; force=true)
+        file = Base.Filesystem.open(path, Base.Filesystem.JL_O_CREAT | Base.Filesystem.JL_O_EXCL |
+                                          Base.Filesystem.JL_O_RDWR, 0o600)
+        close(file)
+        data = open(path, "r+") do io
+            Mmap.mmap(io, Vector{UInt8}, total; shared=true)
+        end
+        seg = SharedSegment(String(name), path, data, true)
+        shm_store_header!(seg, ShmHeader(SHM_MAGIC, SHM_VERSION, UInt32(max_entries), 0,
+                                         data_offset, data_offset, total, (0, 0)))
+        _open_segments[seg.name] = seg
+        return seg
+    end
+end
+
+"""
+    open_segment(name::AbstractString) -> SharedSegment
+
+Map an existing segment read-only. Segments are mapped once per process.
+"""
+function open_segment(name::AbstractString)
+    lock(_segments_lock) do
+        seg = get(_open_segments, name, nothing)
+        seg !== nothing && return refresh_index!(seg)
+
+        path = segment_path(name)
+        isfile(path) || error("Shared memory segment '$name' does not exist")
+        data = open(path, "r") do io
+            Mmap.mmap(io, Vector{UInt8}, filesize(io); shared=true)
+        end
+        seg = SharedSegment(String(name), path, data, false)
+        header = shm_header(seg)
+        header.magic == SHM_MAGIC || error("'$name' is not a Glaze shared memory segment")
+        header.version == SHM_VERSION || error("Unsupported shared memory segment version $(header.version)")
+        _open_segments[seg.name] = seg
+        return refresh_index!(seg)
+    end
+end
+
+"""
+    unlink_segment(name::AbstractString)
+
+Remove the named segment. Processes that already mapped it keep their mapping.
+"""
+function unlink_segment(name::AbstractString)
+    lock(() -> delete!(_open_segments, name), _segments_lock)
+    rm(segment_path(name); force=true)
+    return nothing
+end
+
+"""
+    close(seg::SharedSegment)
+
+Unmap the segment in this process. Views and instances attached from it must not
+be used afterwards. The segment itself stays until `unlink_segment`.
+"""
+function Base.close(seg::SharedSegment)
+    lock(_segments_lock) do
+        get(_open_segments, seg.name, nothing) === seg && delete!(_open_segments, seg.name)
+    end
+    lock(seg.lock) do
+        data = seg.data
+        seg.data = UInt8[]
+        finalize(data)  # runs the munmap finalizer Mmap attached to the array
+    end
+    return nothing
+end
+
+# Bump-allocate `nbytes` in the data area and return the payload offset
+function shm_allocate!(seg::SharedSegment, nbytes::Integer)
+    header = shm_header(seg)
+    offset = cld(header.data_end, SHM_ALIGNMENT) * SHM_ALIGNMENT
+    offset + nbytes <= header.capacity ||
+        error("Shared memory segment '$(seg.name)' is full ($(header.capacity) bytes)")
+    shm_store_header!(seg, ShmHeader(header.magic, header.version, header.entry_capacity,
+                                     header.entry_count, header.data_offset, offset + nbytes,
+                                     header.capacity, header.reserved))
+    return offset
+end
+
+function shm_add_entry!(seg::SharedSegment, name::AbstractString, kind::UInt32, offset::Integer, len::Integer)
+    seg.writable || error("Shared memory segment '$(seg.name)' is read-only in this process")
+    ncodeunits(name) < 96 || error("Entry name '$name' is too long (max 95 bytes)")
+    refresh_index!(seg)
+    haskey(seg.index, name) && error("Entry '$name' already exists in segment '$(seg.name)'")
+
+    header = shm_header(seg)
+    header.entry_count < header.entry_capacity || error("Shared memory segment '$(seg.name)' has no free entries")
+
+    name_bytes = ntuple(i -> i <= ncodeunits(name) ? codeunit(name, i) : 0x00, 96)
+    i = Int(header.entry_count) + 1
+    GC.@preserve seg unsafe_store!(shm_entry_ptr(seg, i), ShmEntry(name_bytes, kind, 0, offset, len, 0))
+    # Publish the entry only once it is complete
+    Threads.atomic_fence()
+    header = shm_header(seg)
+    shm_store_header!(seg, ShmHeader(header.magic, header.version, header.entry_capacity,
+                                     header.entry_count + 1, header.data_offset, header.data_end,
+                                     header.capacity, header.reserved))
+    seg.index[String(name)] = i
+    return nothing
+end
+
+function shm_eltype_code(::Type{T}) where T
+    code = findfirst(==(T), SHM_ELTYPES)
+    code === nothing && error("Element type $T cannot be stored in shared memory")
+    return UInt32(code)
+end
+
+function shm_write_bytes!(seg::SharedSegment, name, kind::UInt32, src::Ptr, nbytes::Integer, len::Integer)
+    lock(seg.lock) do
+        seg.writable || error("Shared memory segment '$(seg.name)' is read-only in this process")
+        offset = shm_allocate!(seg, nbytes)
+        GC.@preserve seg unsafe_copyto!(shm_base(seg) + offset, Ptr{UInt8}(src), nbytes)
+        shm_add_entry!(seg, name, kind, offset, len)
+    end
+end
+
+"""
+    publish!(seg::SharedSegment, name::AbstractString, value)
+
+Copy `value` once into the segment under `name` so other processes can `attach` it
+without copying. Supported values:
+- `CppStruct` whose data members are numbers, strings, numeric/complex vectors and
+  nested structs of the same kind. The struct is published as one entry per member,
+  not as a C++ object, so other processes read it through a `SharedInstance`. Structs
+  with any other member (optionals, variants, vectors of strings or structs,
+  extension members) are rejected before anything is written.
+- Glaze vectors and `CppArrayView`s of numeric or complex elements
+- `CppString`/`AbstractString`, numbers and dense Julia arrays of numbers
+"""
+function publish!(seg::SharedSegment, name::AbstractString, value::AbstractArray{T}) where T
+    code = shm_eltype_code(T)
+    src = value isa Union{Array, CppArrayView} ? value : collect(value)
+    GC.@preserve src shm_write_bytes!(seg, name, code | SHM_ARRAY_FLAG, pointer(src),
+                                      length(src) * sizeof(T), length(src))
+    return seg
+end
+
+function publish!(seg::SharedSegment, name::AbstractString,
+                  v::Union{CppVector, CppVectorFloat32, CppVectorFloat64, CppVectorInt32, CppVectorComplexF32, CppVectorComplexF64})
+    publish!(seg, name, array_view(v))
+end
+
+function publish!(seg::SharedSegment, name::AbstractString, value::AbstractString)
+    str = String(value)
+    GC.@preserve str shm_write_bytes!(seg, name, SHM_KIND_STRING, pointer(str), ncodeunits(str), ncodeunits(str))
+    return seg
+end
+
+function publish!(seg::SharedSegment, name::AbstractString, value::Number)
+    ref = Ref(value)
+    GC.@preserve ref shm_write_bytes!(seg, name, shm_eltype_code(typeof(value)),
+                                      Base.unsafe_convert(Ptr{typeof(value)}, ref), sizeof(value), 1)
+    return seg
+end
+
+const ShmMemberValue = Union{Number, CppString, CppStruct, CppVectorFloat32, CppVectorFloat64,
+                             CppVectorInt32, CppVectorComplexF32, CppVectorComplexF64}
+
+shm_publishable(value) = value isa ShmMemberValue ||
+    (value isa CppVector && (try eltype(value) catch; Nothing end) in SHM_ELTYPES)
+
+# Throw, naming the member, unless every data member of `obj` (recursively) has a
+# flat representation, so a struct is never published in part
+function check_publishable(obj::CppStruct, path::AbstractString)
+    info = obj.info
+    for member in unsafe_wrap(Array, info.members, info.member_count)
+        member.kind == UInt8(MEMBER_FUNCTION) && continue
+        member_path = shm_member_path(path, unsafe_string(member.name))
+        member_value = get_member_value(obj, member)
+        shm_publishable(member_value) ||
+            error("Cannot publish member '$member_path' ($(typeof(member_value))) to shared memory")
+        member_value isa CppStruct && check_publishable(member_value, member_path)
+    end
+    for member in extension_members(obj.lib, info)
+        member_index_by_name(info, member.name) == 0 &&
+            error("Cannot publish member '$path/$(unsafe_string(member.name))' to shared memory: " *
+                  "members registered through glaze_jl helpers have no flat representation")
+    end
+    return nothing
+end
+
+# Entry names are paths; member names are escaped like JSON pointer tokens
+shm_member_path(path::AbstractString, member::AbstractString) = string(path, "/", json_pointer_token(member))
+
+function publish!(seg::SharedSegment, name::AbstractString, obj::CppStruct)
+    check_publishable(obj, name)
+    lock(() -> publish_struct!(seg, name, obj), seg.lock)
+    return seg
+end
+
+function publish_struct!(seg::SharedSegment, name::AbstractString, obj::CppStruct)
+    type_name = unsafe_string(obj.info.name)
+    GC.@preserve type_name shm_write_bytes!(seg, name, SHM_KIND_STRUCT, pointer(type_name),
+                                            ncodeunits(type_name), ncodeunits(type_name))
+    for member in unsafe_wrap(Array, obj.info.members, obj.info.member_count)
+        member.kind == UInt8(MEMBER_FUNCTION) && continue
+        member_value = get_member_value(obj, member)
+        member_path = shm_member_path(name, unsafe_string(member.name))
+        if member_value isa CppStruct
+            publish_struct!(seg, member_path, member_value)
+        else
+            publish!(seg, member_path, member_value)
+        end
+    end
+    return nothing
+end
+
+# Materialize entry `i` of a mapped segment
+function shm_read_entry(seg::SharedSegment, i::Int)
+    entry = GC.@preserve seg unsafe_load(shm_entry_ptr(seg, i))
+    ptr = shm_base(seg) + entry.offset
+    if entry.kind == SHM_KIND_STRUCT
+        type_name = GC.@preserve seg unsafe_string(ptr, entry.length)
+        return SharedInstance(seg, entry_name(entry), type_name)
+    elseif entry.kind == SHM_KIND_STRING
+        return GC.@preserve seg unsafe_string(ptr, entry.length)
+    end
+    T = SHM_ELTYPES[entry.kind & ~SHM_ARRAY_FLAG]
+    if entry.kind & SHM_ARRAY_FLAG != 0
+        return SharedMemoryView{T,1}(Ptr{T}(ptr), (Int(entry.length),), seg)
+    else
+        return GC.@preserve seg unsafe_load(Ptr{T}(ptr))
+    end
+end
+
+function shm_lookup(seg::SharedSegment, name::AbstractString)
+    i = get(seg.index, name, 0)
+    if i == 0
+        # The publisher may have added entries since we last looked
+        refresh_index!(seg)
+        i = get(seg.index, name, 0)
+        i == 0 && error("Entry '$name' not found in shared memory segment '$(seg.name)'")
+    end
+    return shm_read_entry(seg, i)
+end
+
+"""
+    attach(lib::CppLibrary, segment::AbstractString, name::AbstractString)
+
+Attach to data published under `name` in the named shared-memory segment. Arrays are
+returned as read-only zero-copy `SharedMemoryView`s and published structs as
+`SharedInstance`s: read-only views of the published members, not C++ objects.
+For structs, the type must be registered in `lib` with the same data members as in
+the publishing process, which guards against attaching a segment written by another
+version of the library.
+
+# Example
+```julia
+# Publisher process
+seg = Glaze.create_segment("refdata", 1 << 30)
+Glaze.publish!(seg, "tables", Glaze.get_instance(lib, "reference_tables"))
+
+# Worker processes
+tables = Glaze.attach(lib, "refdata", "tables")
+sum(tables.weights)  # reads the publisher's copy, no per-process duplication
+```
+"""
+function attach(lib::CppLibrary, segment::AbstractString, name::AbstractString)
+    value = attach(segment, name)
+    value isa SharedInstance && check_shared_layout(lib, value)
+    return value
+end
+
+# The published members of `si` (recursively) match its type as registered in `lib`
+function check_shared_layout(lib::CppLibrary, si::SharedInstance)
+    type_name = getfield(si, :type_name)
+    info_func = get_cached_function(lib, :glz_get_type_info)
+    info_ptr = @ffi ccall(info_func, Ptr{ConcreteTypeInfo}, (Cstring,), type_name)
+    info_ptr == C_NULL && error("Type '$type_name' of shared entry '$(getfield(si, :path))' is not registered in this library")
+    info = unsafe_load(info_ptr)
+    expected = [Symbol(unsafe_string(m.name)) for m in unsafe_wrap(Array, info.members, info.member_count)
+                if m.kind != UInt8(MEMBER_FUNCTION)]
+    published = propertynames(si)
+    sort(expected) == sort(published) ||
+        error("Shared entry '$(getfield(si, :path))' does not match type '$type_name' in this library: " *
+              "published members $(published), registered members $(expected)")
+    for member in published
+        value = getproperty(si, member)
+        value isa SharedInstance && check_shared_layout(lib, value)
+    end
+    return nothing
+end
+
+attach(segment::AbstractString, name::AbstractString) = shm_lookup(open_segment(segment), name)
+
+# Fields are only read with getfield, so published members may share their names
+Base.getproperty(si::SharedInstance, name::Symbol) =
+    shm_lookup(getfield(si, :segment), shm_member_path(getfield(si, :path), String(name)))
+
+function Base.propertynames(si::SharedInstance)
+    seg = getfield(si, :segment)
+    prefix = getfield(si, :path) * "/"
+    refresh_index!(seg)
+    names = Symbol[]
+    for (entry, i) in sort!(collect(seg.index); by=last)
+        token = entry[(ncodeunits(prefix) + 1):end]
+        if startswith(entry, prefix) && !occursin('/', token)
+            push!(names, Symbol(only(split_json_pointer("/" * token))))
+        end
+    end
+    return names
+end
+
+function Base.show(io::IO, si::SharedInstance)
+    print(io, "SharedInstance(", getfield(si, :type_name), " at \"", getfield(si, :segment).name,
+          "\":", getfield(si, :path), ")")
+end
+
+function Base.show(io::IO, seg::SharedSegment)
+    isopen(seg) || return print(io, "SharedSegment(\"", seg.name, "\", closed)")
+    header = shm_header(seg)
+    print(io, "SharedSegment(\"", seg.name, "\", ", header.entry_count, " entries, ",
+          header.data_end - header.data_offset, "/", header.capacity - header.data_offset, " bytes used",
+          seg.writable ? "" : ", read-only", ")")
+end
+
+export SharedSegment, SharedInstance, SharedMemoryView, create_segment, open_segment, unlink_segment, publish!, attach
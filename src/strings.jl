@@ -1,11 +1,11 @@
 # String wrapper and string operations
 
 # String wrapper implementation
-Base.String(s::CppString) = unsafe_string(ccall(get_cached_function(s.lib, :glz_string_c_str), 
+Base.String(s::CppString) = unsafe_string(@ffi ccall(get_cached_function(s.lib, :glz_string_c_str), 
                                                 Ptr{UInt8}, (Ptr{Cvoid},), s.ptr))
 
 # Required AbstractString interface
-Base.length(s::CppString) = Int(ccall(get_cached_function(s.lib, :glz_string_size), Csize_t, (Ptr{Cvoid},), s.ptr))
+Base.length(s::CppString) = Int(@ffi ccall(get_cached_function(s.lib, :glz_string_size), Csize_t, (Ptr{Cvoid},), s.ptr))
 Base.ncodeunits(s::CppString) = length(s)
 Base.codeunit(s::CppString) = UInt8  # CppString uses UTF-8 encoding like Julia strings
 Base.isvalid(s::CppString, i::Int) = 1 <= i <= ncodeunits(s)
@@ -13,7 +13,7 @@ Base.isvalid(s::CppString, i::Int) = 1 <= i <= ncodeunits(s)
 # Efficient character access without full string conversion
 function Base.codeunit(s::CppString, i::Int)
     @boundscheck checkbounds(s, i)
-    c_str_ptr = ccall(get_cached_function(s.lib, :glz_string_c_str), Ptr{UInt8}, (Ptr{Cvoid},), s.ptr)
+    c_str_ptr = @ffi ccall(get_cached_function(s.lib, :glz_string_c_str), Ptr{UInt8}, (Ptr{Cvoid},), s.ptr)
     unsafe_load(c_str_ptr, i)
 end
 
@@ -41,8 +41,9 @@ Base.contains(s::CppString, substr::AbstractString) = contains(String(s), substr
 
 function Base.setindex!(s::CppString, value::AbstractString)
     set_func = get_cached_function(s.lib, :glz_string_set)
-    ccall(set_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
+    @ffi ccall(set_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
           s.ptr, value, sizeof(value))
+    note_container_write(s.ptr)
 end
 
 # Simplified copy function for CppStruct objects using property access
@@ -153,6 +154,10 @@ function julia_type_from_descriptor(type_desc::Ptr{TypeDescriptor})
             return Float32
         elseif prim_desc.kind == 11
             return Float64
+        elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16
+            return Float16
+        elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16
+            return BFloat16
         else
             error("Unknown primitive type: $(prim_desc.kind)")
         end
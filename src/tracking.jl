@@ -0,0 +1,448 @@
+# Change tracking for incremental synchronization of C++ state
+
+"""
+    MemberChange
+
+A member of a tracked `CppStruct` that was modified after a given epoch.
+
+# Fields
+- `name`: Member name
+- `epoch`: Epoch of the most recent modification
+- `ranges`: Modified element ranges (1-based) for vector members; empty when the
+  whole member must be re-read
+"""
+struct MemberChange
+    name::Symbol
+    epoch::UInt64
+    ranges::Vector{UnitRange{Int}}
+end
+
+# Matches glz_jl_change in cpp_interface/glaze_jl/change_tracking.hpp
+struct NativeChange
+    object::Ptr{Cvoid}   # C_NULL: records were dropped, everything tracked changed
+    member::Ptr{UInt8}
+    first::UInt64
+    count::UInt64
+    epoch::UInt64        # epoch of the mutation, taken from _change_epoch by C++
+end
+
+# glz_jl change-tracking entry points of one library (C_NULL when not exported)
+struct NativeTrackingFuncs
+    drain::Ptr{Cvoid}
+    track::Ptr{Cvoid}
+    untrack::Ptr{Cvoid}
+end
+
+# Per-instance dirty state, indexed by 1-based member index. Extension members
+# follow the regular members, in registration order.
+mutable struct ChangeRecord
+    info::ConcreteTypeInfo
+    lib::Ptr{Cvoid}
+    member_epochs::Vector{UInt64}
+    ranges::Dict{Int, Vector{Tuple{UnitRange{Int}, UInt64}}}
+end
+
+# Ranges kept per member before they are collapsed into a whole-member change
+const MAX_TRACKED_RANGES = 1024
+
+# Global, monotonically increasing change epoch
+const _change_epoch = Threads.Atomic{UInt64}(0)
+
+# Fast-path flag checked by setters so tracking costs nothing until enabled
+const _tracking_active = Ref(false)
+
+const _tracking_lock = ReentrantLock()
+const _tracked_objects = Dict{Ptr{Cvoid}, ChangeRecord}()
+# Address of a tracked vector/string member -> (owner address, member index)
+const _tracked_members = Dict{Ptr{Cvoid}, Tuple{Ptr{Cvoid}, Int}}()
+const _native_tracking_funcs = Dict{Ptr{Cvoid}, NativeTrackingFuncs}()
+
+@inline next_epoch() = Threads.atomic_add!(_change_epoch, UInt64(1)) + UInt64(1)
+
+"""
+    current_epoch() -> UInt64
+
+Return the most recent change epoch. Pass it to `changed_since` later to obtain
+only the members modified after this point.
+"""
+current_epoch() = _change_epoch[]
+
+# Caller holds _tracking_lock
+function native_tracking_funcs(lib::Ptr{Cvoid})
+    get!(_native_tracking_funcs, lib) do
+        sym(name) = something(Libdl.dlsym(lib, name; throw_error=false), C_NULL)
+        NativeTrackingFuncs(sym(:glz_jl_drain_changes), sym(:glz_jl_track_object), sym(:glz_jl_untrack_object))
+    end
+end
+
+"""
+    track_changes!(obj::CppStruct) -> UInt64
+
+Opt `obj` into dirty-field tracking. From now on Glaze setters (`obj.x = ...`),
+vector `setindex!`/`push!`/`resize!` on its vector members, string assignment and
+C++ code calling `glz_jl::mark_dirty` record per-member dirty epochs.
+
+Returns the current epoch, to be passed to `changed_since`.
+
+# Example
+```julia
+epoch = Glaze.track_changes!(state)
+# ... mutations from Julia or C++ ...
+for change in Glaze.changed_since(state, epoch)
+    sync(change.name, change.ranges)
+end
+epoch = Glaze.current_epoch()
+```
+"""
+function track_changes!(obj::CppStruct)
+    obj_ptr = getfield(obj, :ptr)
+    info = getfield(obj, :info)
+    lib = getfield(obj, :lib)
+
+    lock(_tracking_lock) do
+        if !haskey(_tracked_objects, obj_ptr)
+            n = Int(info.member_count)
+            _tracked_objects[obj_ptr] = ChangeRecord(info, lib, zeros(UInt64, n),
+                                                     Dict{Int, Vector{Tuple{UnitRange{Int}, UInt64}}}())
+
+            # Remember where container members live so their wrappers can report writes
+            for i in 1:n
+                member = unsafe_load(info.members, i)
+                member.kind == UInt8(MEMBER_FUNCTION) && continue
+                member.type == C_NULL && continue
+                kind = unsafe_load(Ptr{TypeKind}(member.type))
+                if kind == GLZ_TYPE_VECTOR || kind == GLZ_TYPE_STRING
+                    member_ptr = @ffi ccall(member.getter, Ptr{Cvoid}, (Ptr{Cvoid},), obj_ptr)
+                    _tracked_members[member_ptr] = (obj_ptr, i)
+                end
+            end
+
+            # C++ records glz_jl::mark_dirty calls for tracked objects only, stamped
+            # from the same epoch counter as Julia writes
+            track_func = native_tracking_funcs(lib).track
+            if track_func != C_NULL
+                @ffi ccall(track_func, Cvoid, (Ptr{Cvoid}, Ptr{UInt64}),
+                           obj_ptr, Ptr{UInt64}(pointer_from_objref(_change_epoch)))
+            end
+        end
+        _tracking_active[] = true
+    end
+
+    return current_epoch()
+end
+
+"""
+    untrack_changes!(obj::CppStruct)
+
+Stop tracking `obj` and discard its dirty state. Call this before the underlying
+C++ object is destroyed.
+"""
+function untrack_changes!(obj::CppStruct)
+    lock(() -> untrack_locked!(getfield(obj, :ptr)), _tracking_lock)
+    return nothing
+end
+
+# Caller holds _tracking_lock
+function untrack_locked!(obj_ptr::Ptr{Cvoid})
+    record = pop!(_tracked_objects, obj_ptr, nothing)
+    record === nothing && return nothing
+    untrack_func = native_tracking_funcs(record.lib).untrack
+    untrack_func == C_NULL || @ffi ccall(untrack_func, Cvoid, (Ptr{Cvoid},), obj_ptr)
+    filter!(p -> p.second[1] != obj_ptr, _tracked_members)
+    _tracking_active[] = !Base.isempty(_tracked_objects)
+    return nothing
+end
+
+# Called by the finalizer of owned instances before the C++ object is destroyed,
+# so an object later allocated at the same address starts untracked. Finalizers
+# must not block: returns false when the lock is busy, and the caller retries.
+function untrack_finalized!(obj::CppStruct)
+    trylock(_tracking_lock) || return false
+    try
+        untrack_locked!(getfield(obj, :ptr))
+    finally
+        unlock(_tracking_lock)
+    end
+    return true
+end
+
+"""
+    is_tracked(obj::CppStruct) -> Bool
+
+Check whether dirty-field tracking is enabled for `obj`.
+"""
+is_tracked(obj::CppStruct) = lock(() -> haskey(_tracked_objects, getfield(obj, :ptr)), _tracking_lock)
+
+# Grow the epoch slots for extension members registered after tracking started
+@inline function ensure_member_slot!(record::ChangeRecord, member_index::Int)
+    n = length(record.member_epochs)
+    member_index > n && append!(record.member_epochs, zeros(UInt64, member_index - n))
+    return nothing
+end
+
+# Whole-member change at `epoch`. Ranges recorded later than `epoch` are kept:
+# changed_since reports them when asked about a point after the whole change.
+function record_whole_change!(record::ChangeRecord, member_index::Int, epoch::UInt64)
+    ensure_member_slot!(record, member_index)
+    record.member_epochs[member_index] = max(record.member_epochs[member_index], epoch)
+    ranges = get(record.ranges, member_index, nothing)
+    if ranges !== nothing
+        filter!(r -> last(r) > epoch, ranges)
+        Base.isempty(ranges) && delete!(record.ranges, member_index)
+    end
+    return nothing
+end
+
+# Record a whole-member change; no-op for untracked objects
+function record_member_change!(obj_ptr::Ptr{Cvoid}, member_index::Int)
+    lock(_tracking_lock) do
+        record = get(_tracked_objects, obj_ptr, nothing)
+        record === nothing && return
+        record_whole_change!(record, member_index, next_epoch())
+    end
+    return nothing
+end
+
+# Record a change of the elements `range` at `epoch`. Ranges keep the epoch of
+# their own write, so ranges written at different epochs are never merged;
+# changed_since merges only the ranges it reports.
+function record_range_change!(record::ChangeRecord, member_index::Int, range::UnitRange{Int},
+                              epoch::UInt64=next_epoch())
+    ensure_member_slot!(record, member_index)
+    # Already covered by a later whole-member change
+    epoch <= record.member_epochs[member_index] && return nothing
+
+    ranges = get!(() -> Tuple{UnitRange{Int}, UInt64}[], record.ranges, member_index)
+    if !Base.isempty(ranges)
+        last_range, last_epoch = ranges[end]
+        # Repeated writes to the same elements replace the older record
+        if first(range) <= first(last_range) && last(last_range) <= last(range) && last_epoch <= epoch
+            ranges[end] = (range, epoch)
+            return nothing
+        end
+    end
+    if length(ranges) >= MAX_TRACKED_RANGES
+        # Too fragmented to be useful: report the whole member instead
+        record_whole_change!(record, member_index, max(epoch, maximum(last, ranges)))
+    else
+        push!(ranges, (range, epoch))
+    end
+    return nothing
+end
+
+# Record a write through a container wrapper (vector or string) at `member_ptr`.
+# An empty range marks the whole member, e.g. after a resize.
+function record_container_change!(member_ptr::Ptr{Cvoid}, range::UnitRange{Int}=1:0)
+    lock(_tracking_lock) do
+        owner = get(_tracked_members, member_ptr, nothing)
+        owner === nothing && return
+        obj_ptr, member_index = owner
+        record = _tracked_objects[obj_ptr]
+        if Base.isempty(range)
+            record_whole_change!(record, member_index, next_epoch())
+        else
+            record_range_change!(record, member_index, range)
+        end
+    end
+    return nothing
+end
+
+# Called from the hot container paths; only takes the lock when tracking is enabled
+@inline function note_container_write(member_ptr::Ptr{Cvoid}, range::UnitRange{Int}=1:0)
+    _tracking_active[] && record_container_change!(member_ptr, range)
+    return nothing
+end
+
+function member_index_by_name(info::ConcreteTypeInfo, name::Ptr{UInt8})
+    for i in 1:Int(info.member_count)
+        member = unsafe_load(info.members, i)
+        if ccall(:strcmp, Cint, (Ptr{UInt8}, Ptr{UInt8}), member.name, name) == 0
+            return i
+        end
+    end
+    return 0
+end
+
+function member_index_by_name(info::ConcreteTypeInfo, name::Symbol)
+    GC.@preserve name member_index_by_name(info, Base.unsafe_convert(Ptr{UInt8}, name))
+end
+
+# Extension members that are methods (generators, cancellable methods) hold no data
+function is_data_extension(member::MemberInfo)
+    (member.kind == UInt8(MEMBER_FUNCTION) || member.type == C_NULL) && return false
+    kind = unsafe_load(Ptr{UInt64}(member.type))
+    return kind != GLZ_JL_TYPE_GENERATOR && kind != GLZ_JL_TYPE_CANCELLABLE
+end
+
+# Tracking index of a regular or extension member, 0 when there is none
+function tracked_member_index(lib::Ptr{Cvoid}, info::ConcreteTypeInfo, name::Union{Symbol, Ptr{UInt8}})
+    i = member_index_by_name(info, name)
+    i == 0 || return i
+    extensions = extension_members(lib, info)
+    for k in eachindex(extensions)
+        if ccall(:strcmp, Cint, (Ptr{UInt8}, Ptr{UInt8}), extensions[k].name, name) == 0
+            return Int(info.member_count) + k
+        end
+    end
+    return 0
+end
+
+function tracked_member_name(record::ChangeRecord, member_index::Int)
+    n = Int(record.info.member_count)
+    member = member_index <= n ? unsafe_load(record.info.members, member_index) :
+                                 extension_members(record.lib, record.info)[member_index - n]
+    return Symbol(unsafe_string(member.name))
+end
+
+# Record an assignment to the extension member `member` of `obj`
+function record_extension_change!(obj::CppStruct, member::MemberInfo)
+    info = getfield(obj, :info)
+    extensions = extension_members(getfield(obj, :lib), info)
+    k = findfirst(m -> m.name == member.name, extensions)
+    k === nothing || record_member_change!(getfield(obj, :ptr), Int(info.member_count) + k)
+    return nothing
+end
+
+# Pull records written by glz_jl::mark_dirty in C++. Each carries the epoch of
+# the mutation, so native writes order correctly against Julia writes made
+# before the drain.
+function drain_native_changes!(lib::Ptr{Cvoid})
+    drain_func = native_tracking_funcs(lib).drain
+    drain_func == C_NULL && return nothing
+
+    buffer = Vector{NativeChange}(undef, 256)
+    while true
+        n = Int(@ffi ccall(drain_func, Csize_t, (Ptr{NativeChange}, Csize_t), buffer, length(buffer)))
+        for k in 1:n
+            change = buffer[k]
+            if change.object == C_NULL
+                # C++ dropped records after too many went undrained
+                for record in values(_tracked_objects)
+                    record.lib == lib || continue
+                    n = Int(record.info.member_count)
+                    for i in 1:n
+                        unsafe_load(record.info.members, i).kind == UInt8(MEMBER_FUNCTION) && continue
+                        record_whole_change!(record, i, change.epoch)
+                    end
+                    for (k, member) in enumerate(extension_members(lib, record.info))
+                        is_data_extension(member) && record_whole_change!(record, n + k, change.epoch)
+                    end
+                end
+                continue
+            end
+            record = get(_tracked_objects, change.object, nothing)
+            record === nothing && continue
+            member_index = tracked_member_index(lib, record.info, change.member)
+            member_index == 0 && continue
+            if change.count == 0
+                record_whole_change!(record, member_index, change.epoch)
+            else
+                first_index = Int(change.first) + 1
+                record_range_change!(record, member_index, first_index:(first_index + Int(change.count) - 1), change.epoch)
+            end
+        end
+        n < length(buffer) && break
+    end
+    return nothing
+end
+
+"""
+    mark_changed!(obj::CppStruct, name::Symbol)
+    mark_changed!(obj::CppStruct, name::Symbol, range::UnitRange{Int})
+
+Manually record a modification of member `name` (optionally only the 1-based
+element `range` of a vector member). Use this after writing through an
+`array_view` or raw pointer, which bypass the tracked setters.
+"""
+function mark_changed!(obj::CppStruct, name::Symbol)
+    member_index = tracked_member_index(getfield(obj, :lib), getfield(obj, :info), name)
+    member_index == 0 && error("Member $name not found")
+    record_member_change!(getfield(obj, :ptr), member_index)
+    return obj
+end
+
+function mark_changed!(obj::CppStruct, name::Symbol, range::UnitRange{Int})
+    member_index = tracked_member_index(getfield(obj, :lib), getfield(obj, :info), name)
+    member_index == 0 && error("Member $name not found")
+    lock(_tracking_lock) do
+        record = get(_tracked_objects, getfield(obj, :ptr), nothing)
+        record === nothing || record_range_change!(record, member_index, range)
+    end
+    return obj
+end
+
+# Merge overlapping/adjacent ranges newer than `epoch`
+function merged_ranges(entries::Vector{Tuple{UnitRange{Int}, UInt64}}, epoch::UInt64)
+    recent = sort!([r for (r, e) in entries if e > epoch]; by=first)
+    merged = UnitRange{Int}[]
+    for r in recent
+        if !Base.isempty(merged) && first(r) <= last(merged[end]) + 1
+            merged[end] = first(merged[end]):max(last(r), last(merged[end]))
+        else
+            push!(merged, r)
+        end
+    end
+    return merged
+end
+
+"""
+    changed_since(obj::CppStruct, epoch::Integer) -> Vector{MemberChange}
+
+Return the members of a tracked `obj` modified after `epoch`, in member order.
+Vector members written element-wise report the modified element ranges, so
+synchronization cost is proportional to the volume of change.
+
+Throws if `obj` is not tracked (see `track_changes!`).
+"""
+function changed_since(obj::CppStruct, epoch::Integer)
+    obj_ptr = getfield(obj, :ptr)
+    since = UInt64(epoch)
+
+    lock(_tracking_lock) do
+        record = get(_tracked_objects, obj_ptr, nothing)
+        record === nothing && error("Object is not tracked; call Glaze.track_changes!(obj) first")
+        drain_native_changes!(record.lib)
+
+        changes = MemberChange[]
+        for i in eachindex(record.member_epochs)
+            whole_epoch = record.member_epochs[i]
+            entries = get(record.ranges, i, nothing)
+            range_epoch = entries === nothing || Base.isempty(entries) ? UInt64(0) : maximum(last, entries)
+
+            (whole_epoch > since || range_epoch > since) || continue
+
+            name = tracked_member_name(record, i)
+            if whole_epoch > since
+                # Whole-member changes supersede element ranges
+                push!(changes, MemberChange(name, max(whole_epoch, range_epoch), UnitRange{Int}[]))
+            else
+                push!(changes, MemberChange(name, range_epoch, merged_ranges(entries, since)))
+            end
+        end
+        return changes
+    end
+end
+
+"""
+    clear_changes!(obj::CppStruct)
+
+Forget all recorded modifications of a tracked `obj`.
+"""
+function clear_changes!(obj::CppStruct)
+    lock(_tracking_lock) do
+        record = get(_tracked_objects, getfield(obj, :ptr), nothing)
+        record === nothing && return
+        drain_native_changes!(record.lib)
+        fill!(record.member_epochs, UInt64(0))
+        empty!(record.ranges)
+    end
+    return nothing
+end
+
+function Base.show(io::IO, change::MemberChange)
+    print(io, "MemberChange(", change.name, ", epoch=", change.epoch)
+    Base.isempty(change.ranges) || print(io, ", ranges=", change.ranges)
+    print(io, ")")
+end
+
+export track_changes!, untrack_changes!, changed_since, current_epoch, mark_changed!, MemberChange
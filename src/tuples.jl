@@ -0,0 +1,79 @@
+# std::pair and std::tuple values
+#
+# Pairs and tuples with arithmetic or complex components are described by
+# glz_jl_tuple_desc (see cpp_interface/glaze_jl/tuples.hpp): component kinds and
+# byte offsets. They read as isbits Julia Tuples, with a single load when the
+# C++ layout matches the Julia Tuple's (e.g. std::pair<double, double>), and one
+# load per component otherwise (libstdc++ stores std::tuple components in
+# reverse order).
+
+const GLZ_JL_TYPE_TUPLE = UInt64(71)
+
+# Matches glz_jl_tuple_desc (payload after the descriptor kind)
+struct TupleDesc
+    count::UInt32
+    size::UInt32
+    element_kinds::Ptr{UInt8}
+    offsets::Ptr{UInt64}
+    reserved::Ptr{Cvoid}
+end
+
+@inline tuple_desc(type_desc::Ptr{TypeDescriptor}) =
+    unsafe_load(Ptr{TupleDesc}(Ptr{UInt8}(type_desc) + fieldoffset(ConcreteTypeDescriptor, 2)))
+
+# Julia Tuple type of a layout, and whether it can be loaded in one go
+struct TupleLayout
+    type::DataType
+    offsets::Vector{Int}
+    direct::Bool
+end
+
+const _tuple_layouts = SnapshotDict{Ptr{TypeDescriptor}, TupleLayout}()
+
+function tuple_layout(type_desc::Ptr{TypeDescriptor})
+    get!(_tuple_layouts, type_desc) do
+        desc = tuple_desc(type_desc)
+        n = Int(desc.count)
+        types = ntuple(i -> pointee_element_type(unsafe_load(desc.element_kinds, i)), n)
+        offsets = [Int(unsafe_load(desc.offsets, i)) for i in 1:n]
+        TT = Tuple{types...}
+        direct = sizeof(TT) == desc.size && all(offsets[i] == fieldoffset(TT, i) for i in 1:n)
+        TupleLayout(TT, offsets, direct)
+    end
+end
+
+function tuple_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor})
+    layout = tuple_layout(type_desc)
+    layout.direct && return unsafe_load(Ptr{layout.type}(ptr))
+    return ntuple(length(layout.offsets)) do i
+        unsafe_load(Ptr{fieldtype(layout.type, i)}(ptr + layout.offsets[i]))
+    end
+end
+
+function set_tuple!(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor}, value)
+    layout = tuple_layout(type_desc)
+    (value isa Tuple || value isa Pair) && length(value) == length(layout.offsets) ||
+        error("Cannot assign $(typeof(value)) to a tuple member of type $(layout.type)")
+    converted = convert(layout.type, Tuple(value))
+    if layout.direct
+        unsafe_store!(Ptr{layout.type}(ptr), converted)
+    else
+        for i in 1:length(layout.offsets)
+            unsafe_store!(Ptr{fieldtype(layout.type, i)}(ptr + layout.offsets[i]), converted[i])
+        end
+    end
+    return value
+end
+
+# Tuple layout for a struct-kind return type descriptor, resolved once per descriptor
+# through the names registered with glz_jl::register_tuple_type; C_NULL if none
+const _return_tuple_descs = SnapshotDict{Ptr{TypeDescriptor}, Ptr{TypeDescriptor}}()
+
+function return_tuple_desc(lib_handle::Ptr{Cvoid}, return_type::Ptr{TypeDescriptor})
+    get!(_return_tuple_descs, return_type) do
+        layout_func = Libdl.dlsym(lib_handle, :glz_jl_tuple_layout; throw_error=false)
+        struct_desc = unsafe_load(Ptr{StructDesc}(Ptr{UInt8}(return_type) + fieldoffset(ConcreteTypeDescriptor, 2)))
+        (layout_func === nothing || struct_desc.type_name == C_NULL) && return Ptr{TypeDescriptor}(C_NULL)
+        @ffi ccall(layout_func, Ptr{TypeDescriptor}, (Ptr{UInt8},), struct_desc.type_name)
+    end
+end
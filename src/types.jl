@@ -147,11 +147,13 @@ mutable struct CppSharedFuture
     
     function CppSharedFuture(ptr::Ptr{Cvoid}, lib_handle::Ptr{Cvoid})
         obj = new(ptr, lib_handle)
+        ptr != C_NULL && note_created!(SHARED_FUTURE, 0)
         # Register finalizer to clean up the heap-allocated shared_future
         finalizer(obj) do future
             if future.ptr != C_NULL
-                func = Libdl.dlsym(future.lib_handle, :glz_shared_future_destroy)
-                ccall(func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), future.ptr, C_NULL)
+                func = get_cached_function(future.lib_handle, :glz_shared_future_destroy)
+                @ffi ccall(func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), future.ptr, C_NULL)
+                note_destroyed!(SHARED_FUTURE, 0)
             end
         end
         return obj
@@ -171,8 +173,19 @@ member function that can be invoked with appropriate arguments.
 result = obj.add(5.0)  # Calls the 'add' member function with argument 5.0
 obj.reset()            # Calls the 'reset' member function with no arguments
 ```
+
+`R` is the Julia result type when every parameter and the result are
+primitives (`Nothing` for `void`), and `Any` otherwise. Calls through such a
+wrapper are type-stable and allocation-free, so bind it once for hot loops:
+
+```julia
+add = obj.add
+for x in xs
+    add(x)
+end
+```
 """
-mutable struct CppMemberFunction
+mutable struct CppMemberFunction{R}
     obj_ptr::Ptr{Cvoid}
     member_info::Ptr{MemberInfo}
     lib_handle::Ptr{Cvoid}
@@ -180,6 +193,9 @@ mutable struct CppMemberFunction
     type_name::String
 end
 
+CppMemberFunction(obj_ptr::Ptr{Cvoid}, member_info::Ptr{MemberInfo}, lib_handle::Ptr{Cvoid}, name::String, type_name::String) =
+    CppMemberFunction{method_result_type(member_info)}(obj_ptr, member_info, lib_handle, name, type_name)
+
 """
     CppOptional{T}
 
@@ -236,30 +252,51 @@ mutable struct CppVector
     type_desc::Ptr{TypeDescriptor}
 end
 
-# Specialized vector types for common cases
+# Specialized vector types for common cases. The view function is resolved once
+# per wrapper so element access is a single ccall with no lookups.
 mutable struct CppVectorFloat32
     ptr::Ptr{Cvoid}
     lib::Ptr{Cvoid}
+    view_func::Ptr{Cvoid}
+
+    CppVectorFloat32(ptr::Ptr{Cvoid}, lib::Ptr{Cvoid}) =
+        new(ptr, lib, get_cached_function(lib, :glz_vector_float32_view))
 end
 
 mutable struct CppVectorFloat64
     ptr::Ptr{Cvoid}
     lib::Ptr{Cvoid}
+    view_func::Ptr{Cvoid}
+
+    CppVectorFloat64(ptr::Ptr{Cvoid}, lib::Ptr{Cvoid}) =
+        new(ptr, lib, get_cached_function(lib, :glz_vector_float64_view))
 end
 
 mutable struct CppVectorInt32
     ptr::Ptr{Cvoid}
     lib::Ptr{Cvoid}
+    view_func::Ptr{Cvoid}
+
+    CppVectorInt32(ptr::Ptr{Cvoid}, lib::Ptr{Cvoid}) =
+        new(ptr, lib, get_cached_function(lib, :glz_vector_int32_view))
 end
 
 mutable struct CppVectorComplexF32
     ptr::Ptr{Cvoid}
     lib::Ptr{Cvoid}
+    view_func::Ptr{Cvoid}
+
+    CppVectorComplexF32(ptr::Ptr{Cvoid}, lib::Ptr{Cvoid}) =
+        new(ptr, lib, get_cached_function(lib, :glz_vector_complexf32_view))
 end
 
 mutable struct CppVectorComplexF64
     ptr::Ptr{Cvoid}
     lib::Ptr{Cvoid}
+    view_func::Ptr{Cvoid}
+
+    CppVectorComplexF64(ptr::Ptr{Cvoid}, lib::Ptr{Cvoid}) =
+        new(ptr, lib, get_cached_function(lib, :glz_vector_complexf64_view))
 end
 
 """
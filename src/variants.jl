@@ -12,7 +12,7 @@ idx = index(variant)  # Returns 0, 1, 2, etc.
 """
 function index(v::CppVariant)
     idx_func = get_cached_function(v.lib, :glz_variant_index)
-    idx = ccall(idx_func, UInt64, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
+    idx = @ffi ccall(idx_func, UInt64, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
     if idx == typemax(UInt64)  # Error indicator from C++
         error("Failed to get variant index")
     end
@@ -62,7 +62,7 @@ function holds_alternative(v::CppVariant, index::Integer)
     end
     
     holds_func = get_cached_function(v.lib, :glz_variant_holds_alternative)
-    return ccall(holds_func, Bool, (Ptr{Cvoid}, Ptr{TypeDescriptor}, UInt64), 
+    return @ffi ccall(holds_func, Bool, (Ptr{Cvoid}, Ptr{TypeDescriptor}, UInt64), 
                  v.ptr, v.type_desc, UInt64(index))
 end
 
@@ -84,7 +84,7 @@ function alternative_type(v::CppVariant, index::Integer)
     end
     
     type_func = get_cached_function(v.lib, :glz_variant_type_at_index)
-    type_ptr = ccall(type_func, Ptr{TypeDescriptor}, (Ptr{TypeDescriptor}, UInt64), 
+    type_ptr = @ffi ccall(type_func, Ptr{TypeDescriptor}, (Ptr{TypeDescriptor}, UInt64), 
                      v.type_desc, UInt64(index))
     
     if type_ptr == C_NULL
@@ -115,7 +115,7 @@ end
 function get_value(v::CppVariant)
     # Get pointer to the current value
     get_func = get_cached_function(v.lib, :glz_variant_get)
-    value_ptr = ccall(get_func, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{TypeDescriptor}), 
+    value_ptr = @ffi ccall(get_func, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{TypeDescriptor}), 
                       v.ptr, v.type_desc)
     
     if value_ptr == C_NULL
@@ -160,7 +160,7 @@ function set_value!(v::CppVariant, index::Integer, value)
     
     try
         set_func = get_cached_function(v.lib, :glz_variant_set)
-        success = ccall(set_func, Bool, (Ptr{Cvoid}, Ptr{TypeDescriptor}, UInt64, Ptr{Cvoid}), 
+        success = @ffi ccall(set_func, Bool, (Ptr{Cvoid}, Ptr{TypeDescriptor}, UInt64, Ptr{Cvoid}), 
                        v.ptr, v.type_desc, UInt64(index), value_ptr)
         
         if !success
@@ -168,7 +168,7 @@ function set_value!(v::CppVariant, index::Integer, value)
         end
     finally
         # Clean up temporary value if needed
-        cleanup_variant_value(value_ptr, alt_type_desc, v.lib)
+        cleanup_variant_value(value_ptr, value, alt_type_desc, v.lib)
     end
     
     return nothing
@@ -207,6 +207,10 @@ function convert_variant_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor},
             return unsafe_load(Ptr{Float32}(ptr))
         elseif prim_desc.kind == 11  # Float64
             return unsafe_load(Ptr{Float64}(ptr))
+        elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16  # Float16
+            return unsafe_load(Ptr{Float16}(ptr))
+        elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16  # BFloat16
+            return unsafe_load(Ptr{BFloat16}(ptr))
         else
             error("Unknown primitive type: $(prim_desc.kind)")
         end
@@ -254,7 +258,7 @@ function convert_variant_value(ptr::Ptr{Cvoid}, type_desc::Ptr{TypeDescriptor},
             # Try to resolve by hash
             if struct_desc.type_hash != 0
                 get_type_info_by_hash_func = get_cached_function(lib, :glz_get_type_info_by_hash)
-                info_ptr = ccall(get_type_info_by_hash_func, Ptr{ConcreteTypeInfo}, (UInt64,), struct_desc.type_hash)
+                info_ptr = @ffi ccall(get_type_info_by_hash_func, Ptr{ConcreteTypeInfo}, (UInt64,), struct_desc.type_hash)
                 if info_ptr == C_NULL
                     error("Could not resolve struct type with hash $(struct_desc.type_hash)")
                 end
@@ -288,9 +292,7 @@ function prepare_variant_value(value, type_desc::Ptr{TypeDescriptor}, lib::Ptr{C
     elseif td.index == GLZ_TYPE_STRING
         # Create a temporary C++ string
         if isa(value, AbstractString)
-            create_func = get_cached_function(lib, :glz_create_string)
-            str_ptr = ccall(create_func, Ptr{Cvoid}, (Cstring, Csize_t), value, sizeof(value))
-            return str_ptr
+            return create_temp_string(value, lib)
         else
             error("Expected string value for string alternative")
         end
@@ -310,13 +312,12 @@ function prepare_variant_value(value, type_desc::Ptr{TypeDescriptor}, lib::Ptr{C
 end
 
 # Helper to clean up temporary values
-function cleanup_variant_value(value_ptr, type_desc::Ptr{TypeDescriptor}, lib::Ptr{Cvoid})
+function cleanup_variant_value(value_ptr, value, type_desc::Ptr{TypeDescriptor}, lib::Ptr{Cvoid})
     td = unsafe_load(Ptr{ConcreteTypeDescriptor}(type_desc))
     
     if td.index == GLZ_TYPE_STRING && value_ptr != C_NULL
         # Destroy temporary string
-        destroy_func = get_cached_function(lib, :glz_destroy_string)
-        ccall(destroy_func, Cvoid, (Ptr{Cvoid},), value_ptr)
+        destroy_temp_string(value_ptr, value, lib)
     end
     # Other types don't need cleanup
 end
@@ -524,6 +525,10 @@ function primitive_kind_to_julia_type(kind::UInt64)
         return Float32
     elseif kind == 11
         return Float64
+    elseif kind == PRIMITIVE_KIND_FLOAT16
+        return Float16
+    elseif kind == PRIMITIVE_KIND_BFLOAT16
+        return BFloat16
     else
         return Any
     end
@@ -650,6 +655,9 @@ function type_symbol_to_type(symbol::Symbol)
         :float32 => Float32,
         :float64 => Float64,
         :double => Float64,
+        :float16 => Float16,
+        :half => Float16,
+        :bfloat16 => BFloat16,
         :bool => Bool,
         :string => String,
         :str => String,
@@ -14,7 +14,7 @@ end
 # Vector wrapper implementation for generic CppVector
 function Base.length(v::CppVector)
     view_func = get_cached_function(v.lib, :glz_vector_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
+    view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
     return safe_csize_to_int(view.size)
 end
 
@@ -25,7 +25,7 @@ end
 function Base.getindex(v::CppVector, i::Integer)
     @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
     view_func = get_cached_function(v.lib, :glz_vector_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
+    view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
     
     # Get element type from vector type descriptor
     td = unsafe_load(Ptr{ConcreteTypeDescriptor}(v.type_desc))
@@ -46,7 +46,7 @@ end
 function Base.setindex!(v::CppVector, value, i::Integer)
     @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
     view_func = get_cached_function(v.lib, :glz_vector_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
+    view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
     
     # Get element type from vector type descriptor
     td = unsafe_load(Ptr{ConcreteTypeDescriptor}(v.type_desc))
@@ -62,6 +62,7 @@ function Base.setindex!(v::CppVector, value, i::Integer)
     T = julia_type_from_descriptor(element_ptr)
     typed_ptr = Ptr{T}(view.data)
     unsafe_store!(typed_ptr, T(value), i)
+    note_container_write(v.ptr, Int(i):Int(i))
     return value
 end
 
@@ -75,7 +76,7 @@ end
 function Base.iterate(v::CppVector)
     # Get vector view once
     view_func = get_cached_function(v.lib, :glz_vector_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
+    view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
     
     # Return nothing for empty vectors
     view.size == 0 && return nothing
@@ -105,8 +106,7 @@ end
 # Optimized iterations for specialized vector types
 # CppVectorFloat32
 function Base.iterate(v::CppVectorFloat32)
-    view_func = get_cached_function(v.lib, :glz_vector_float32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     view.size == 0 && return nothing
     
     iter = CppVectorIterator{Float32}(Ptr{Float32}(view.data), safe_csize_to_int(view.size))
@@ -115,8 +115,7 @@ end
 
 # CppVectorFloat64
 function Base.iterate(v::CppVectorFloat64)
-    view_func = get_cached_function(v.lib, :glz_vector_float64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     view.size == 0 && return nothing
     
     iter = CppVectorIterator{Float64}(Ptr{Float64}(view.data), safe_csize_to_int(view.size))
@@ -125,8 +124,7 @@ end
 
 # CppVectorInt32
 function Base.iterate(v::CppVectorInt32)
-    view_func = get_cached_function(v.lib, :glz_vector_int32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     view.size == 0 && return nothing
     
     iter = CppVectorIterator{Int32}(Ptr{Int32}(view.data), safe_csize_to_int(view.size))
@@ -135,8 +133,7 @@ end
 
 # CppVectorComplexF32
 function Base.iterate(v::CppVectorComplexF32)
-    view_func = get_cached_function(v.lib, :glz_vector_complexf32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     view.size == 0 && return nothing
     
     iter = CppVectorIterator{ComplexF32}(Ptr{ComplexF32}(view.data), safe_csize_to_int(view.size))
@@ -145,8 +142,7 @@ end
 
 # CppVectorComplexF64
 function Base.iterate(v::CppVectorComplexF64)
-    view_func = get_cached_function(v.lib, :glz_vector_complexf64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     view.size == 0 && return nothing
     
     iter = CppVectorIterator{ComplexF64}(Ptr{ComplexF64}(view.data), safe_csize_to_int(view.size))
@@ -162,32 +158,27 @@ end
 
 # Length methods for specialized vectors
 function Base.length(v::CppVectorFloat32)
-    view_func = get_cached_function(v.lib, :glz_vector_float32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     return safe_csize_to_int(view.size)
 end
 
 function Base.length(v::CppVectorFloat64)
-    view_func = get_cached_function(v.lib, :glz_vector_float64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     return safe_csize_to_int(view.size)
 end
 
 function Base.length(v::CppVectorInt32)
-    view_func = get_cached_function(v.lib, :glz_vector_int32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     return safe_csize_to_int(view.size)
 end
 
 function Base.length(v::CppVectorComplexF32)
-    view_func = get_cached_function(v.lib, :glz_vector_complexf32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     return safe_csize_to_int(view.size)
 end
 
 function Base.length(v::CppVectorComplexF64)
-    view_func = get_cached_function(v.lib, :glz_vector_complexf64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     return safe_csize_to_int(view.size)
 end
 
@@ -196,78 +187,73 @@ Base.size(v::Union{CppVectorFloat32, CppVectorFloat64, CppVectorInt32, CppVector
 
 # Getindex methods for specialized vectors
 function Base.getindex(v::CppVectorFloat32, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_float32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     return unsafe_load(Ptr{Float32}(view.data), i)
 end
 
 function Base.getindex(v::CppVectorFloat64, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_float64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     return unsafe_load(Ptr{Float64}(view.data), i)
 end
 
 function Base.getindex(v::CppVectorInt32, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_int32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     return unsafe_load(Ptr{Int32}(view.data), i)
 end
 
 function Base.getindex(v::CppVectorComplexF32, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_complexf32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     return unsafe_load(Ptr{ComplexF32}(view.data), i)
 end
 
 function Base.getindex(v::CppVectorComplexF64, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_complexf64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     return unsafe_load(Ptr{ComplexF64}(view.data), i)
 end
 
 # setindex! methods for specialized vectors
 function Base.setindex!(v::CppVectorFloat32, value, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_float32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     unsafe_store!(Ptr{Float32}(view.data), Float32(value), i)
+    note_container_write(v.ptr, Int(i):Int(i))
     return value
 end
 
 function Base.setindex!(v::CppVectorFloat64, value, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_float64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     unsafe_store!(Ptr{Float64}(view.data), Float64(value), i)
+    note_container_write(v.ptr, Int(i):Int(i))
     return value
 end
 
 function Base.setindex!(v::CppVectorInt32, value, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_int32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     unsafe_store!(Ptr{Int32}(view.data), Int32(value), i)
+    note_container_write(v.ptr, Int(i):Int(i))
     return value
 end
 
 function Base.setindex!(v::CppVectorComplexF32, value, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_complexf32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     unsafe_store!(Ptr{ComplexF32}(view.data), ComplexF32(value), i)
+    note_container_write(v.ptr, Int(i):Int(i))
     return value
 end
 
 function Base.setindex!(v::CppVectorComplexF64, value, i::Integer)
-    @boundscheck 1 <= i <= length(v) || throw(BoundsError(v, i))
-    view_func = get_cached_function(v.lib, :glz_vector_complexf64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    @boundscheck 1 <= i <= view.size || throw(BoundsError(v, i))
     unsafe_store!(Ptr{ComplexF64}(view.data), ComplexF64(value), i)
+    note_container_write(v.ptr, Int(i):Int(i))
     return value
 end
 
@@ -284,8 +270,9 @@ Base.IteratorEltype(::Type{<:CppVector}) = Base.HasEltype()
 Base.IteratorSize(::Type{<:Union{CppVectorFloat32, CppVectorFloat64, CppVectorInt32, CppVectorComplexF32, CppVectorComplexF64}}) = Base.HasLength()
 Base.IteratorEltype(::Type{<:Union{CppVectorFloat32, CppVectorFloat64, CppVectorInt32, CppVectorComplexF32, CppVectorComplexF64}}) = Base.HasEltype()
 
-# Zero-copy array view wrapper
-struct CppArrayView{T,N} <: AbstractArray{T,N}
+# Zero-copy array view wrapper over contiguous column-major memory. As a
+# DenseArray it is accepted by BLAS/LAPACK and other StridedArray methods.
+struct CppArrayView{T,N} <: DenseArray{T,N}
     ptr::Ptr{T}
     dims::NTuple{N,Int}
     
@@ -299,38 +286,33 @@ end
 
 # Constructor for 1D views from vectors
 function CppArrayView(v::CppVectorFloat32)
-    view_func = get_cached_function(v.lib, :glz_vector_float32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     CppArrayView{Float32,1}(Ptr{Float32}(view.data), (safe_csize_to_int(view.size),), v)
 end
 
 function CppArrayView(v::CppVectorFloat64)
-    view_func = get_cached_function(v.lib, :glz_vector_float64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     CppArrayView{Float64,1}(Ptr{Float64}(view.data), (safe_csize_to_int(view.size),), v)
 end
 
 function CppArrayView(v::CppVectorInt32)
-    view_func = get_cached_function(v.lib, :glz_vector_int32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     CppArrayView{Int32,1}(Ptr{Int32}(view.data), (safe_csize_to_int(view.size),), v)
 end
 
 function CppArrayView(v::CppVectorComplexF32)
-    view_func = get_cached_function(v.lib, :glz_vector_complexf32_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     CppArrayView{ComplexF32,1}(Ptr{ComplexF32}(view.data), (safe_csize_to_int(view.size),), v)
 end
 
 function CppArrayView(v::CppVectorComplexF64)
-    view_func = get_cached_function(v.lib, :glz_vector_complexf64_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid},), v.ptr)
+    view = @ffi ccall(v.view_func, VectorView, (Ptr{Cvoid},), v.ptr)
     CppArrayView{ComplexF64,1}(Ptr{ComplexF64}(view.data), (safe_csize_to_int(view.size),), v)
 end
 
 function CppArrayView(v::CppVector)
     view_func = get_cached_function(v.lib, :glz_vector_view)
-    view = ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
+    view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), v.ptr, v.type_desc)
     
     # Get element type
     T = eltype(v)
@@ -386,6 +368,84 @@ end
 # Colon indexing
 Base.view(A::CppArrayView, ::Colon) = A
 
+# Dense memory layout
+Base.unsafe_convert(::Type{Ptr{T}}, A::CppArrayView{T}) where T = A.ptr
+Base.elsize(::Type{<:CppArrayView{T}}) where T = sizeof(T)
+Base.strides(A::CppArrayView) = Base.size_to_strides(1, size(A)...)
+
+"""
+    CppStridedView{T,N}
+
+Zero-copy view of C++ memory with arbitrary element strides, as produced by
+`std::mdspan` members with `std::layout_stride`.
+"""
+struct CppStridedView{T,N} <: AbstractArray{T,N}
+    ptr::Ptr{T}
+    dims::NTuple{N,Int}
+    strides::NTuple{N,Int}   # in elements
+
+    # Keep reference to parent to prevent GC
+    parent::Any
+end
+
+Base.size(A::CppStridedView) = A.dims
+Base.strides(A::CppStridedView) = A.strides
+Base.elsize(::Type{<:CppStridedView{T}}) where T = sizeof(T)
+Base.unsafe_convert(::Type{Ptr{T}}, A::CppStridedView{T}) where T = A.ptr
+
+@inline function Base.getindex(A::CppStridedView{T,N}, I::Vararg{Int,N}) where {T,N}
+    @boundscheck checkbounds(A, I...)
+    unsafe_load(A.ptr, 1 + sum(map((i, s) -> (i - 1) * s, I, A.strides)))
+end
+
+@inline function Base.setindex!(A::CppStridedView{T,N}, val, I::Vararg{Int,N}) where {T,N}
+    @boundscheck checkbounds(A, I...)
+    unsafe_store!(A.ptr, convert(T, val), 1 + sum(map((i, s) -> (i - 1) * s, I, A.strides)))
+    val
+end
+
+# View of row-major (C order) memory with C++ extents `dims`: A[i, j, ...] is the
+# C++ element [i-1][j-1]... Two-dimensional views are lazy transposes, which
+# BLAS handles without copying.
+function row_major_view(ptr::Ptr{T}, dims::NTuple{N,Int}, parent) where {T,N}
+    A = CppArrayView{T,N}(ptr, reverse(dims), parent)
+    N == 1 && return A
+    N == 2 && return LinearAlgebra.transpose(A)
+    return PermutedDimsArray(A, ntuple(i -> N + 1 - i, N))
+end
+
+"""
+    reshape_view(v, dims...; order=:column)
+
+Zero-copy N-dimensional view of the contiguous elements of `v` (a Glaze vector or
+`CppArrayView`) with dimensions `dims`. With `order=:column` element `[i, j]` is
+`v[i + (j-1)*dims[1]]` (Julia layout); with `order=:row` it is
+`v[(i-1)*dims[2] + j]` (C layout, as used for images stored row by row).
+
+Like `array_view`, the view is invalidated when the C++ vector reallocates.
+
+# Example
+```julia
+img = reshape_view(obj.pixels, obj.height, obj.width; order=:row)
+img[2, 3]        # pixels[1 * width + 2] in C++
+img * weights    # 2-D views go to BLAS without copying
+```
+"""
+function reshape_view(v, dims::Integer...; order::Symbol=:column)
+    A = v isa CppArrayView ? v : array_view(v)
+    shape = map(Int, dims)
+    prod(shape) == length(A) ||
+        throw(DimensionMismatch("cannot view $(length(A)) elements with dimensions $shape"))
+    if order === :column
+        return CppArrayView{eltype(A),length(shape)}(A.ptr, shape, A.parent)
+    elseif order === :row
+        return row_major_view(A.ptr, shape, A.parent)
+    end
+    throw(ArgumentError("order must be :column or :row, got :$order"))
+end
+
+reshape_view(v, dims::Tuple{Vararg{Integer}}; order::Symbol=:column) = reshape_view(v, dims...; order=order)
+
 # Make CppVector directly support common array operations
 # Direct sum, mean, etc. without creating a view first
 Base.sum(v::Union{CppVectorFloat32, CppVectorFloat64, CppVectorInt32, CppVectorComplexF32, CppVectorComplexF64}) = sum(array_view(v))
@@ -394,6 +454,13 @@ Base.minimum(v::Union{CppVectorFloat32, CppVectorFloat64, CppVectorInt32}) = min
 
 # Import Statistics functions if available
 function __init__()
+    # Per-thread scratch for primitive member calls
+    nthreads = isdefined(Threads, :maxthreadid) ? Threads.maxthreadid() : Threads.nthreads()
+    empty!(_call_scratch)
+    for _ in 1:nthreads
+        push!(_call_scratch, CallScratch())
+    end
+
     # Try to extend Statistics functions if the package is loaded
     @eval begin
         if isdefined(Main, :Statistics)
@@ -453,66 +520,76 @@ end
 function Base.push!(v::CppVectorFloat32, value)
     push_func = get_cached_function(v.lib, :glz_vector_float32_push_back)
     val = Float32(value)
-    ccall(push_func, Cvoid, (Ptr{Cvoid}, Cfloat), v.ptr, val)
+    @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cfloat), v.ptr, val)
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.push!(v::CppVectorFloat64, value)
     push_func = get_cached_function(v.lib, :glz_vector_float64_push_back)
     val = Float64(value)
-    ccall(push_func, Cvoid, (Ptr{Cvoid}, Cdouble), v.ptr, val)
+    @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cdouble), v.ptr, val)
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.push!(v::CppVectorInt32, value)
     push_func = get_cached_function(v.lib, :glz_vector_int32_push_back)
     val = Int32(value)
-    ccall(push_func, Cvoid, (Ptr{Cvoid}, Cint), v.ptr, val)
+    @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cint), v.ptr, val)
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.push!(v::CppVectorComplexF32, value)
     push_func = get_cached_function(v.lib, :glz_vector_complexf32_push_back)
     val = ComplexF32(value)
-    ccall(push_func, Cvoid, (Ptr{Cvoid}, Cfloat, Cfloat), v.ptr, real(val), imag(val))
+    @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cfloat, Cfloat), v.ptr, real(val), imag(val))
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.push!(v::CppVectorComplexF64, value)
     push_func = get_cached_function(v.lib, :glz_vector_complexf64_push_back)
     val = ComplexF64(value)
-    ccall(push_func, Cvoid, (Ptr{Cvoid}, Cdouble, Cdouble), v.ptr, real(val), imag(val))
+    @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cdouble, Cdouble), v.ptr, real(val), imag(val))
+    note_container_write(v.ptr)
     return v
 end
 
 # resize! methods for specialized vectors
 function Base.resize!(v::CppVectorFloat32, n::Integer)
     resize_func = get_cached_function(v.lib, :glz_vector_float32_resize)
-    ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    @ffi ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.resize!(v::CppVectorFloat64, n::Integer)
     resize_func = get_cached_function(v.lib, :glz_vector_float64_resize)
-    ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    @ffi ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.resize!(v::CppVectorInt32, n::Integer)
     resize_func = get_cached_function(v.lib, :glz_vector_int32_resize)
-    ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    @ffi ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.resize!(v::CppVectorComplexF32, n::Integer)
     resize_func = get_cached_function(v.lib, :glz_vector_complexf32_resize)
-    ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    @ffi ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.resize!(v::CppVectorComplexF64, n::Integer)
     resize_func = get_cached_function(v.lib, :glz_vector_complexf64_resize)
-    ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    @ffi ccall(resize_func, Cvoid, (Ptr{Cvoid}, Csize_t), v.ptr, n)
+    note_container_write(v.ptr)
     return v
 end
 
@@ -531,15 +608,17 @@ function Base.push!(v::CppVector, value)
     
     T = julia_type_from_descriptor(element_ptr)
     val = T(value)
-    ccall(push_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}, Ptr{Cvoid}), 
+    @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}, Ptr{Cvoid}), 
           v.ptr, v.type_desc, Ref(val))
+    note_container_write(v.ptr)
     return v
 end
 
 function Base.resize!(v::CppVector, n::Integer)
     resize_func = get_cached_function(v.lib, :glz_vector_resize)
-    ccall(resize_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}, Csize_t), 
+    @ffi ccall(resize_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}, Csize_t), 
           v.ptr, v.type_desc, n)
+    note_container_write(v.ptr)
     return v
 end
 
@@ -565,14 +644,14 @@ println(person.name)  # Direct field access
 function get_instance(lib::CppLibrary, instance_name::String)
     # Get instance pointer
     get_instance_func = get_cached_function(lib, :glz_get_instance)
-    ptr = ccall(get_instance_func, Ptr{Cvoid}, (Cstring,), instance_name)
+    ptr = @ffi ccall(get_instance_func, Ptr{Cvoid}, (Cstring,), instance_name)
     if ptr == C_NULL
         error("Instance '$instance_name' not found")
     end
     
     # Get instance type name
     get_type_func = get_cached_function(lib, :glz_get_instance_type)
-    type_name_ptr = ccall(get_type_func, Cstring, (Cstring,), instance_name)
+    type_name_ptr = @ffi ccall(get_type_func, Cstring, (Cstring,), instance_name)
     if type_name_ptr == C_NULL
         error("Could not get type for instance '$instance_name'")
     end
@@ -580,7 +659,7 @@ function get_instance(lib::CppLibrary, instance_name::String)
     
     # Get type info
     info_func = get_cached_function(lib, :glz_get_type_info)
-    info_ptr = ccall(info_func, Ptr{ConcreteTypeInfo}, (Cstring,), type_name)
+    info_ptr = @ffi ccall(info_func, Ptr{ConcreteTypeInfo}, (Cstring,), type_name)
     if info_ptr == C_NULL
         error("Type '$type_name' not registered")
     end
@@ -604,7 +683,7 @@ end
 function _has_value(opt::CppOptional{T}) where T
     # Call the C++ interface function with element type descriptor
     has_value_func = get_cached_function(opt.lib, :glz_optional_has_value)
-    return ccall(has_value_func, Bool, (Ptr{Cvoid}, Ptr{TypeDescriptor}), opt.ptr, opt.element_type_desc)
+    return @ffi ccall(has_value_func, Bool, (Ptr{Cvoid}, Ptr{TypeDescriptor}), opt.ptr, opt.element_type_desc)
 end
 
 # Deprecated - use !isnothing(opt) instead
@@ -647,7 +726,7 @@ function value(opt::CppOptional{T}) where T
     
     # Get the value from the optional with element type descriptor
     get_value_func = get_cached_function(opt.lib, :glz_optional_get_value)
-    value_ptr = ccall(get_value_func, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{TypeDescriptor}), opt.ptr, opt.element_type_desc)
+    value_ptr = @ffi ccall(get_value_func, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{TypeDescriptor}), opt.ptr, opt.element_type_desc)
     
     if value_ptr == C_NULL
         error("Failed to get value from optional")
@@ -733,13 +812,13 @@ function set_value!(opt::CppOptional{T}, val::T) where T
     if T == String
         # For strings, use the special string setter function
         set_string_func = get_cached_function(opt.lib, :glz_optional_set_string_value)
-        ccall(set_string_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
-              opt.ptr, val, length(val))
+        @ffi ccall(set_string_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
+              opt.ptr, val, sizeof(val))
     else
         # For other types, use the generic setter
         set_value_func = get_cached_function(opt.lib, :glz_optional_set_value)
         val_ref = Ref(val)
-        ccall(set_value_func, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}, Ptr{TypeDescriptor}), 
+        @ffi ccall(set_value_func, Cvoid, (Ptr{Cvoid}, Ptr{Cvoid}, Ptr{TypeDescriptor}), 
               opt.ptr, val_ref, opt.element_type_desc)
     end
     return nothing
@@ -756,7 +835,7 @@ Reset the optional to empty state (remove any contained value).
 function reset!(opt::CppOptional{T}) where T
     # Reset the optional with element type descriptor
     reset_func = get_cached_function(opt.lib, :glz_optional_reset)
-    ccall(reset_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), opt.ptr, opt.element_type_desc)
+    @ffi ccall(reset_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), opt.ptr, opt.element_type_desc)
     return nothing
 end
 
@@ -800,39 +879,76 @@ function create_optional_wrapper(ptr::Ptr{Cvoid}, lib_handle::Ptr{Cvoid}, elemen
     return CppOptional{T}(ptr, lib_handle, element_type_desc)
 end
 
-# Helper function to destroy temporary C++ vectors
-function destroy_temp_vector(vec_ptr::Ptr{Cvoid}, T::Type, lib_handle::Ptr{Cvoid})
+# Helper function to destroy a temporary C++ vector made by create_temp_vector(julia_vec)
+function destroy_temp_vector(vec_ptr::Ptr{Cvoid}, julia_vec::AbstractVector, lib_handle::Ptr{Cvoid})
+    T = eltype(julia_vec)
     if T <: Integer
         # Int32 vector
         destroy_func = get_cached_function(lib_handle, :glz_destroy_vector)
         desc = create_vector_descriptor(create_primitive_descriptor(Int32))
-        ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
+        @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
     elseif T == Float32
         destroy_func = get_cached_function(lib_handle, :glz_destroy_vector)
         desc = create_vector_descriptor(create_primitive_descriptor(Float32))
-        ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
+        @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
+    elseif T === Float16 || T === BFloat16
+        destroy_func = get_cached_function(lib_handle, :glz_destroy_vector)
+        desc = create_vector_descriptor(create_primitive_descriptor(T))
+        @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
     elseif T <: AbstractFloat
         destroy_func = get_cached_function(lib_handle, :glz_destroy_vector)
         desc = create_vector_descriptor(create_primitive_descriptor(Float64))
-        ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
+        @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
     elseif T <: AbstractString
         destroy_func = get_cached_function(lib_handle, :glz_destroy_vector)
         # Create string descriptor
         str_key = hash((GLZ_TYPE_STRING,))
-        if !haskey(_descriptor_storage, str_key)
-            str_desc = ConcreteTypeDescriptor(GLZ_TYPE_STRING, ntuple(i -> 0x00, 32))
-            str_container = Ref(str_desc)
-            _descriptor_storage[str_key] = str_container
+        str_container = get!(_descriptor_storage, str_key) do
+            Ref(ConcreteTypeDescriptor(GLZ_TYPE_STRING, ntuple(i -> 0x00, 32)))
         end
-        str_ptr = Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, _descriptor_storage[str_key])
+        str_ptr = Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, str_container)
         desc = create_vector_descriptor(str_ptr)
-        ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
+        @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
     elseif T <: Complex{Float32}
         destroy_func = get_cached_function(lib_handle, :glz_destroy_vector)
         elem_desc = create_complex_descriptor(Float32)
         desc = create_vector_descriptor(elem_desc)
-        ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
+        @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
+    elseif T <: Complex{Float64}
+        destroy_func = get_cached_function(lib_handle, :glz_destroy_vector)
+        elem_desc = create_complex_descriptor(Float64)
+        desc = create_vector_descriptor(elem_desc)
+        @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, desc)
     end
+    note_destroyed!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
+end
+
+# Payload bytes of the C++ vector create_temp_vector makes for `v`
+function temp_vector_bytes(v::AbstractVector)
+    T = eltype(v)
+    T <: AbstractString && return sum(sizeof, v; init=0)
+    elsize = if T <: Integer || T === Float32
+        4
+    elseif T === Float16 || T === BFloat16
+        2
+    elseif T <: AbstractFloat || T <: Complex{Float32}
+        8
+    elseif T <: Complex{Float64}
+        16
+    else
+        0
+    end
+    return length(v) * elsize
+end
+
+# Copy the elements of a C++ vector with isbits element type T into a Julia Vector
+function copy_vector_elements(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeDescriptor}, T::Type, lib_handle::Ptr{Cvoid})
+    isbitstype(T) || error("Unsupported vector element type: $T")
+    view_func = get_cached_function(lib_handle, :glz_vector_view)
+    vec_view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, vec_type_desc_ptr)
+    result = Vector{T}(undef, vec_view.size)
+    unsafe_copyto!(pointer(result), Ptr{T}(vec_view.data), vec_view.size)
+    return result
 end
 
 # Helper function to extract vector data immediately before destruction
@@ -848,22 +964,25 @@ function extract_vector_data(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeDes
         
         if prim_desc.kind == 4  # Int32
             view_func = get_cached_function(lib_handle, :glz_vector_int32_view)
-            vec_view = ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
+            vec_view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
             result = Vector{Int32}(undef, vec_view.size)
             unsafe_copyto!(pointer(result), Ptr{Int32}(vec_view.data), vec_view.size)
             return result
         elseif prim_desc.kind == 10  # Float32
             view_func = get_cached_function(lib_handle, :glz_vector_float32_view)
-            vec_view = ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
+            vec_view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
             result = Vector{Float32}(undef, vec_view.size)
             unsafe_copyto!(pointer(result), Ptr{Float32}(vec_view.data), vec_view.size)
             return result
         elseif prim_desc.kind == 11  # Float64
             view_func = get_cached_function(lib_handle, :glz_vector_float64_view)
-            vec_view = ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
+            vec_view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
             result = Vector{Float64}(undef, vec_view.size)
             unsafe_copyto!(pointer(result), Ptr{Float64}(vec_view.data), vec_view.size)
             return result
+        else
+            # Other primitive kinds (e.g. Float16, BFloat16) through the generic view
+            return copy_vector_elements(vec_ptr, vec_type_desc_ptr, primitive_kind_to_julia_type(prim_desc.kind), lib_handle)
         end
     elseif elem_type_desc.index == GLZ_TYPE_COMPLEX
         complex_desc_ptr = vec_desc.element_type + fieldoffset(ConcreteTypeDescriptor, 2)
@@ -871,13 +990,13 @@ function extract_vector_data(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeDes
         
         if complex_desc.kind == 0  # ComplexF32
             view_func = get_cached_function(lib_handle, :glz_vector_complexf32_view)
-            vec_view = ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
+            vec_view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
             result = Vector{ComplexF32}(undef, vec_view.size)
             unsafe_copyto!(pointer(result), Ptr{ComplexF32}(vec_view.data), vec_view.size)
             return result
         else  # ComplexF64
             view_func = get_cached_function(lib_handle, :glz_vector_complexf64_view)
-            vec_view = ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
+            vec_view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid},), vec_ptr)
             result = Vector{ComplexF64}(undef, vec_view.size)
             unsafe_copyto!(pointer(result), Ptr{ComplexF64}(vec_view.data), vec_view.size)
             return result
@@ -891,7 +1010,7 @@ function extract_vector_data(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeDes
     return Int32[]
 end
 
-# extract_pair_data removed - pairs are now handled as structs with first/second members
+# extract_pair_data removed - pairs and tuples are read through their tuple layout (see tuples.jl)
 
 # Helper function to convert C++ vector results to Julia arrays
 function convert_vector_result(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeDescriptor}, lib_handle::Ptr{Cvoid})
@@ -911,8 +1030,8 @@ function convert_vector_result(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeD
         
         if prim_desc.kind == 4  # Int32
             # Use specialized int32 view function
-            view_func_int32 = Libdl.dlsym(lib_handle, :glz_vector_int32_view)
-            view_int32 = ccall(view_func_int32, VectorView, (Ptr{Cvoid},), vec_ptr)
+            view_func_int32 = get_cached_function(lib_handle, :glz_vector_int32_view)
+            view_int32 = @ffi ccall(view_func_int32, VectorView, (Ptr{Cvoid},), vec_ptr)
             
             # Copy data to Julia array
             result = Vector{Int32}(undef, view_int32.size)
@@ -920,20 +1039,22 @@ function convert_vector_result(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeD
             return result
         elseif prim_desc.kind == 10  # Float32
             # Use specialized float32 view function
-            view_func_float32 = Libdl.dlsym(lib_handle, :glz_vector_float32_view)
-            view_float32 = ccall(view_func_float32, VectorView, (Ptr{Cvoid},), vec_ptr)
+            view_func_float32 = get_cached_function(lib_handle, :glz_vector_float32_view)
+            view_float32 = @ffi ccall(view_func_float32, VectorView, (Ptr{Cvoid},), vec_ptr)
             
             result = Vector{Float32}(undef, view_float32.size)
             unsafe_copyto!(pointer(result), Ptr{Float32}(view_float32.data), view_float32.size)
             return result
         elseif prim_desc.kind == 11  # Float64
             # Use specialized float64 view function
-            view_func_float64 = Libdl.dlsym(lib_handle, :glz_vector_float64_view)
-            view_float64 = ccall(view_func_float64, VectorView, (Ptr{Cvoid},), vec_ptr)
+            view_func_float64 = get_cached_function(lib_handle, :glz_vector_float64_view)
+            view_float64 = @ffi ccall(view_func_float64, VectorView, (Ptr{Cvoid},), vec_ptr)
             
             result = Vector{Float64}(undef, view_float64.size)
             unsafe_copyto!(pointer(result), Ptr{Float64}(view_float64.data), view_float64.size)
             return result
+        else
+            return copy_vector_elements(vec_ptr, vec_type_desc_ptr, primitive_kind_to_julia_type(prim_desc.kind), lib_handle)
         end
     elseif elem_type_desc.index == GLZ_TYPE_STRING
         # Handle string vector
@@ -946,16 +1067,16 @@ function convert_vector_result(vec_ptr::Ptr{Cvoid}, vec_type_desc_ptr::Ptr{TypeD
         
         if complex_desc.kind == 0  # Float complex
             # Use specialized complex float32 view function
-            view_func_cf32 = Libdl.dlsym(lib_handle, :glz_vector_complexf32_view)
-            view_cf32 = ccall(view_func_cf32, VectorView, (Ptr{Cvoid},), vec_ptr)
+            view_func_cf32 = get_cached_function(lib_handle, :glz_vector_complexf32_view)
+            view_cf32 = @ffi ccall(view_func_cf32, VectorView, (Ptr{Cvoid},), vec_ptr)
             
             result = Vector{ComplexF32}(undef, view_cf32.size)
             unsafe_copyto!(pointer(result), Ptr{ComplexF32}(view_cf32.data), view_cf32.size)
             return result
         else  # Double complex
             # Use specialized complex float64 view function
-            view_func_cf64 = Libdl.dlsym(lib_handle, :glz_vector_complexf64_view)
-            view_cf64 = ccall(view_func_cf64, VectorView, (Ptr{Cvoid},), vec_ptr)
+            view_func_cf64 = get_cached_function(lib_handle, :glz_vector_complexf64_view)
+            view_cf64 = @ffi ccall(view_func_cf64, VectorView, (Ptr{Cvoid},), vec_ptr)
             
             result = Vector{ComplexF64}(undef, view_cf64.size)
             unsafe_copyto!(pointer(result), Ptr{ComplexF64}(view_cf64.data), view_cf64.size)
@@ -969,91 +1090,132 @@ end
 
 # Helper function to create temporary C++ string from Julia string
 function create_temp_string(julia_str::AbstractString, lib_handle::Ptr{Cvoid})
-    create_func = Libdl.dlsym(lib_handle, :glz_create_string)
+    create_func = get_cached_function(lib_handle, :glz_create_string)
     str_data = String(julia_str)  # Ensure it's a concrete String
-    str_ptr = ccall(create_func, Ptr{Cvoid}, (Ptr{UInt8}, Csize_t), 
-                    pointer(str_data), length(str_data))
+    str_ptr = GC.@preserve str_data @ffi ccall(create_func, Ptr{Cvoid}, (Ptr{UInt8}, Csize_t), 
+                    pointer(str_data), sizeof(str_data))
+    note_created!(TEMP_STRING, sizeof(str_data))
     return str_ptr
 end
 
+# Helper function to destroy a temporary C++ string made by create_temp_string(julia_str)
+function destroy_temp_string(str_ptr::Ptr{Cvoid}, julia_str::AbstractString, lib_handle::Ptr{Cvoid})
+    destroy_func = get_cached_function(lib_handle, :glz_destroy_string)
+    @ffi ccall(destroy_func, Cvoid, (Ptr{Cvoid},), str_ptr)
+    note_destroyed!(TEMP_STRING, sizeof(julia_str))
+end
+
+# Release the C++ strings and vectors made for member-function arguments
+function release_temporaries!(temporaries::Vector{Tuple{Ptr{Cvoid}, Any}}, lib_handle::Ptr{Cvoid})
+    for (ptr, arg) in temporaries
+        if arg isa AbstractString
+            destroy_temp_string(ptr, arg, lib_handle)
+        else
+            destroy_temp_vector(ptr, arg, lib_handle)
+        end
+    end
+    empty!(temporaries)
+    return nothing
+end
+
 # Helper function to create temporary C++ vectors from Julia arrays
 function create_temp_vector(julia_vec::AbstractVector, lib_handle::Ptr{Cvoid})
     T = eltype(julia_vec)
     
     if T <: Integer
         # Convert to Int32 for C++ compatibility
-        create_func = Libdl.dlsym(lib_handle, :glz_create_vector_int32)
-        vec_ptr = ccall(create_func, Ptr{Cvoid}, ())
+        create_func = get_cached_function(lib_handle, :glz_create_vector_int32)
+        vec_ptr = @ffi ccall(create_func, Ptr{Cvoid}, ())
         
         # Copy data
         int32_data = Int32.(julia_vec)
-        set_func = Libdl.dlsym(lib_handle, :glz_vector_int32_set_data)
-        ccall(set_func, Cvoid, (Ptr{Cvoid}, Ptr{Int32}, Csize_t), 
+        set_func = get_cached_function(lib_handle, :glz_vector_int32_set_data)
+        @ffi ccall(set_func, Cvoid, (Ptr{Cvoid}, Ptr{Int32}, Csize_t), 
               vec_ptr, int32_data, length(int32_data))
         
+        note_created!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
         return vec_ptr
     elseif T == Float32
-        create_func = Libdl.dlsym(lib_handle, :glz_create_vector_float32)
-        vec_ptr = ccall(create_func, Ptr{Cvoid}, ())
+        create_func = get_cached_function(lib_handle, :glz_create_vector_float32)
+        vec_ptr = @ffi ccall(create_func, Ptr{Cvoid}, ())
         
-        set_func = Libdl.dlsym(lib_handle, :glz_vector_float32_set_data)
-        ccall(set_func, Cvoid, (Ptr{Cvoid}, Ptr{Float32}, Csize_t), 
+        set_func = get_cached_function(lib_handle, :glz_vector_float32_set_data)
+        @ffi ccall(set_func, Cvoid, (Ptr{Cvoid}, Ptr{Float32}, Csize_t), 
               vec_ptr, julia_vec, length(julia_vec))
         
+        note_created!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
+        return vec_ptr
+    elseif T === Float16 || T === BFloat16
+        # Half-precision vectors keep their element type: fill through the generic view
+        vec_desc = create_vector_descriptor(create_primitive_descriptor(T))
+        create_func = get_cached_function(lib_handle, :glz_create_vector)
+        vec_ptr = @ffi ccall(create_func, Ptr{Cvoid}, (Ptr{TypeDescriptor},), vec_desc)
+        
+        resize_func = get_cached_function(lib_handle, :glz_vector_resize)
+        @ffi ccall(resize_func, Cvoid, (Ptr{Cvoid}, Ptr{TypeDescriptor}, Csize_t), vec_ptr, vec_desc, length(julia_vec))
+        view_func = get_cached_function(lib_handle, :glz_vector_view)
+        vec_view = @ffi ccall(view_func, VectorView, (Ptr{Cvoid}, Ptr{TypeDescriptor}), vec_ptr, vec_desc)
+        copyto!(unsafe_wrap(Array, Ptr{T}(vec_view.data), length(julia_vec)), julia_vec)
+        
+        note_created!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
         return vec_ptr
     elseif T <: AbstractFloat
         # Convert to Float64 for C++ compatibility
-        create_func = Libdl.dlsym(lib_handle, :glz_create_vector_float64)
-        vec_ptr = ccall(create_func, Ptr{Cvoid}, ())
+        create_func = get_cached_function(lib_handle, :glz_create_vector_float64)
+        vec_ptr = @ffi ccall(create_func, Ptr{Cvoid}, ())
         
         float64_data = Float64.(julia_vec)
-        set_func = Libdl.dlsym(lib_handle, :glz_vector_float64_set_data)
-        ccall(set_func, Cvoid, (Ptr{Cvoid}, Ptr{Float64}, Csize_t), 
+        set_func = get_cached_function(lib_handle, :glz_vector_float64_set_data)
+        @ffi ccall(set_func, Cvoid, (Ptr{Cvoid}, Ptr{Float64}, Csize_t), 
               vec_ptr, float64_data, length(float64_data))
         
+        note_created!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
         return vec_ptr
     elseif T <: AbstractString
-        create_func = Libdl.dlsym(lib_handle, :glz_create_vector_string)
-        vec_ptr = ccall(create_func, Ptr{Cvoid}, ())
+        create_func = get_cached_function(lib_handle, :glz_create_vector_string)
+        vec_ptr = @ffi ccall(create_func, Ptr{Cvoid}, ())
         
-        push_func = Libdl.dlsym(lib_handle, :glz_vector_string_push_back)
+        push_func = get_cached_function(lib_handle, :glz_vector_string_push_back)
         for str in julia_vec
-            ccall(push_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
-                  vec_ptr, str, length(str))
+            @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cstring, Csize_t), 
+                  vec_ptr, str, sizeof(str))
         end
         
+        note_created!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
         return vec_ptr
     elseif T <: Complex{Float32}
         # Create vector descriptor for complex float
         elem_desc = create_complex_descriptor(Float32)
         vec_desc = create_vector_descriptor(elem_desc)
         
-        create_func = Libdl.dlsym(lib_handle, :glz_create_vector)
-        vec_ptr = ccall(create_func, Ptr{Cvoid}, (Ptr{TypeDescriptor},), vec_desc)
+        create_func = get_cached_function(lib_handle, :glz_create_vector)
+        vec_ptr = @ffi ccall(create_func, Ptr{Cvoid}, (Ptr{TypeDescriptor},), vec_desc)
         
         # Push complex values one by one
-        push_func = Libdl.dlsym(lib_handle, :glz_vector_complexf32_push_back)
+        push_func = get_cached_function(lib_handle, :glz_vector_complexf32_push_back)
         for c in julia_vec
-            ccall(push_func, Cvoid, (Ptr{Cvoid}, Cfloat, Cfloat), 
+            @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cfloat, Cfloat), 
                   vec_ptr, real(c), imag(c))
         end
         
+        note_created!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
         return vec_ptr
     elseif T <: Complex{Float64}
         # Create vector descriptor for complex double
         elem_desc = create_complex_descriptor(Float64)
         vec_desc = create_vector_descriptor(elem_desc)
         
-        create_func = Libdl.dlsym(lib_handle, :glz_create_vector)
-        vec_ptr = ccall(create_func, Ptr{Cvoid}, (Ptr{TypeDescriptor},), vec_desc)
+        create_func = get_cached_function(lib_handle, :glz_create_vector)
+        vec_ptr = @ffi ccall(create_func, Ptr{Cvoid}, (Ptr{TypeDescriptor},), vec_desc)
         
         # Push complex values one by one
-        push_func = Libdl.dlsym(lib_handle, :glz_vector_complexf64_push_back)
+        push_func = get_cached_function(lib_handle, :glz_vector_complexf64_push_back)
         for c in julia_vec
-            ccall(push_func, Cvoid, (Ptr{Cvoid}, Cdouble, Cdouble), 
+            @ffi ccall(push_func, Cvoid, (Ptr{Cvoid}, Cdouble, Cdouble), 
                   vec_ptr, real(c), imag(c))
         end
         
+        note_created!(TEMP_VECTOR, temp_vector_bytes(julia_vec))
         return vec_ptr
     else
         error("Unsupported vector element type: $T")
@@ -1062,27 +1224,26 @@ end
 
 # Helper to create type descriptors  
 # Note: These descriptors need to be kept alive for the duration of their use
-const _descriptor_storage = Dict{UInt64, Any}()
+const _descriptor_storage = SnapshotDict{UInt64, RefValue{ConcreteTypeDescriptor}}()
 
 # Cache for vector sizes and alignments to avoid repeated FFI calls
-const _vector_size_cache = Dict{Symbol, Tuple{Csize_t, Csize_t}}()
+const _vector_size_cache = SnapshotDict{Symbol, Tuple{Csize_t, Csize_t}}()
 
 # Get size and alignment for a vector type
 function get_vector_size_info(element_type::Symbol, lib_handle::Ptr{Cvoid})
     # Check cache first
-    if haskey(_vector_size_cache, element_type)
-        return _vector_size_cache[element_type]
-    end
+    cached = get(_vector_size_cache, element_type, nothing)
+    cached === nothing || return cached
     
     # Query from C++
     sizeof_name = Symbol("glz_sizeof_vector_", element_type)
     alignof_name = Symbol("glz_alignof_vector_", element_type)
     
-    sizeof_func = Libdl.dlsym(lib_handle, sizeof_name)
-    alignof_func = Libdl.dlsym(lib_handle, alignof_name)
+    sizeof_func = get_cached_function(lib_handle, sizeof_name)
+    alignof_func = get_cached_function(lib_handle, alignof_name)
     
-    vec_size = ccall(sizeof_func, Csize_t, ())
-    vec_align = ccall(alignof_func, Csize_t, ())
+    vec_size = @ffi ccall(sizeof_func, Csize_t, ())
+    vec_align = @ffi ccall(alignof_func, Csize_t, ())
     
     # Cache the result
     _vector_size_cache[element_type] = (vec_size, vec_align)
@@ -1112,26 +1273,16 @@ function create_primitive_descriptor(T::Type)
     key = hash((GLZ_TYPE_PRIMITIVE, T))
     
     # Check if we already have this descriptor
-    if haskey(_descriptor_storage, key)
-        return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, _descriptor_storage[key])
-    end
+    stored = get(_descriptor_storage, key, nothing)
+    stored === nothing || return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, stored)
     
     # Create new descriptor with proper initialization
     desc = ConcreteTypeDescriptor(GLZ_TYPE_PRIMITIVE, ntuple(i -> 0x00, 32))
     
     # Create and store primitive descriptor (now using UInt64)
-    prim = PrimitiveDesc(UInt64(0))
-    if T == Bool
-        prim = PrimitiveDesc(UInt64(1))
-    elseif T == Int32
-        prim = PrimitiveDesc(UInt64(4))
-    elseif T == Float32
-        prim = PrimitiveDesc(UInt64(10))
-    elseif T == Float64
-        prim = PrimitiveDesc(UInt64(11))
-    else
-        error("Unsupported primitive type: $T")
-    end
+    kind = julia_type_to_primitive_kind(T)
+    kind === nothing && error("Unsupported primitive type: $T")
+    prim = PrimitiveDesc(kind)
     
     # Store the descriptor in a stable location
     desc_container = Ref(desc)
@@ -1139,10 +1290,10 @@ function create_primitive_descriptor(T::Type)
     prim_ptr = desc_ptr + fieldoffset(ConcreteTypeDescriptor, 2)
     unsafe_store!(Ptr{PrimitiveDesc}(prim_ptr), prim)
     
-    # Keep the container alive
-    _descriptor_storage[key] = desc_container
+    # Keep the container alive; another thread may have stored one first
+    desc_container = publish_entry!(_descriptor_storage, key, desc_container)
     
-    return desc_ptr
+    return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, desc_container)
 end
 
 function create_complex_descriptor(T::Type)
@@ -1150,9 +1301,8 @@ function create_complex_descriptor(T::Type)
     key = hash((GLZ_TYPE_COMPLEX, T))
     
     # Check if we already have this descriptor
-    if haskey(_descriptor_storage, key)
-        return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, _descriptor_storage[key])
-    end
+    stored = get(_descriptor_storage, key, nothing)
+    stored === nothing || return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, stored)
     
     desc = ConcreteTypeDescriptor(GLZ_TYPE_COMPLEX, ntuple(i -> 0x00, 32))
     
@@ -1165,10 +1315,10 @@ function create_complex_descriptor(T::Type)
     complex_ptr = desc_ptr + fieldoffset(ConcreteTypeDescriptor, 2)
     unsafe_store!(Ptr{ComplexDesc}(complex_ptr), complex)
     
-    # Keep the container alive
-    _descriptor_storage[key] = desc_container
+    # Keep the container alive; another thread may have stored one first
+    desc_container = publish_entry!(_descriptor_storage, key, desc_container)
     
-    return desc_ptr
+    return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, desc_container)
 end
 
 function create_vector_descriptor(elem_type_ptr::Ptr{ConcreteTypeDescriptor})
@@ -1176,9 +1326,8 @@ function create_vector_descriptor(elem_type_ptr::Ptr{ConcreteTypeDescriptor})
     key = hash((GLZ_TYPE_VECTOR, UInt64(elem_type_ptr)))
     
     # Check if we already have this descriptor
-    if haskey(_descriptor_storage, key)
-        return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, _descriptor_storage[key])
-    end
+    stored = get(_descriptor_storage, key, nothing)
+    stored === nothing || return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, stored)
     
     desc = ConcreteTypeDescriptor(GLZ_TYPE_VECTOR, ntuple(i -> 0x00, 32))
     
@@ -1190,15 +1339,126 @@ function create_vector_descriptor(elem_type_ptr::Ptr{ConcreteTypeDescriptor})
     vec_ptr = desc_ptr + fieldoffset(ConcreteTypeDescriptor, 2)
     unsafe_store!(Ptr{VectorDesc}(vec_ptr), vec)
     
-    # Keep the container alive
-    _descriptor_storage[key] = desc_container
+    # Keep the container alive; another thread may have stored one first
+    desc_container = publish_entry!(_descriptor_storage, key, desc_container)
     
-    return desc_ptr
+    return Base.unsafe_convert(Ptr{ConcreteTypeDescriptor}, desc_container)
 end
 
 
 # Make CppMemberFunction callable
-function (func::CppMemberFunction)(args...)
+# Result type for CppMemberFunction{R}: the Julia type of a primitive result
+# (Nothing for void) when every parameter is a primitive too, Any otherwise
+function method_result_type(member_info::Ptr{MemberInfo})
+    member = unsafe_load(member_info)
+    (member.type == C_NULL || descriptor_kind(member.type) != GLZ_TYPE_FUNCTION) && return Any
+    func_desc = unsafe_load(Ptr{FunctionDesc}(member.type + fieldoffset(ConcreteTypeDescriptor, 2)))
+    if func_desc.param_count > 0
+        func_desc.param_types == C_NULL && return Any
+        for i in 1:Int(func_desc.param_count)
+            param = unsafe_load(func_desc.param_types, i)
+            (param == C_NULL || descriptor_kind(param) != GLZ_TYPE_PRIMITIVE) && return Any
+        end
+    end
+    func_desc.return_type == C_NULL && return Nothing
+    descriptor_kind(func_desc.return_type) == GLZ_TYPE_PRIMITIVE || return Any
+    return primitive_kind_to_julia_type(primitive_kind(func_desc.return_type))
+end
+
+# Argument and result storage for primitive calls, one per thread. Nothing
+# between filling it and the ccall can yield, so a task keeps its thread.
+struct CallScratch
+    values::Vector{UInt64}       # one 8-byte slot per argument
+    args::Vector{Ptr{Cvoid}}     # pointers to the slots
+    result::Vector{UInt64}       # result slots padded by a cache line on each side
+end
+
+# The scratch of different threads is allocated back to back; padding the
+# small result buffer keeps threads from writing to the same cache line
+const SCRATCH_PAD = 8
+
+function CallScratch()
+    values = zeros(UInt64, 255)  # param_count is a UInt8
+    args = Ptr{Cvoid}[Ptr{Cvoid}(pointer(values, i)) for i in 1:length(values)]
+    return CallScratch(values, args, zeros(UInt64, 2 + 2 * SCRATCH_PAD))
+end
+
+@inline result_slot(scratch::CallScratch) = pointer(scratch.result, SCRATCH_PAD + 1)
+
+const _call_scratch = CallScratch[]
+
+function call_scratch()
+    tid = Threads.threadid()
+    tid <= length(_call_scratch) && return @inbounds _call_scratch[tid]
+    return CallScratch()  # thread started after the module was loaded
+end
+
+@inline store_primitive_args!(values::Vector{UInt64}, param_types::Ptr{Ptr{TypeDescriptor}}, i::Int) = nothing
+
+@inline function store_primitive_args!(values::Vector{UInt64}, param_types::Ptr{Ptr{TypeDescriptor}}, i::Int, arg, rest...)
+    store_primitive_arg!(pointer(values, i), primitive_kind(unsafe_load(param_types, i)), arg, i)
+    store_primitive_args!(values, param_types, i + 1, rest...)
+end
+
+# Same conversions as the general call path
+function store_primitive_arg!(slot::Ptr{UInt64}, kind::UInt64, arg, i::Int)
+    if kind == 1 && arg isa Bool
+        unsafe_store!(Ptr{Bool}(slot), arg)
+    elseif kind == 2 && arg isa Integer
+        unsafe_store!(Ptr{Int8}(slot), Int8(arg))
+    elseif kind == 3 && arg isa Integer
+        unsafe_store!(Ptr{Int16}(slot), Int16(arg))
+    elseif kind == 4 && arg isa Integer
+        unsafe_store!(Ptr{Int32}(slot), Int32(arg))
+    elseif kind == 5 && arg isa Integer
+        unsafe_store!(Ptr{Int64}(slot), Int64(arg))
+    elseif kind == 6 && arg isa Integer
+        unsafe_store!(Ptr{UInt8}(slot), UInt8(arg))
+    elseif kind == 7 && arg isa Integer
+        unsafe_store!(Ptr{UInt16}(slot), UInt16(arg))
+    elseif kind == 8 && arg isa Integer
+        unsafe_store!(Ptr{UInt32}(slot), UInt32(arg))
+    elseif kind == 9 && arg isa Integer
+        unsafe_store!(Ptr{UInt64}(slot), UInt64(arg))
+    elseif kind == 10 && arg isa Number
+        unsafe_store!(Ptr{Float32}(slot), Float32(arg))
+    elseif kind == 11 && arg isa Number
+        unsafe_store!(Ptr{Float64}(slot), Float64(arg))
+    elseif kind == PRIMITIVE_KIND_FLOAT16 && arg isa Real
+        unsafe_store!(Ptr{Float16}(slot), Float16(arg))
+    elseif kind == PRIMITIVE_KIND_BFLOAT16 && arg isa Real
+        unsafe_store!(Ptr{BFloat16}(slot), BFloat16(arg))
+    else
+        error("Cannot convert argument $(i) of type $(typeof(arg)) to expected primitive type $(kind)")
+    end
+    return nothing
+end
+
+# Primitive parameters and result: type-stable and allocation-free
+function (func::CppMemberFunction{R})(args::Vararg{Any, N}) where {R, N}
+    member = unsafe_load(func.member_info)
+    func_desc = unsafe_load(Ptr{FunctionDesc}(member.type + fieldoffset(ConcreteTypeDescriptor, 2)))
+    if N != func_desc.param_count
+        error("Function $(func.name) expects $(func_desc.param_count) arguments, got $(N)")
+    end
+
+    scratch = call_scratch()
+    store_primitive_args!(scratch.values, func_desc.param_types, 1, args...)
+
+    call_func = get_cached_function(func.lib_handle, :glz_call_member_function_with_type)
+    result_ptr = GC.@preserve scratch @ffi ccall(call_func, Ptr{Cvoid},
+        (Ptr{Cvoid}, Cstring, Ptr{MemberInfo}, Ptr{Ptr{Cvoid}}, Ptr{Cvoid}),
+        func.obj_ptr, func.type_name, func.member_info,
+        N == 0 ? C_NULL : pointer(scratch.args),
+        R === Nothing ? C_NULL : Ptr{Cvoid}(result_slot(scratch)))
+
+    R === Nothing && return nothing
+    result_ptr == C_NULL && error("Function $(func.name) returned no result")
+    return unsafe_load(Ptr{R}(result_slot(scratch)))
+end
+
+# Any other signature
+function (func::CppMemberFunction{Any})(args...)
     # Load the member info to get function signature
     member = unsafe_load(func.member_info)
     
@@ -1245,78 +1505,96 @@ function (func::CppMemberFunction)(args...)
         end
         param_types = unsafe_wrap(Array, func_desc.param_types, func_desc.param_count)
         
-        for (i, arg) in enumerate(args)
-            # Get expected parameter type
-            if i > length(param_types)
-                error("Parameter index $(i) out of range for function $(func.name)")
-            end
-            param_type_ptr = param_types[i]
-            if param_type_ptr == C_NULL
-                error("Parameter $(i) of function $(func.name) has null type descriptor")
-            end
+        temporaries = Tuple{Ptr{Cvoid}, Any}[]  # C++ strings and vectors to destroy after the call
+        try
+            for (i, arg) in enumerate(args)
+                # Get expected parameter type
+                if i > length(param_types)
+                    error("Parameter index $(i) out of range for function $(func.name)")
+                end
+                param_type_ptr = param_types[i]
+                if param_type_ptr == C_NULL
+                    error("Parameter $(i) of function $(func.name) has null type descriptor")
+                end
             
-            param_type_desc = unsafe_load(Ptr{ConcreteTypeDescriptor}(param_type_ptr))
+                param_type_desc = unsafe_load(Ptr{ConcreteTypeDescriptor}(param_type_ptr))
             
-            # Convert based on expected type
-            if param_type_desc.index == GLZ_TYPE_PRIMITIVE
-                prim_desc = unsafe_load(Ptr{PrimitiveDesc}(Ptr{UInt8}(param_type_ptr) + fieldoffset(ConcreteTypeDescriptor, 2)))
+                # Convert based on expected type
+                if param_type_desc.index == GLZ_TYPE_PRIMITIVE
+                    prim_desc = unsafe_load(Ptr{PrimitiveDesc}(Ptr{UInt8}(param_type_ptr) + fieldoffset(ConcreteTypeDescriptor, 2)))
                 
-                if prim_desc.kind == 1 && isa(arg, Bool)  # Bool
-                    c_val = Ref{Bool}(arg)
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 4 && isa(arg, Integer)  # Int32
-                    c_val = Ref{Int32}(Int32(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 5 && isa(arg, Integer)  # Int64  
-                    c_val = Ref{Int64}(Int64(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 10 && isa(arg, Number)  # Float32 - accept any number
-                    c_val = Ref{Float32}(Float32(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 11 && isa(arg, Number)  # Float64 - accept any number
-                    c_val = Ref{Float64}(Float64(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 6 && isa(arg, Integer)  # UInt8
-                    c_val = Ref{UInt8}(UInt8(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 7 && isa(arg, Integer)  # UInt16
-                    c_val = Ref{UInt16}(UInt16(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 8 && isa(arg, Integer)  # UInt32
-                    c_val = Ref{UInt32}(UInt32(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
-                elseif prim_desc.kind == 9 && isa(arg, Integer)  # UInt64/size_t
-                    c_val = Ref{UInt64}(UInt64(arg))
-                    push!(arg_storage, c_val)
-                    c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    if prim_desc.kind == 1 && isa(arg, Bool)  # Bool
+                        c_val = Ref{Bool}(arg)
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 4 && isa(arg, Integer)  # Int32
+                        c_val = Ref{Int32}(Int32(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 5 && isa(arg, Integer)  # Int64  
+                        c_val = Ref{Int64}(Int64(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 10 && isa(arg, Number)  # Float32 - accept any number
+                        c_val = Ref{Float32}(Float32(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 11 && isa(arg, Number)  # Float64 - accept any number
+                        c_val = Ref{Float64}(Float64(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16 && isa(arg, Real)  # Float16
+                        c_val = Ref{Float16}(Float16(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16 && isa(arg, Real)  # BFloat16
+                        c_val = Ref{BFloat16}(BFloat16(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 6 && isa(arg, Integer)  # UInt8
+                        c_val = Ref{UInt8}(UInt8(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 7 && isa(arg, Integer)  # UInt16
+                        c_val = Ref{UInt16}(UInt16(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 8 && isa(arg, Integer)  # UInt32
+                        c_val = Ref{UInt32}(UInt32(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    elseif prim_desc.kind == 9 && isa(arg, Integer)  # UInt64/size_t
+                        c_val = Ref{UInt64}(UInt64(arg))
+                        push!(arg_storage, c_val)
+                        c_args[i] = Ptr{Cvoid}(pointer_from_objref(c_val))
+                    else
+                        error("Cannot convert argument $(i) of type $(typeof(arg)) to expected primitive type $(prim_desc.kind)")
+                    end
+                elseif param_type_desc.index == GLZ_TYPE_STRING && isa(arg, AbstractString)
+                    # Create temporary std::string
+                    str_ptr = create_temp_string(arg, func.lib_handle)
+                    push!(temporaries, (str_ptr, arg))
+                    c_args[i] = str_ptr
+                elseif param_type_desc.index == GLZ_TYPE_VECTOR && isa(arg, AbstractVector)
+                    # Handle vector parameters; half-precision elements are converted up front
+                    elem_T = julia_type_from_descriptor(unsafe_load(Ptr{VectorDesc}(param_type_ptr + fieldoffset(ConcreteTypeDescriptor, 2))).element_type)
+                    if (elem_T === Float16 || elem_T === BFloat16) && eltype(arg) !== elem_T
+                        arg = convert(Vector{elem_T}, arg)
+                        args = Base.setindex(args, arg, i)
+                    end
+                    vec_ptr = create_temp_vector(arg, func.lib_handle)
+                    push!(temporaries, (vec_ptr, arg))
+                    c_args[i] = vec_ptr
+                elseif param_type_desc.index == GLZ_TYPE_VARIANT && isa(arg, CppVariant)
+                    # Handle variant parameters - pass the variant pointer directly
+                    c_args[i] = arg.ptr
                 else
-                    error("Cannot convert argument $(i) of type $(typeof(arg)) to expected primitive type $(prim_desc.kind)")
+                    error("Cannot convert argument $(i) of type $(typeof(arg)) to expected C++ type (index=$(param_type_desc.index))")
                 end
-            elseif param_type_desc.index == GLZ_TYPE_STRING && isa(arg, AbstractString)
-                # Create temporary std::string
-                create_func = Libdl.dlsym(func.lib_handle, :glz_create_string)
-                str_ptr = ccall(create_func, Ptr{Cvoid}, (Cstring, Csize_t), arg, length(arg))
-                push!(arg_storage, str_ptr)
-                c_args[i] = str_ptr
-            elseif param_type_desc.index == GLZ_TYPE_VECTOR && isa(arg, AbstractVector)
-                # Handle vector parameters
-                vec_ptr = create_temp_vector(arg, func.lib_handle)
-                push!(arg_storage, vec_ptr)  # Store to prevent GC and for cleanup
-                c_args[i] = vec_ptr
-            elseif param_type_desc.index == GLZ_TYPE_VARIANT && isa(arg, CppVariant)
-                # Handle variant parameters - pass the variant pointer directly
-                c_args[i] = arg.ptr
-            else
-                error("Cannot convert argument $(i) of type $(typeof(arg)) to expected C++ type (index=$(param_type_desc.index))")
             end
+        catch
+            release_temporaries!(temporaries, func.lib_handle)
+            rethrow()
         end
         
         # Allocate result buffer based on return type
@@ -1333,6 +1611,10 @@ function (func::CppMemberFunction)(args...)
                 (Ref{Float32}(0.0f0), Float32)
             elseif prim_desc.kind == 11  # double
                 (Ref{Float64}(0.0), Float64)
+            elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16
+                (Ref{Float16}(0), Float16)
+            elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16
+                (Ref{BFloat16}(zero(BFloat16)), BFloat16)
             else
                 (Ref{Float64}(0.0), Float64)  # Default fallback
             end
@@ -1376,12 +1658,11 @@ function (func::CppMemberFunction)(args...)
             buffer = vec_buffer
             (aligned_ptr, :vector)
         elseif return_type_desc.index == GLZ_TYPE_STRUCT
-            # Check if this is a std::pair by examining the struct
-            struct_desc_ptr = func_desc.return_type + fieldoffset(ConcreteTypeDescriptor, 2)
-            struct_desc = unsafe_load(Ptr{StructDesc}(struct_desc_ptr))
+            # std::pair/std::tuple returns registered with glz_jl::register_tuple_type
+            tuple_type_desc = return_tuple_desc(func.lib_handle, func_desc.return_type)
             
             # Allocate buffer for struct return
-            buffer = Vector{UInt8}(undef, 32)  # 32 bytes should be enough for most pairs
+            buffer = Vector{UInt8}(undef, tuple_type_desc == C_NULL ? 32 : max(32, Int(tuple_desc(tuple_type_desc).size)))
             (pointer(buffer), :struct)
         elseif return_type_desc.index == GLZ_TYPE_VARIANT
             # Allocate buffer for variant return
@@ -1400,76 +1681,29 @@ function (func::CppMemberFunction)(args...)
         end
         
         # Call the C++ function with type name
-        call_func = Libdl.dlsym(func.lib_handle, :glz_call_member_function_with_type)
-        result_ptr = ccall(call_func, Ptr{Cvoid}, 
+        call_func = get_cached_function(func.lib_handle, :glz_call_member_function_with_type)
+        result_ptr = @ffi ccall(call_func, Ptr{Cvoid}, 
                           (Ptr{Cvoid}, Cstring, Ptr{MemberInfo}, Ptr{Ptr{Cvoid}}, Ptr{Cvoid}),
                           func.obj_ptr, func.type_name, func.member_info, c_args, result_buffer)
         
         # Clean up temporary objects
-        for (i, stored) in enumerate(arg_storage)
-            if isa(stored, Ptr{Cvoid})
-                if isa(args[i], AbstractVector)
-                    # This is a temporary vector that needs cleanup
-                    destroy_temp_vector(stored, eltype(args[i]), func.lib_handle)
-                elseif isa(args[i], AbstractString)
-                    # This is a temporary string that needs cleanup
-                    destroy_func = Libdl.dlsym(func.lib_handle, :glz_destroy_string)
-                    ccall(destroy_func, Cvoid, (Ptr{Cvoid},), stored)
-                end
-            end
-        end
+        release_temporaries!(temporaries, func.lib_handle)
         
         if result_ptr != C_NULL && result_type != Nothing
             # Return the result based on type
             if result_type == String
                 # For string results, call the string C API to get the result
-                string_func = Libdl.dlsym(func.lib_handle, :glz_string_c_str)
-                c_str = ccall(string_func, Ptr{UInt8}, (Ptr{Cvoid},), result_ptr)
+                string_func = get_cached_function(func.lib_handle, :glz_string_c_str)
+                c_str = @ffi ccall(string_func, Ptr{UInt8}, (Ptr{Cvoid},), result_ptr)
                 return unsafe_string(c_str)
             elseif result_type == :vector && return_type_desc.index == GLZ_TYPE_VECTOR
                 # The result_buffer contains the vector object constructed via placement new
                 # Extract data immediately before it goes out of scope
                 return extract_vector_data(result_ptr, func_desc.return_type, func.lib_handle)
             elseif result_type == :struct && return_type_desc.index == GLZ_TYPE_STRUCT
-                # Handle struct returns - check if it's a pair
-                struct_desc_ptr = func_desc.return_type + fieldoffset(ConcreteTypeDescriptor, 2)
-                struct_desc = unsafe_load(Ptr{StructDesc}(struct_desc_ptr))
-                
-                # Try to get type info
-                type_info_ptr = struct_desc.info
-                
-                # If info is null but we have a type name, try to look it up
-                if type_info_ptr == C_NULL && struct_desc.type_name != C_NULL
-                    type_name = unsafe_string(struct_desc.type_name)
-                    get_type_info = Libdl.dlsym(func.lib_handle, :glz_get_type_info)
-                    type_info_ptr = ccall(get_type_info, Ptr{ConcreteTypeInfo}, (Cstring,), type_name)
-                end
-                
-                if type_info_ptr != C_NULL
-                    type_info = unsafe_load(type_info_ptr)
-                    if type_info.member_count == 2
-                        # Check member names to see if this is a pair
-                        # Read MemberInfo structs
-                        member1 = unsafe_load(type_info.members, 1)
-                        member2 = unsafe_load(type_info.members, 2)
-                        name1 = unsafe_string(member1.name)
-                        name2 = unsafe_string(member2.name)
-                        
-                        if name1 == "first" && name2 == "second"
-                            # This is a pair - extract values
-                            first_ptr = ccall(member1.getter, Ptr{Cvoid}, (Ptr{Cvoid},), result_ptr)
-                            second_ptr = ccall(member2.getter, Ptr{Cvoid}, (Ptr{Cvoid},), result_ptr)
-                            
-                            # For now, assume doubles (for findMinMax)
-                            first_val = unsafe_load(Ptr{Float64}(first_ptr))
-                            second_val = unsafe_load(Ptr{Float64}(second_ptr))
-                            return (first_val, second_val)
-                        end
-                    end
-                end
-                
-                # Not a pair or couldn't extract - return nothing for now
-                return nothing
+                # Pairs and tuples read as isbits Tuples; other struct returns are not supported yet
+                tuple_type_desc == C_NULL && return nothing
+                return tuple_value(result_ptr, tuple_type_desc)
             elseif result_type == :variant && return_type_desc.index == GLZ_TYPE_VARIANT
                 # Return a CppVariant wrapper
                 return CppVariant(result_ptr, func.lib_handle, func_desc.return_type)
@@ -1508,6 +1742,10 @@ function (func::CppMemberFunction)(args...)
                 (Ref{Float32}(0.0f0), Float32)
             elseif prim_desc.kind == 11  # double
                 (Ref{Float64}(0.0), Float64)
+            elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16
+                (Ref{Float16}(0), Float16)
+            elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16
+                (Ref{BFloat16}(zero(BFloat16)), BFloat16)
             else
                 (Ref{Float64}(0.0), Float64)  # Default fallback
             end
@@ -1551,12 +1789,11 @@ function (func::CppMemberFunction)(args...)
             buffer = vec_buffer
             (aligned_ptr, :vector)
         elseif return_type_desc.index == GLZ_TYPE_STRUCT
-            # Check if this is a std::pair by examining the struct
-            struct_desc_ptr = func_desc.return_type + fieldoffset(ConcreteTypeDescriptor, 2)
-            struct_desc = unsafe_load(Ptr{StructDesc}(struct_desc_ptr))
+            # std::pair/std::tuple returns registered with glz_jl::register_tuple_type
+            tuple_type_desc = return_tuple_desc(func.lib_handle, func_desc.return_type)
             
             # Allocate buffer for struct return
-            buffer = Vector{UInt8}(undef, 32)  # 32 bytes should be enough for most pairs
+            buffer = Vector{UInt8}(undef, tuple_type_desc == C_NULL ? 32 : max(32, Int(tuple_desc(tuple_type_desc).size)))
             (pointer(buffer), :struct)
         elseif return_type_desc.index == GLZ_TYPE_VARIANT
             # Allocate buffer for variant return
@@ -1574,60 +1811,24 @@ function (func::CppMemberFunction)(args...)
             (Ref{Float64}(0.0), Float64)  # Default fallback
         end
         
-        call_func = Libdl.dlsym(func.lib_handle, :glz_call_member_function_with_type)
-        result_ptr = ccall(call_func, Ptr{Cvoid},
+        call_func = get_cached_function(func.lib_handle, :glz_call_member_function_with_type)
+        result_ptr = @ffi ccall(call_func, Ptr{Cvoid},
                           (Ptr{Cvoid}, Cstring, Ptr{MemberInfo}, Ptr{Ptr{Cvoid}}, Ptr{Cvoid}),
                           func.obj_ptr, func.type_name, func.member_info, C_NULL, result_buffer)
         
         if result_ptr != C_NULL && result_type != Nothing
             if result_type == String
-                string_func = Libdl.dlsym(func.lib_handle, :glz_string_c_str)
-                c_str = ccall(string_func, Ptr{UInt8}, (Ptr{Cvoid},), result_ptr)
+                string_func = get_cached_function(func.lib_handle, :glz_string_c_str)
+                c_str = @ffi ccall(string_func, Ptr{UInt8}, (Ptr{Cvoid},), result_ptr)
                 return unsafe_string(c_str)
             elseif result_type == :vector && return_type_desc.index == GLZ_TYPE_VECTOR
                 # The result_buffer contains the vector object constructed via placement new
                 # Extract data immediately before it goes out of scope
                 return extract_vector_data(result_ptr, func_desc.return_type, func.lib_handle)
             elseif result_type == :struct && return_type_desc.index == GLZ_TYPE_STRUCT
-                # Handle struct returns - check if it's a pair
-                struct_desc_ptr = func_desc.return_type + fieldoffset(ConcreteTypeDescriptor, 2)
-                struct_desc = unsafe_load(Ptr{StructDesc}(struct_desc_ptr))
-                
-                # Try to get type info
-                type_info_ptr = struct_desc.info
-                
-                # If info is null but we have a type name, try to look it up
-                if type_info_ptr == C_NULL && struct_desc.type_name != C_NULL
-                    type_name = unsafe_string(struct_desc.type_name)
-                    get_type_info = Libdl.dlsym(func.lib_handle, :glz_get_type_info)
-                    type_info_ptr = ccall(get_type_info, Ptr{ConcreteTypeInfo}, (Cstring,), type_name)
-                end
-                
-                if type_info_ptr != C_NULL
-                    type_info = unsafe_load(type_info_ptr)
-                    if type_info.member_count == 2
-                        # Check member names to see if this is a pair
-                        # Read MemberInfo structs
-                        member1 = unsafe_load(type_info.members, 1)
-                        member2 = unsafe_load(type_info.members, 2)
-                        name1 = unsafe_string(member1.name)
-                        name2 = unsafe_string(member2.name)
-                        
-                        if name1 == "first" && name2 == "second"
-                            # This is a pair - extract values
-                            first_ptr = ccall(member1.getter, Ptr{Cvoid}, (Ptr{Cvoid},), result_ptr)
-                            second_ptr = ccall(member2.getter, Ptr{Cvoid}, (Ptr{Cvoid},), result_ptr)
-                            
-                            # For now, assume doubles (for findMinMax)
-                            first_val = unsafe_load(Ptr{Float64}(first_ptr))
-                            second_val = unsafe_load(Ptr{Float64}(second_ptr))
-                            return (first_val, second_val)
-                        end
-                    end
-                end
-                
-                # Not a pair or couldn't extract - return nothing for now
-                return nothing
+                # Pairs and tuples read as isbits Tuples; other struct returns are not supported yet
+                tuple_type_desc == C_NULL && return nothing
+                return tuple_value(result_ptr, tuple_type_desc)
             elseif result_type == :variant && return_type_desc.index == GLZ_TYPE_VARIANT
                 # Return a CppVariant wrapper
                 return CppVariant(result_ptr, func.lib_handle, func_desc.return_type)
@@ -1659,7 +1860,7 @@ function Base.show(io::IO, func::CppMemberFunction)
     end
 end
 
-export CppLibrary, load, get_instance, array_view, CppArrayView, CppOptional, value, set_value!, reset!, CppMemberFunction, CppSharedFuture,
+export CppLibrary, load, get_instance, getmember, array_view, reshape_view, CppArrayView, CppStridedView, CppOptional, value, set_value!, reset!, CppMemberFunction, CppSharedFuture,
        CppVariant, index, length, holds_alternative, alternative_type, get_value, set_value!,
        tryget, match_variant, alternative_types, alternatives, current_type, is_active, hastype, variant_union_type
 
@@ -1670,8 +1871,8 @@ export CppLibrary, load, get_instance, array_view, CppArrayView, CppOptional, va
 Check if the shared_future has a value ready without blocking.
 """
 function Base.isready(future::CppSharedFuture)
-    is_ready_func = Libdl.dlsym(future.lib_handle, :glz_shared_future_is_ready)
-    return ccall(is_ready_func, Bool, (Ptr{Cvoid},), future.ptr)
+    is_ready_func = get_cached_function(future.lib_handle, :glz_shared_future_is_ready)
+    return @ffi ccall(is_ready_func, Bool, (Ptr{Cvoid},), future.ptr)
 end
 
 """
@@ -1680,8 +1881,8 @@ end
 Block until the shared_future has a value ready.
 """
 function Base.wait(future::CppSharedFuture)
-    wait_func = Libdl.dlsym(future.lib_handle, :glz_shared_future_wait)
-    ccall(wait_func, Cvoid, (Ptr{Cvoid},), future.ptr)
+    wait_func = get_cached_function(future.lib_handle, :glz_shared_future_wait)
+    @ffi ccall(wait_func, Cvoid, (Ptr{Cvoid},), future.ptr)
 end
 
 """
@@ -1690,8 +1891,8 @@ end
 Check if the shared_future refers to a valid asynchronous state.
 """
 function Base.isvalid(future::CppSharedFuture)
-    valid_func = Libdl.dlsym(future.lib_handle, :glz_shared_future_valid)
-    return ccall(valid_func, Bool, (Ptr{Cvoid},), future.ptr)
+    valid_func = get_cached_function(future.lib_handle, :glz_shared_future_valid)
+    return @ffi ccall(valid_func, Bool, (Ptr{Cvoid},), future.ptr)
 end
 
 """
@@ -1706,16 +1907,19 @@ function Base.get(future::CppSharedFuture)
     end
     
     # Get the value type descriptor from the wrapper
-    get_type_func = Libdl.dlsym(future.lib_handle, :glz_shared_future_get_value_type)
-    value_type_ptr = ccall(get_type_func, Ptr{TypeDescriptor}, (Ptr{Cvoid},), future.ptr)
+    get_type_func = get_cached_function(future.lib_handle, :glz_shared_future_get_value_type)
+    value_type_ptr = @ffi ccall(get_type_func, Ptr{TypeDescriptor}, (Ptr{Cvoid},), future.ptr)
     
     if value_type_ptr == C_NULL
         error("Failed to get value type from shared_future")
     end
     
-    # Get the value through C API
-    get_func = Libdl.dlsym(future.lib_handle, :glz_shared_future_get)
-    value_ptr = ccall(get_func, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{TypeDescriptor}), 
+    # Get the value through C API. A std::string result is returned in the calling
+    # thread's thread_local storage, so it is read back before anything can yield
+    # (and move this task to another thread): resolve the reader up front.
+    get_func = get_cached_function(future.lib_handle, :glz_shared_future_get)
+    string_view_func = get_cached_function(future.lib_handle, :glz_string_view)
+    value_ptr = @ffi ccall(get_func, Ptr{Cvoid}, (Ptr{Cvoid}, Ptr{TypeDescriptor}), 
                      future.ptr, value_type_ptr)
     
     if value_ptr == C_NULL
@@ -1746,6 +1950,14 @@ function Base.get(future::CppSharedFuture)
             val = unsafe_load(Ptr{Float64}(value_ptr))
             Libc.free(value_ptr)
             val
+        elseif prim_desc.kind == PRIMITIVE_KIND_FLOAT16
+            val = unsafe_load(Ptr{Float16}(value_ptr))
+            Libc.free(value_ptr)
+            val
+        elseif prim_desc.kind == PRIMITIVE_KIND_BFLOAT16
+            val = unsafe_load(Ptr{BFloat16}(value_ptr))
+            Libc.free(value_ptr)
+            val
         else
             Libc.free(value_ptr)
             error("Unsupported primitive type kind: $(prim_desc.kind)")
@@ -1754,8 +1966,7 @@ function Base.get(future::CppSharedFuture)
         return value
     elseif value_type_desc.index == GLZ_TYPE_STRING
         # For strings, value_ptr points to a std::string
-        string_view_func = Libdl.dlsym(future.lib_handle, :glz_string_view)
-        str_view = ccall(string_view_func, StringView, (Ptr{Cvoid},), value_ptr)
+        str_view = @ffi ccall(string_view_func, StringView, (Ptr{Cvoid},), value_ptr)
         result = unsafe_string(str_view.data, str_view.size)
         # Note: The string is in thread_local storage, don't free
         return result
@@ -1780,8 +1991,8 @@ function Base.get(future::CppSharedFuture)
             type_hash = unsafe_load(Ptr{UInt64}(type_hash_addr))
             
             # Get type info by hash
-            get_type_info_by_hash_func = Libdl.dlsym(future.lib_handle, :glz_get_type_info_by_hash)
-            info_ptr = ccall(get_type_info_by_hash_func, Ptr{ConcreteTypeInfo}, (Csize_t,), type_hash)
+            get_type_info_by_hash_func = get_cached_function(future.lib_handle, :glz_get_type_info_by_hash)
+            info_ptr = @ffi ccall(get_type_info_by_hash_func, Ptr{ConcreteTypeInfo}, (Csize_t,), type_hash)
             
             if info_ptr == C_NULL
                 error("Could not find type info for type hash: $type_hash")
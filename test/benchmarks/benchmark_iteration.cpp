@@ -5,8 +5,14 @@
 #include <cstdlib>
 #include <cstring>
 
-// Include Glaze headers
-#include <glaze/glaze.hpp>
+#include <glaze/interop/interop.hpp>
+
+// Exported C entry points; the library is built with hidden visibility
+#ifdef _WIN32
+    #define GLZ_BENCH_EXPORT __declspec(dllexport)
+#else
+    #define GLZ_BENCH_EXPORT __attribute__((visibility("default")))
+#endif
 
 // Test struct with vector
 struct BenchmarkStruct {
@@ -22,10 +28,12 @@ struct glz::meta<BenchmarkStruct> {
     );
 };
 
+inline BenchmarkStruct global_benchmark;
+
 // Benchmark functions
 extern "C" {
     // Create benchmark struct
-    void* create_benchmark_struct(size_t size) {
+    GLZ_BENCH_EXPORT void* create_benchmark_struct(size_t size) {
         auto* obj = new BenchmarkStruct();
         obj->data.reserve(size);
         for (size_t i = 0; i < size; ++i) {
@@ -35,12 +43,12 @@ extern "C" {
     }
     
     // Destroy benchmark struct
-    void destroy_benchmark_struct(void* ptr) {
+    GLZ_BENCH_EXPORT void destroy_benchmark_struct(void* ptr) {
         delete static_cast<BenchmarkStruct*>(ptr);
     }
     
     // C++ iteration benchmark - sum all elements
-    double benchmark_cpp_iteration(void* ptr, int iterations) {
+    GLZ_BENCH_EXPORT double benchmark_cpp_iteration(void* ptr, int iterations) {
         auto* obj = static_cast<BenchmarkStruct*>(ptr);
         
         auto start = std::chrono::high_resolution_clock::now();
@@ -63,7 +71,7 @@ extern "C" {
     }
     
     // C++ iteration with index
-    double benchmark_cpp_iteration_indexed(void* ptr, int iterations) {
+    GLZ_BENCH_EXPORT double benchmark_cpp_iteration_indexed(void* ptr, int iterations) {
         auto* obj = static_cast<BenchmarkStruct*>(ptr);
         
         auto start = std::chrono::high_resolution_clock::now();
@@ -86,7 +94,7 @@ extern "C" {
     }
     
     // C++ iteration with raw pointer
-    double benchmark_cpp_iteration_raw(void* ptr, int iterations) {
+    GLZ_BENCH_EXPORT double benchmark_cpp_iteration_raw(void* ptr, int iterations) {
         auto* obj = static_cast<BenchmarkStruct*>(ptr);
         
         auto start = std::chrono::high_resolution_clock::now();
@@ -111,36 +119,24 @@ extern "C" {
         return static_cast<double>(duration.count()) / iterations;
     }
     
-    // Get Glaze type info
-    const glz::detail::type_info* glz_get_type_info(const char* type_name) {
-        if (std::strcmp(type_name, "BenchmarkStruct") == 0) {
-            static const auto info = glz::reflect<BenchmarkStruct>::type_info();
-            return &info;
-        }
-        return nullptr;
-    }
-    
-    // Get instance
-    void* glz_get_instance(const char* instance_name) {
-        static BenchmarkStruct global_benchmark;
-        if (std::strcmp(instance_name, "benchmark_struct") == 0) {
-            return &global_benchmark;
-        }
-        return nullptr;
+    // Register BenchmarkStruct and the "benchmark_struct" instance
+    GLZ_BENCH_EXPORT void init_benchmark_iteration() {
+        glz::register_type<BenchmarkStruct>("BenchmarkStruct");
+        glz::register_instance("benchmark_struct", global_benchmark);
     }
     
     // Initialize the benchmark struct with data
-    void init_benchmark_data(size_t size) {
-        auto* obj = static_cast<BenchmarkStruct*>(glz_get_instance("benchmark_struct"));
-        obj->data.clear();
-        obj->data.reserve(size);
+    GLZ_BENCH_EXPORT void init_benchmark_data(size_t size) {
+        global_benchmark.data.clear();
+        global_benchmark.data.reserve(size);
         for (size_t i = 0; i < size; ++i) {
-            obj->data.push_back(static_cast<float>(i) * 0.1f);
+            global_benchmark.data.push_back(static_cast<float>(i) * 0.1f);
         }
     }
 }
 
-// Main function for standalone testing
+// Standalone C++ run: build with -DGLZ_BENCH_STANDALONE and Glaze's src/interop/interop.cpp
+#ifdef GLZ_BENCH_STANDALONE
 int main() {
     const size_t sizes[] = {100, 1000, 10000, 100000, 1000000};
     const int iterations = 1000;
@@ -165,4 +161,5 @@ int main() {
     }
     
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -4,54 +4,7 @@ using Printf
 using Statistics
 using Libdl
 
-# Build the benchmark library
-function build_benchmark_lib()
-    test_dir = @__DIR__
-    build_dir = joinpath(test_dir, "build_benchmark")
-    mkpath(build_dir)
-    
-    # Create CMakeLists.txt for benchmark
-    cmake_content = """
-    cmake_minimum_required(VERSION 3.14)
-    project(benchmark_lib)
-    
-    set(CMAKE_CXX_STANDARD 20)
-    set(CMAKE_CXX_STANDARD_REQUIRED ON)
-    
-    # Find Glaze
-    find_package(glaze CONFIG REQUIRED)
-    
-    # Create benchmark library
-    add_library(benchmark_lib SHARED 
-        ../benchmark_iteration.cpp)
-    
-    target_link_libraries(benchmark_lib PRIVATE glaze::glaze)
-    
-    # Set output name
-    set_target_properties(benchmark_lib PROPERTIES
-        PREFIX "lib"
-        OUTPUT_NAME "benchmark_lib")
-    """
-    
-    write(joinpath(build_dir, "CMakeLists.txt"), cmake_content)
-    
-    # Build
-    cd(build_dir) do
-        run(`cmake .`)
-        run(`cmake --build .`)
-    end
-    
-    # Find the built library
-    lib_name = if Sys.iswindows()
-        "benchmark_lib.dll"
-    elseif Sys.isapple()
-        "libbenchmark_lib.dylib"
-    else
-        "libbenchmark_lib.so"
-    end
-    
-    return joinpath(build_dir, lib_name)
-end
+include(joinpath(@__DIR__, "common.jl"))
 
 # Benchmark functions
 
@@ -98,11 +51,8 @@ end
 
 # Main benchmark function
 function run_benchmarks()
-    println("Building benchmark library...")
-    lib_path = build_benchmark_lib()
-    
-    println("Loading library...")
-    lib = Glaze.load(lib_path)
+    println("Building and loading benchmark library...")
+    lib = load_benchmark_lib()
     
     # Sizes to test
     sizes = [100, 1000, 10000, 100000, 1000000]
@@ -194,9 +144,7 @@ function micro_benchmarks()
     println("\nMicro-benchmarks for CppVector operations")
     println("=========================================\n")
     
-    # Build and load if not already done
-    lib_path = build_benchmark_lib()
-    lib = Glaze.load(lib_path)
+    lib = load_benchmark_lib()
     
     # Test vector of size 10000
     init_func = dlsym(lib.handle, :init_benchmark_data)
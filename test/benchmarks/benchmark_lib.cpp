@@ -0,0 +1,15 @@
+// Single compilation unit for the benchmark library
+
+#include <glaze/interop/interop.hpp>
+
+#include "benchmark_iteration.cpp"
+#include "benchmark_suite.cpp"
+
+// Interop implementation from the fetched Glaze sources
+#include <interop/interop.cpp>
+
+// Glaze.jl helper implementations
+#include <glaze_jl/extensions.cpp>
+
+#include <glaze_jl/instrumentation.cpp>
+#include <glaze_jl/accounting.cpp>
@@ -0,0 +1,244 @@
+// Interop micro-benchmark types and native C++ baselines
+//
+// Each case in interop_suite.jl has a native loop here doing the same work in
+// C++ without crossing the FFI boundary. glz_bench_native runs one of them and
+// returns nanoseconds per operation, so the Julia side can report overhead.
+
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+#include <glaze/interop/interop.hpp>
+
+#ifndef GLZ_BENCH_EXPORT
+    #ifdef _WIN32
+        #define GLZ_BENCH_EXPORT __declspec(dllexport)
+    #else
+        #define GLZ_BENCH_EXPORT __attribute__((visibility("default")))
+    #endif
+#endif
+
+struct BenchInner {
+    double x = 1.5;
+    int32_t id = 7;
+};
+
+struct BenchRecord {
+    bool flag = true;
+    int32_t i32 = 42;
+    int64_t i64 = 1'000'000'007;
+    float f32 = 2.5f;
+    double f64 = 3.25;
+    std::string name = "benchmark record";
+    std::complex<double> z{1.0, -2.0};
+    BenchInner inner;
+    std::optional<double> maybe = 0.5;
+    std::variant<int32_t, double, std::string> choice = 2.0;
+    std::vector<double> samples = std::vector<double>(1024, 0.25);
+
+    void nop0() {}
+    double add1(double a) { return f64 + a; }
+    double add3(double a, double b, double c) { return a + b * c + f64; }
+    int64_t addInts(int64_t a, int32_t b) { return a + b + i64; }
+    size_t strlen(const std::string& s) { return s.size(); }
+    std::string greet() const { return name; }
+
+    std::vector<double> scaled(const std::vector<double>& v, double k)
+    {
+        std::vector<double> out(v.size());
+        for (size_t i = 0; i < v.size(); ++i) out[i] = v[i] * k;
+        return out;
+    }
+
+    std::shared_future<double> ready(double v)
+    {
+        std::promise<double> promise;
+        promise.set_value(v + f64);
+        return promise.get_future().share();
+    }
+};
+
+template <>
+struct glz::meta<BenchInner> {
+    using T = BenchInner;
+    static constexpr auto value = object("x", &T::x, "id", &T::id);
+};
+
+template <>
+struct glz::meta<BenchRecord> {
+    using T = BenchRecord;
+    static constexpr auto value = object(
+        "flag", &T::flag,
+        "i32", &T::i32,
+        "i64", &T::i64,
+        "f32", &T::f32,
+        "f64", &T::f64,
+        "name", &T::name,
+        "z", &T::z,
+        "inner", &T::inner,
+        "maybe", &T::maybe,
+        "choice", &T::choice,
+        "samples", &T::samples,
+        "nop0", &T::nop0,
+        "add1", &T::add1,
+        "add3", &T::add3,
+        "addInts", &T::addInts,
+        "strlen", &T::strlen,
+        "greet", &T::greet,
+        "scaled", &T::scaled,
+        "ready", &T::ready
+    );
+};
+
+inline BenchRecord global_bench_record;
+
+namespace bench
+{
+    // Keeps a value (and everything it points to) observable so the loop is not elided
+    template <class T>
+    inline void do_not_optimize(T const& value)
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        static volatile const void* sink;
+        sink = &value;
+#else
+        asm volatile("" : : "r,m"(value) : "memory");
+#endif
+    }
+
+    inline void clobber()
+    {
+#if !defined(_MSC_VER) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#endif
+    }
+
+    // Runs `body` `iterations` times and returns nanoseconds per call
+    template <class F>
+    double time_per_op(int64_t iterations, F&& body)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int64_t i = 0; i < iterations; ++i) {
+            body();
+            clobber();
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        return double(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) /
+               double(iterations);
+    }
+
+    inline double run_native(std::string_view name, BenchRecord& r, int64_t n)
+    {
+        double a = 1.0, b = 2.0, c = 3.0;
+        int64_t ia = 5;
+        int32_t ib = 6;
+        std::string arg = "hello from julia";
+        std::vector<double> input(1024, 1.0);
+        // Keep the inputs opaque so the loops cannot be constant-folded
+        do_not_optimize(a);
+        do_not_optimize(ia);
+
+        // Field reads
+        if (name == "get_bool") return time_per_op(n, [&] { do_not_optimize(r.flag); });
+        if (name == "get_i32") return time_per_op(n, [&] { do_not_optimize(r.i32); });
+        if (name == "get_i64") return time_per_op(n, [&] { do_not_optimize(r.i64); });
+        if (name == "get_f32") return time_per_op(n, [&] { do_not_optimize(r.f32); });
+        if (name == "get_f64") return time_per_op(n, [&] { do_not_optimize(r.f64); });
+        if (name == "get_complex") return time_per_op(n, [&] { do_not_optimize(r.z); });
+        if (name == "get_string") return time_per_op(n, [&] { std::string s = r.name; do_not_optimize(s); });
+        if (name == "get_nested") return time_per_op(n, [&] { do_not_optimize(r.inner.x); });
+        if (name == "get_optional") return time_per_op(n, [&] { do_not_optimize(r.maybe.value_or(0.0)); });
+        if (name == "get_variant") {
+            return time_per_op(n, [&] {
+                std::visit([](const auto& v) { do_not_optimize(v); }, r.choice);
+            });
+        }
+
+        // Field writes
+        if (name == "set_bool") return time_per_op(n, [&] { r.flag = ib != 0; });
+        if (name == "set_i32") return time_per_op(n, [&] { r.i32 = ib; });
+        if (name == "set_i64") return time_per_op(n, [&] { r.i64 = ia; });
+        if (name == "set_f64") return time_per_op(n, [&] { r.f64 = a; });
+        if (name == "set_string") return time_per_op(n, [&] { r.name = arg; });
+        if (name == "set_nested") return time_per_op(n, [&] { r.inner.x = a; });
+        if (name == "set_optional") return time_per_op(n, [&] { r.maybe = a; });
+
+        // String operations
+        if (name == "string_length") return time_per_op(n, [&] { do_not_optimize(r.name.size()); });
+
+        // Member calls
+        if (name == "call_nop0") return time_per_op(n, [&] { r.nop0(); });
+        if (name == "call_add1") return time_per_op(n, [&] { do_not_optimize(r.add1(a)); });
+        if (name == "call_add3") return time_per_op(n, [&] { do_not_optimize(r.add3(a, b, c)); });
+        if (name == "call_ints") return time_per_op(n, [&] { do_not_optimize(r.addInts(ia, ib)); });
+        if (name == "call_string_arg") return time_per_op(n, [&] { do_not_optimize(r.strlen(arg)); });
+        if (name == "call_string_ret") {
+            return time_per_op(n, [&] {
+                std::string s = r.greet();
+                do_not_optimize(s);
+            });
+        }
+        if (name == "call_vector") {
+            return time_per_op(n, [&] {
+                auto v = r.scaled(input, b);
+                do_not_optimize(v);
+            });
+        }
+
+        // Vector bulk transfer
+        if (name == "vector_copy") {
+            return time_per_op(n, [&] {
+                std::vector<double> v = r.samples;
+                do_not_optimize(v);
+            });
+        }
+        if (name == "vector_sum") {
+            return time_per_op(n, [&] {
+                double sum = 0.0;
+                for (double x : r.samples) sum += x;
+                do_not_optimize(sum);
+            });
+        }
+        if (name == "vector_assign") return time_per_op(n, [&] { r.samples = input; });
+
+        // Futures
+        if (name == "future_ready") return time_per_op(n, [&] { do_not_optimize(r.ready(a).get()); });
+
+        // Instance lifetime
+        if (name == "create_destroy") {
+            return time_per_op(n, [&] {
+                auto* p = new BenchRecord();
+                do_not_optimize(p);
+                delete p;
+            });
+        }
+
+        return -1.0;
+    }
+}
+
+extern "C" {
+    // Nanoseconds per operation for the native baseline `name`, or -1 if unknown.
+    // `obj` is a BenchRecord; null uses the registered "bench_record" instance.
+    GLZ_BENCH_EXPORT double glz_bench_native(const char* name, void* obj, int64_t iterations)
+    {
+        if (!name || iterations <= 0) return -1.0;
+        auto& record = obj ? *static_cast<BenchRecord*>(obj) : global_bench_record;
+        return bench::run_native(name, record, iterations);
+    }
+
+    // Register the suite types and the "bench_record" instance
+    GLZ_BENCH_EXPORT void init_benchmark_types()
+    {
+        glz::register_type<BenchInner>("BenchInner");
+        glz::register_type<BenchRecord>("BenchRecord");
+        glz::register_instance("bench_record", global_bench_record);
+    }
+}
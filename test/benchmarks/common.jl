@@ -0,0 +1,160 @@
+# Shared helpers for the benchmark scripts
+#
+# The benchmark library is described by test/benchmarks/CMakeLists.txt and
+# fetches Glaze the same way as the test library, so no installed Glaze
+# package is needed.
+
+using Glaze
+using Libdl
+using Printf
+
+const BENCH_DIR = @__DIR__
+const BENCH_BUILD_DIR = joinpath(BENCH_DIR, "build")
+
+# Configure and build the benchmark library, returning its path
+function build_benchmark_lib()
+    run(`cmake -S $BENCH_DIR -B $BENCH_BUILD_DIR -DCMAKE_BUILD_TYPE=Release`)
+    run(`cmake --build $BENCH_BUILD_DIR --config Release`)
+
+    lib_name = if Sys.iswindows()
+        "benchmark_lib.dll"
+    elseif Sys.isapple()
+        "libbenchmark_lib.dylib"
+    else
+        "libbenchmark_lib.so"
+    end
+
+    # Multi-config generators (Visual Studio, Xcode) add a configuration directory
+    for path in (joinpath(BENCH_BUILD_DIR, lib_name), joinpath(BENCH_BUILD_DIR, "Release", lib_name))
+        isfile(path) && return path
+    end
+    error("Benchmark library $lib_name not found in $BENCH_BUILD_DIR")
+end
+
+# Build, load and register every benchmark type
+function load_benchmark_lib()
+    lib = Glaze.load(build_benchmark_lib())
+    for init in (:init_benchmark_iteration, :init_benchmark_types)
+        ccall(Libdl.dlsym(lib.handle, init), Cvoid, ())
+    end
+    return lib
+end
+
+# Minimal JSON writer for benchmark results (dictionaries are written with sorted keys)
+function write_json(io::IO, x, indent::Int = 0)
+    pad = "  "^indent
+    if x isa AbstractDict
+        isempty(x) && return print(io, "{}")
+        println(io, "{")
+        ks = sort!(collect(keys(x)); by = string)
+        for (i, k) in enumerate(ks)
+            print(io, pad, "  ")
+            write_json(io, string(k))
+            print(io, ": ")
+            write_json(io, x[k], indent + 1)
+            println(io, i < length(ks) ? "," : "")
+        end
+        print(io, pad, "}")
+    elseif x isa Union{AbstractVector, Tuple}
+        print(io, "[")
+        for (i, v) in enumerate(x)
+            i > 1 && print(io, ", ")
+            write_json(io, v, indent + 1)
+        end
+        print(io, "]")
+    elseif x isa Union{AbstractString, Symbol}
+        print(io, '"', escape_string(string(x)), '"')
+    elseif x isa Bool
+        print(io, x ? "true" : "false")
+    elseif x isa Integer
+        print(io, x)
+    elseif x isa Real
+        isfinite(x) ? @printf(io, "%.6g", x) : print(io, "null")
+    elseif x === nothing
+        print(io, "null")
+    else
+        error("Cannot write $(typeof(x)) as JSON")
+    end
+    return nothing
+end
+
+function write_json(path::AbstractString, x)
+    mkpath(dirname(abspath(path)))
+    open(path, "w") do io
+        write_json(io, x)
+        println(io)
+    end
+    return path
+end
+
+# Minimal JSON reader for files written by write_json: objects become
+# Dict{String, Any}, arrays Vector{Any}, numbers Int64 or Float64
+read_json(path::AbstractString) = parse_json(read(path, String))
+
+function parse_json(text::AbstractString)
+    s = String(text)
+    value, i = parse_json_value(s, skip_json_space(s, 1))
+    skip_json_space(s, i) > ncodeunits(s) || error("Trailing characters in JSON at byte $i")
+    return value
+end
+
+function skip_json_space(s::String, i::Int)
+    while i <= ncodeunits(s) && codeunit(s, i) in (0x20, 0x09, 0x0a, 0x0d)
+        i += 1
+    end
+    return i
+end
+
+function parse_json_value(s::String, i::Int)
+    i <= ncodeunits(s) || error("Unexpected end of JSON")
+    c = s[i]
+    if c == '{'
+        d = Dict{String, Any}()
+        i = skip_json_space(s, i + 1)
+        s[i] == '}' && return d, i + 1
+        while true
+            key, i = parse_json_value(s, i)
+            key isa String || error("Expected a string key in JSON at byte $i")
+            i = skip_json_space(s, i)
+            s[i] == ':' || error("Expected ':' in JSON at byte $i")
+            d[key], i = parse_json_value(s, skip_json_space(s, i + 1))
+            i = skip_json_space(s, i)
+            s[i] == '}' && return d, i + 1
+            s[i] == ',' || error("Expected ',' or '}' in JSON at byte $i")
+            i = skip_json_space(s, i + 1)
+        end
+    elseif c == '['
+        v = Any[]
+        i = skip_json_space(s, i + 1)
+        s[i] == ']' && return v, i + 1
+        while true
+            x, i = parse_json_value(s, i)
+            push!(v, x)
+            i = skip_json_space(s, i)
+            s[i] == ']' && return v, i + 1
+            s[i] == ',' || error("Expected ',' or ']' in JSON at byte $i")
+            i = skip_json_space(s, i + 1)
+        end
+    elseif c == '"'
+        j = i + 1
+        while codeunit(s, j) != UInt8('"')
+            j += codeunit(s, j) == UInt8('\\') ? 2 : 1
+        end
+        return unescape_string(String(codeunits(s)[i+1:j-1])), j + 1
+    elseif startswith(SubString(s, i), "true")
+        return true, i + 4
+    elseif startswith(SubString(s, i), "false")
+        return false, i + 5
+    elseif startswith(SubString(s, i), "null")
+        return nothing, i + 4
+    else
+        j = i
+        while j <= ncodeunits(s) && s[j] in "+-0123456789.eE"
+            j += 1
+        end
+        token = s[i:j-1]
+        isempty(token) && error("Unexpected character '$c' in JSON at byte $i")
+        value = occursin(r"[.eE]", token) ? parse(Float64, token) : parse(Int64, token)
+        return value, j
+    end
+end
@@ -0,0 +1,145 @@
+# Interop micro-benchmarks with native C++ baselines
+#
+#   julia --project=. test/benchmarks/interop_suite.jl [results.json] [--quick]
+#
+# Every case is timed through Glaze.jl with BenchmarkTools and the same work is
+# timed as a C++ loop in benchmark_suite.cpp (glz_bench_native). Results hold
+# the median Julia time and its spread, the native time, their ratio and the
+# allocations per operation, and are written as JSON (default: build/interop_suite.json).
+
+using BenchmarkTools
+using Dates
+using Glaze
+using Statistics
+
+include(joinpath(@__DIR__, "common.jl"))
+
+# Cases are grouped by kind; each case name is also its native baseline in benchmark_suite.cpp
+function interop_suite(lib)
+    rec = get_instance(lib, "bench_record")
+    arg = "hello from julia"
+    input = fill(1.0, 1024)
+
+    suite = BenchmarkGroup()
+
+    g = suite["get"] = BenchmarkGroup()
+    g["get_bool"] = @benchmarkable $rec.flag
+    g["get_i32"] = @benchmarkable $rec.i32
+    g["get_i64"] = @benchmarkable $rec.i64
+    g["get_f32"] = @benchmarkable $rec.f32
+    g["get_f64"] = @benchmarkable $rec.f64
+    g["get_complex"] = @benchmarkable $rec.z
+    g["get_string"] = @benchmarkable String($rec.name)
+    g["get_nested"] = @benchmarkable $rec.inner.x
+    g["get_optional"] = @benchmarkable Glaze.value($rec.maybe)
+    g["get_variant"] = @benchmarkable Glaze.get_value($rec.choice)
+
+    g = suite["set"] = BenchmarkGroup()
+    g["set_bool"] = @benchmarkable setproperty!($rec, :flag, true)
+    g["set_i32"] = @benchmarkable setproperty!($rec, :i32, Int32(6))
+    g["set_i64"] = @benchmarkable setproperty!($rec, :i64, 5)
+    g["set_f64"] = @benchmarkable setproperty!($rec, :f64, 1.0)
+    g["set_string"] = @benchmarkable setproperty!($rec, :name, $arg)
+    g["set_nested"] = @benchmarkable setproperty!($rec.inner, :x, 1.0)
+    g["set_optional"] = @benchmarkable Glaze.set_value!($rec.maybe, 1.0)
+
+    g = suite["string"] = BenchmarkGroup()
+    g["string_length"] = @benchmarkable length($rec.name)
+
+    g = suite["call"] = BenchmarkGroup()
+    g["call_nop0"] = @benchmarkable $rec.nop0()
+    g["call_add1"] = @benchmarkable $rec.add1(1.0)
+    g["call_add3"] = @benchmarkable $rec.add3(1.0, 2.0, 3.0)
+    g["call_ints"] = @benchmarkable $rec.addInts(5, Int32(6))
+    g["call_string_arg"] = @benchmarkable $rec.strlen($arg)
+    g["call_string_ret"] = @benchmarkable $rec.greet()
+    g["call_vector"] = @benchmarkable $rec.scaled($input, 2.0)
+
+    g = suite["vector"] = BenchmarkGroup()
+    g["vector_copy"] = @benchmarkable collect($rec.samples)
+    g["vector_sum"] = @benchmarkable sum($rec.samples)
+    g["vector_assign"] = @benchmarkable setproperty!($rec, :samples, $input)
+
+    g = suite["future"] = BenchmarkGroup()
+    g["future_ready"] = @benchmarkable get($rec.ready(1.0))
+
+    g = suite["lifetime"] = BenchmarkGroup()
+    g["create_destroy"] = @benchmarkable finalize($lib.BenchRecord)
+
+    return suite
+end
+
+# Native loops faster than this mostly measure the loop itself
+const NATIVE_FLOOR_NS = 1.0
+
+# Best of several runs of the native loop, sized to roughly 20 ms each
+function native_time(lib, name::String, julia_ns::Float64)
+    fn = Libdl.dlsym(lib.handle, :glz_bench_native)
+    iterations = clamp(round(Int64, 2e7 / max(julia_ns, 1.0)), 1_000, 50_000_000)
+    best = Inf
+    for _ in 1:5
+        ns = ccall(fn, Cdouble, (Cstring, Ptr{Cvoid}, Int64), name, C_NULL, iterations)
+        ns < 0 && error("No native baseline named $name in benchmark_suite.cpp")
+        best = min(best, ns)
+    end
+    return best
+end
+
+function run_interop_suite(lib; seconds::Real = 1.0, verbose::Bool = false)
+    suite = interop_suite(lib)
+    tune!(suite; seconds = seconds, verbose = verbose)
+    trials = run(suite; seconds = seconds, verbose = verbose)
+
+    results = Dict{String, Any}()
+    for (group, cases) in trials, (name, trial) in cases
+        est = median(trial)
+        q25, q75 = quantile(trial.times, (0.25, 0.75))
+        native_ns = native_time(lib, name, est.time)
+        results[name] = Dict{String, Any}(
+            "group" => group,
+            "julia_ns" => est.time,
+            "spread" => (q75 - q25) / est.time,   # interquartile range relative to the median
+            "native_ns" => native_ns,
+            "ratio" => est.time / max(native_ns, NATIVE_FLOOR_NS),
+            "allocs" => est.allocs,
+            "bytes" => est.memory,
+        )
+    end
+
+    return Dict{String, Any}(
+        "metadata" => Dict{String, Any}(
+            "suite" => "interop",
+            "julia_version" => string(VERSION),
+            "threads" => Threads.nthreads(),
+            "os" => string(Sys.KERNEL),
+            "arch" => string(Sys.ARCH),
+            "cpu" => Sys.cpu_info()[1].model,
+            "date" => string(Dates.now()),
+            "seconds_per_case" => seconds,
+        ),
+        "results" => results,
+    )
+end
+
+function print_results(report)
+    results = report["results"]
+    @printf("%-18s %-9s %12s %12s %9s %7s %9s\n", "case", "group", "julia (ns)", "native (ns)", "ratio", "allocs", "bytes")
+    println("-"^82)
+    for name in sort!(collect(keys(results)); by = n -> (results[n]["group"], n))
+        r = results[name]
+        @printf("%-18s %-9s %12.1f %12.2f %9.1f %7d %9d\n",
+                name, r["group"], r["julia_ns"], r["native_ns"], r["ratio"], r["allocs"], r["bytes"])
+    end
+end
+
+if abspath(PROGRAM_FILE) == @__FILE__
+    quick = "--quick" in ARGS
+    paths = filter(a -> !startswith(a, "--"), ARGS)
+    output = isempty(paths) ? joinpath(BENCH_BUILD_DIR, "interop_suite.json") : paths[1]
+
+    lib = load_benchmark_lib()
+    report = run_interop_suite(lib; seconds = quick ? 0.1 : 1.0)
+    print_results(report)
+    write_json(output, report)
+    println("\nResults written to $output")
+end
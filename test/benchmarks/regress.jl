@@ -0,0 +1,131 @@
+# Performance regression gate for the interop benchmark suite
+#
+#   julia --project=. test/benchmarks/regress.jl [options]
+#
+#   --baseline PATH    baseline JSON (default: test/benchmarks/baselines/interop.json)
+#   --current PATH     compare an existing interop_suite.jl result instead of running
+#   --results PATH     also write the fresh results to PATH
+#   --tolerance X      allowed relative slowdown before noise is added (default: 0.25)
+#   --quick            shorter sampling, for smoke runs
+#   --update           record the fresh results as the new baseline and exit
+#
+# Cases are compared by their Julia/native ratio rather than raw time, so a
+# uniformly slower or faster machine cancels out. A case regresses when its
+# ratio grows by more than max(tolerance, 3 × the larger relative IQR of the
+# two runs) and by more than MIN_DELTA_NS in absolute time, or when it
+# allocates more per operation than the baseline. Exits with status 1 on any
+# regression and 2 when the baseline is missing. CI records the baseline from
+# the base revision on the same runner (see .github/workflows/ci.yml).
+
+include(joinpath(@__DIR__, "interop_suite.jl"))
+
+const DEFAULT_BASELINE = joinpath(@__DIR__, "baselines", "interop.json")
+
+# Differences below this are within timer and dispatch jitter
+const MIN_DELTA_NS = 2.0
+
+struct CaseDiff
+    name::String
+    group::String
+    base_ratio::Float64
+    ratio::Float64
+    change::Float64     # ratio / base_ratio
+    threshold::Float64  # allowed change - 1
+    base_allocs::Int
+    allocs::Int
+    status::Symbol      # :ok, :faster, :slower, :allocs, :new, :missing
+end
+
+isregression(d::CaseDiff) = d.status in (:slower, :allocs, :missing)
+
+function compare_results(baseline, current; tolerance::Real = 0.25)
+    base = baseline["results"]
+    cur = current["results"]
+    diffs = CaseDiff[]
+    for name in sort!(collect(union(keys(base), keys(cur))))
+        if !haskey(cur, name)
+            b = base[name]
+            push!(diffs, CaseDiff(name, b["group"], b["ratio"], NaN, NaN, NaN, b["allocs"], -1, :missing))
+            continue
+        end
+        c = cur[name]
+        if !haskey(base, name)
+            push!(diffs, CaseDiff(name, c["group"], NaN, c["ratio"], NaN, NaN, -1, c["allocs"], :new))
+            continue
+        end
+        b = base[name]
+        change = c["ratio"] / b["ratio"]
+        threshold = max(tolerance, 3 * max(b["spread"], c["spread"]))
+        delta_ns = c["julia_ns"] - b["julia_ns"] * c["native_ns"] / b["native_ns"]
+        status = if c["allocs"] > b["allocs"]
+            :allocs
+        elseif change > 1 + threshold && delta_ns > MIN_DELTA_NS
+            :slower
+        elseif change < 1 / (1 + threshold)
+            :faster
+        else
+            :ok
+        end
+        push!(diffs, CaseDiff(name, c["group"], b["ratio"], c["ratio"], change, threshold,
+                              b["allocs"], c["allocs"], status))
+    end
+    return diffs
+end
+
+function print_diff(diffs::Vector{CaseDiff})
+    @printf("%-18s %-9s %10s %10s %9s %9s %11s  %s\n",
+            "case", "group", "base ratio", "ratio", "change", "allowed", "allocs", "status")
+    println("-"^90)
+    for d in sort(diffs; by = d -> (!isregression(d), d.group, d.name))
+        change = isnan(d.change) ? "-" : @sprintf("%+.1f%%", 100 * (d.change - 1))
+        allowed = isnan(d.threshold) ? "-" : @sprintf("+%.0f%%", 100 * d.threshold)
+        allocs = d.base_allocs < 0 || d.allocs < 0 ? "-" : "$(d.base_allocs) → $(d.allocs)"
+        @printf("%-18s %-9s %10.1f %10.1f %9s %9s %11s  %s\n",
+                d.name, d.group, d.base_ratio, d.ratio, change, allowed, allocs,
+                isregression(d) ? uppercase(string(d.status)) : string(d.status))
+    end
+end
+
+function main(args)
+    option(flag, default) = (i = findfirst(==(flag), args); i === nothing ? default : args[i + 1])
+    baseline_path = option("--baseline", DEFAULT_BASELINE)
+    current_path = option("--current", nothing)
+    results_path = option("--results", nothing)
+    tolerance = parse(Float64, option("--tolerance", "0.25"))
+
+    current = if current_path === nothing
+        lib = load_benchmark_lib()
+        run_interop_suite(lib; seconds = "--quick" in args ? 0.1 : 1.0)
+    else
+        read_json(current_path)
+    end
+    results_path === nothing || write_json(results_path, current)
+
+    if "--update" in args
+        write_json(baseline_path, current)
+        println("Baseline written to $baseline_path")
+        return 0
+    end
+
+    if !isfile(baseline_path)
+        println(stderr, "No baseline at $baseline_path; record one on the reference machine with --update")
+        return 2
+    end
+    baseline = read_json(baseline_path)
+
+    diffs = compare_results(baseline, current; tolerance = tolerance)
+    print_diff(diffs)
+
+    regressions = count(isregression, diffs)
+    println()
+    if regressions > 0
+        println("$regressions of $(length(diffs)) cases regressed against $baseline_path")
+        return 1
+    end
+    println("No regressions in $(length(diffs)) cases")
+    return 0
+end
+
+if abspath(PROGRAM_FILE) == @__FILE__
+    exit(main(ARGS))
+end
@@ -0,0 +1,175 @@
+# Multi-threaded scaling of interop operations
+#
+#   julia -t 16 --project=. test/benchmarks/threads_suite.jl [results.json] [options]
+#
+#   --quick                shorter runs, for smoke tests
+#   --min-efficiency X     exit with status 1 when a read-only case on distinct
+#                          objects scales below X at the highest thread count
+#
+# Every case runs one interop operation in a loop on 1, 2, 4, ... up to
+# Threads.nthreads() threads, one task per thread, and reports the total
+# throughput and the scaling efficiency throughput(n) / (n × throughput(1)).
+# Unless a case says otherwise, each thread works on its own BenchRecord
+# instance. Cases that allocate also measure the garbage collector, which
+# stops all threads, so they are not expected to scale linearly. Results are
+# written as JSON (default: build/threads_suite.json).
+
+using Dates
+
+include(joinpath(@__DIR__, "common.jl"))
+
+struct ThreadCase
+    name::String
+    read_only::Bool   # only reads objects: expected to scale near-linearly
+    setup::Function   # (lib, rec) -> state, run once per thread before timing
+    op::Function      # state -> result, the timed operation
+end
+
+function thread_cases(lib)
+    shared = get_instance(lib, "bench_record")
+    input = fill(1.0, 64)
+    return [
+        ThreadCase("get_f64", true, (lib, rec) -> rec, rec -> rec.f64),
+        ThreadCase("get_i32", true, (lib, rec) -> rec, rec -> rec.i32),
+        ThreadCase("get_nested", true, (lib, rec) -> rec, rec -> rec.inner.x),
+        ThreadCase("string_length", true, (lib, rec) -> rec, rec -> length(rec.name)),
+        ThreadCase("vector_sum", true, (lib, rec) -> rec, rec -> sum(rec.samples)),
+        ThreadCase("call_add1", true, (lib, rec) -> rec.add1, add1 -> add1(1.0)),
+        # Every thread reads the same global instance
+        ThreadCase("get_f64_shared", true, (lib, rec) -> shared, rec -> rec.f64),
+        ThreadCase("set_f64", false, (lib, rec) -> rec, rec -> setproperty!(rec, :f64, 1.0)),
+        ThreadCase("call_string_arg", false, (lib, rec) -> rec, rec -> rec.strlen("hello from julia")),
+        ThreadCase("call_vector", false, (lib, rec) -> rec, rec -> rec.scaled(input, 2.0)),
+        ThreadCase("future_ready", false, (lib, rec) -> rec, rec -> get(rec.ready(1.0))),
+        ThreadCase("create_destroy", false, (lib, rec) -> lib, lib -> finalize(lib.BenchRecord)),
+    ]
+end
+
+thread_counts() = unique!(sort!([n for n in (1, 2, 4, 8, 16, 32, 64, 128) if n <= Threads.nthreads()] ∪ [Threads.nthreads()]))
+
+# Run `iterations` operations on each of the first `n` threads; returns elapsed seconds
+function run_threads(op, states, n::Int, iterations::Int)
+    sinks = zeros(Int, 8 * n)   # one cache line apart, so results stay observable
+    start = time_ns()
+    Threads.@threads :static for t in 1:Threads.nthreads()
+        if t <= n
+            state = states[t]
+            acc = 0
+            for _ in 1:iterations
+                acc += hash(op(state)) % 2
+            end
+            sinks[8 * (t - 1) + 1] = acc
+        end
+    end
+    return (time_ns() - start) / 1e9
+end
+
+# Iterations that take about `seconds` on one thread
+function calibrate(op, state, seconds::Float64)
+    iterations = 16
+    while true
+        t0 = time_ns()
+        for _ in 1:iterations
+            op(state)
+        end
+        elapsed = (time_ns() - t0) / 1e9
+        (elapsed >= seconds / 4 || iterations >= 1 << 30) && return max(1, round(Int, iterations * seconds / max(elapsed, 1e-9)))
+        iterations *= 4
+    end
+end
+
+function run_threads_suite(lib; seconds::Real = 0.5, repeats::Int = 3)
+    nthreads = Threads.nthreads()
+    counts = thread_counts()
+    # Distinct instances, created before timing
+    recs = [lib.BenchRecord for _ in 1:nthreads]
+
+    results = Dict{String, Any}()
+    for case in thread_cases(lib)
+        states = Vector{Any}(undef, nthreads)
+        Threads.@threads :static for t in 1:nthreads
+            states[t] = case.setup(lib, recs[t])
+        end
+        op = case.op
+        op(states[1])   # compile
+        allocs = @allocated op(states[1])
+        iterations = calibrate(op, states[1], Float64(seconds))
+
+        throughput = Float64[]
+        for n in counts
+            best = minimum(run_threads(op, states, n, iterations) for _ in 1:repeats)
+            push!(throughput, n * iterations / best)
+        end
+        GC.gc()
+
+        efficiency = [throughput[i] / (counts[i] * throughput[1]) for i in eachindex(counts)]
+        results[case.name] = Dict{String, Any}(
+            "read_only" => case.read_only,
+            "threads" => counts,
+            "ops_per_second" => throughput,
+            "efficiency" => efficiency,
+            "bytes_per_op" => allocs,
+        )
+    end
+    foreach(finalize, recs)
+
+    return Dict{String, Any}(
+        "metadata" => Dict{String, Any}(
+            "suite" => "threads",
+            "julia_version" => string(VERSION),
+            "threads" => nthreads,
+            "os" => string(Sys.KERNEL),
+            "arch" => string(Sys.ARCH),
+            "cpu" => Sys.cpu_info()[1].model,
+            "cpu_threads" => Sys.CPU_THREADS,
+            "date" => string(Dates.now()),
+            "seconds_per_run" => seconds,
+        ),
+        "results" => results,
+    )
+end
+
+function print_threads_results(report)
+    results = report["results"]
+    names = sort!(collect(keys(results)); by = n -> (!results[n]["read_only"], n))
+    counts = results[first(names)]["threads"]
+    @printf("%-16s %5s %8s", "case", "read", "bytes")
+    foreach(n -> @printf(" %15s", "$n thr (Mop/s)"), counts)
+    @printf(" %11s\n", "efficiency")
+    println("-"^(31 + 16 * length(counts) + 12))
+    for name in names
+        r = results[name]
+        @printf("%-16s %5s %8d", name, r["read_only"] ? "yes" : "no", r["bytes_per_op"])
+        foreach(x -> @printf(" %15.2f", x / 1e6), r["ops_per_second"])
+        @printf(" %10.0f%%\n", 100 * last(r["efficiency"]))
+    end
+end
+
+# Read-only cases whose efficiency at the highest thread count is below `threshold`
+function poorly_scaling(report, threshold::Real)
+    results = report["results"]
+    return sort!([name for (name, r) in results if r["read_only"] && last(r["efficiency"]) < threshold])
+end
+
+if abspath(PROGRAM_FILE) == @__FILE__
+    option(flag, default) = (i = findfirst(==(flag), ARGS); i === nothing ? default : ARGS[i + 1])
+    quick = "--quick" in ARGS
+    min_efficiency = option("--min-efficiency", nothing)
+    paths = filter(a -> !startswith(a, "--") && a != min_efficiency, ARGS)
+    output = isempty(paths) ? joinpath(BENCH_BUILD_DIR, "threads_suite.json") : paths[1]
+
+    Threads.nthreads() == 1 && @warn "Running on one thread; start Julia with -t N to measure scaling"
+    lib = load_benchmark_lib()
+    report = run_threads_suite(lib; seconds = quick ? 0.05 : 0.5, repeats = quick ? 1 : 3)
+    print_threads_results(report)
+    write_json(output, report)
+    println("\nResults written to $output")
+
+    if min_efficiency !== nothing
+        slow = poorly_scaling(report, parse(Float64, min_efficiency))
+        if !isempty(slow)
+            println("Read-only cases below $(min_efficiency) scaling efficiency: ", join(slow, ", "))
+            exit(1)
+        end
+    end
+end
@@ -71,6 +71,75 @@ global test_lib_for_all_types = lib
     # Include shared future tests
     include("test_shared_future.jl")
     
+    # Include change tracking tests
+    include("test_change_tracking.jl")
+    
+    # Include shared memory tests
+    include("test_shared_memory.jl")
+    
+    # Include out-of-process execution tests
+    include("test_remote.jl")
+    
+    # Include serialization tests
+    include("test_serialization.jl")
+    
+    # Include pointer member tests
+    include("test_polymorphic_pointers.jl")
+    
+    # Include std::array member tests
+    include("test_fixed_arrays.jl")
+    
+    # Include multi-dimensional view tests
+    include("test_multidim_views.jl")
+    
+    # Include jagged vector tests
+    include("test_jagged_vectors.jl")
+    
+    # Include complex planar view tests
+    include("test_complex_planar.jl")
+    
+    # Include packed bit member tests
+    include("test_bit_vectors.jl")
+    
+    # Include half-precision element tests
+    include("test_half_precision.jl")
+    
+    # Include enum member tests
+    include("test_enums.jl")
+    
+    # Include pair and tuple member tests
+    include("test_tuples.jl")
+    
+    # Include std::chrono member tests
+    include("test_chrono.jl")
+    
+    # Include non-contiguous range tests
+    include("test_ranges.jl")
+    
+    # Include generator method tests
+    include("test_generators.jl")
+    
+    # Include cooperative cancellation tests
+    include("test_cancellation.jl")
+    
+    # Include glz::generic member tests
+    include("test_generic_json.jl")
+    
+    # Include zero-allocation tests for the hot interop paths
+    include("test_zero_allocations.jl")
+    
+    # Include a short run of the interop benchmark suite
+    include("test_benchmark_suite.jl")
+    
+    # Include FFI instrumentation tests
+    include("test_instrumentation.jl")
+    
+    # Include live-object accounting tests
+    include("test_live_objects.jl")
+    
+    # Include multi-threaded access tests
+    include("test_threads.jl")
+    
     # Include new tests for examples coverage
     include("test_complex_nested.jl")
     # Map types are not yet implemented in Glaze.jl (test_maps.jl)
@@ -0,0 +1,123 @@
+# Soak test: create, call and destroy C++ objects in a loop and check that
+# memory stays flat
+#
+#   julia --project=. test/soak/soak.jl [options]
+#
+#   --cycles N         workload cycles to run (default: 1000000)
+#   --sample N         cycles between GC + memory samples (default: 10000)
+#   --tolerance MB     allowed RSS growth after warmup (default: 16)
+#   --quick            10000 cycles, for smoke runs
+#
+# Each cycle creates instances, calls member functions with string and vector
+# arguments, resolves a struct-returning shared future and then releases
+# everything. Every --sample cycles the script runs a full GC and records the
+# live C++ objects (Glaze.live_objects) and the resident set size. It fails
+# (exit status 1) when any C++ object count grew over the run, or when RSS grew
+# by more than the tolerance after the first fifth of the run (allocator
+# warmup).
+
+using Glaze
+using Libdl
+using Printf
+
+const TEST_DIR = dirname(@__DIR__)
+const BUILD_DIR = joinpath(TEST_DIR, "build")
+
+# Configure, build and initialize the test library used by runtests.jl
+function load_test_lib()
+    mkpath(BUILD_DIR)
+    cd(BUILD_DIR) do
+        run(`cmake ..`)
+        run(`cmake --build .`)
+    end
+    lib_name = if Sys.iswindows()
+        "test_lib.dll"
+    elseif Sys.isapple()
+        "libtest_lib.dylib"
+    else
+        "libtest_lib.so"
+    end
+    lib = Glaze.CppLibrary(joinpath(BUILD_DIR, lib_name))
+    ccall(Libdl.dlsym(lib.handle, :init_test_types_complete), Cvoid, ())
+    return lib
+end
+
+# Resident set size in bytes (peak RSS where /proc is unavailable)
+function rss_bytes()
+    if Sys.islinux() && isfile("/proc/self/statm")
+        fields = split(read("/proc/self/statm", String))
+        return parse(Int, fields[2]) * ccall(:getpagesize, Cint, ())
+    end
+    return Int(Sys.maxrss())
+end
+
+function cycle!(lib, future_test, values, words)
+    calc = lib.Calculator
+    calc.add(1.5)
+    calc.multiply(2.0)
+
+    processor = lib.VectorProcessor
+    processor.dotProduct(values, values)
+    processor.joinStrings(words, ", ")
+
+    person = get(future_test.getPersonAsync("soak", 42, 0))
+    person.age == 42 || error("unexpected future result")
+
+    finalize(person)
+    finalize(processor)
+    finalize(calc)
+    return nothing
+end
+
+function main(args)
+    option(flag, default) = (i = findfirst(==(flag), args); i === nothing ? default : args[i + 1])
+    cycles = parse(Int, option("--cycles", "--quick" in args ? "10000" : "1000000"))
+    sample = min(cycles, parse(Int, option("--sample", "10000")))
+    tolerance_mb = parse(Float64, option("--tolerance", "16"))
+
+    lib = load_test_lib()
+    future_test = get_instance(lib, "global_future_test")
+    values = collect(1.0:64.0)
+    words = ["alpha", "beta", "gamma", "δέλτα"]
+
+    # Warm up compilation and caches before the baseline
+    for _ in 1:100
+        cycle!(lib, future_test, values, words)
+    end
+    GC.gc()
+    baseline = Glaze.live_objects()
+    warmup = max(1, cycles ÷ 5)
+    warm_rss = rss_bytes()
+
+    @printf("%12s %12s %14s\n", "cycle", "rss (MB)", "live objects")
+    for i in 1:cycles
+        cycle!(lib, future_test, values, words)
+        if i % sample == 0 || i == cycles
+            GC.gc()
+            rss = rss_bytes()
+            i <= warmup && (warm_rss = rss)
+            live = sum((x.live for x in Glaze.live_objects()); init = 0)
+            @printf("%12d %12.1f %14d\n", i, rss / 2^20, live)
+        end
+    end
+
+    GC.gc()
+    failed = false
+    leaks = Glaze.leaked_since(baseline)
+    if !isempty(leaks)
+        println("C++ objects leaked over $cycles cycles:")
+        foreach(x -> println("  ", x), leaks)
+        failed = true
+    end
+    growth_mb = (rss_bytes() - warm_rss) / 2^20
+    if growth_mb > tolerance_mb
+        @printf("RSS grew by %.1f MB after warmup (tolerance %.1f MB)\n", growth_mb, tolerance_mb)
+        failed = true
+    end
+    failed || @printf("No leaks in %d cycles; RSS growth after warmup %.1f MB\n", cycles, growth_mb)
+    return failed ? 1 : 0
+end
+
+if abspath(PROGRAM_FILE) == @__FILE__
+    exit(main(ARGS))
+end
@@ -178,6 +178,27 @@ struct glz::meta<TestAllTypesComplete> {
     );
 };
 
+// Member names that match proxy field names or need escaping in a JSON pointer
+struct TestReservedNames {
+    std::string path;
+    int handle;
+    double remote;
+    bool schema;
+    double accel;
+};
+
+template <>
+struct glz::meta<TestReservedNames> {
+    using T = TestReservedNames;
+    static constexpr auto value = object(
+        "path", &T::path,
+        "handle", &T::handle,
+        "remote", &T::remote,
+        "schema", &T::schema,
+        "m/s~2", &T::accel
+    );
+};
+
 
 // Registration function
 inline void register_all_test_types() {
@@ -187,6 +208,7 @@ inline void register_all_test_types() {
     glz::register_type<TestIntegerVectors>("TestIntegerVectors");
     glz::register_type<TestFloatVectors>("TestFloatVectors");
     glz::register_type<TestAllTypesComplete>("TestAllTypesComplete");
+    glz::register_type<TestReservedNames>("TestReservedNames");
 }
 
 // Declaration only - implementation in test_all_types.cpp
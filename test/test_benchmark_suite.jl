@@ -0,0 +1,16 @@
+# Smoke run of the interop benchmark suite, so a case that throws fails the tests
+# rather than the regression gate. This file is included by runtests.jl and
+# builds the benchmark library itself.
+
+module InteropSuiteSmoke
+include(joinpath(@__DIR__, "benchmarks", "interop_suite.jl"))
+end
+
+@testset "Interop Benchmark Suite" begin
+    bench_lib = InteropSuiteSmoke.load_benchmark_lib()
+    report = InteropSuiteSmoke.run_interop_suite(bench_lib; seconds = 0.01)
+    results = report["results"]
+    cases = [name for (_, group) in InteropSuiteSmoke.interop_suite(bench_lib) for name in keys(group)]
+    @test sort!(collect(keys(results))) == sort!(cases)
+    @test all(r -> r["julia_ns"] > 0 && isfinite(r["ratio"]), values(results))
+end
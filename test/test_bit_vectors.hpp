@@ -0,0 +1,53 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/bits.hpp>
+#include <bitset>
+#include <string>
+#include <vector>
+
+// Packed bit masks
+struct MaskSet {
+    std::string label = "masks";
+    std::vector<bool> selected;   // 130 bits, every third set
+    std::bitset<100> flags;       // bits 5, 64 and 99 set
+    std::vector<bool> large;      // 1'000'000 bits, every 1000th set
+
+    size_t selected_count() const
+    {
+        size_t n = 0;
+        for (bool b : selected) n += b;
+        return n;
+    }
+};
+
+template <>
+struct glz::meta<MaskSet> {
+    using T = MaskSet;
+    static constexpr auto value = object("label", &T::label, "selected_count", &T::selected_count);
+};
+
+inline MaskSet global_masks = [] {
+    MaskSet masks;
+    for (size_t i = 0; i < 130; ++i) {
+        masks.selected.push_back(i % 3 == 0);
+    }
+    masks.flags.set(5);
+    masks.flags.set(64);
+    masks.flags.set(99);
+    masks.large.resize(1'000'000);
+    for (size_t i = 999; i < masks.large.size(); i += 1000) {
+        masks.large[i] = true;
+    }
+    return masks;
+}();
+
+inline void register_bit_vector_test_types() {
+    glz::register_type<MaskSet>("MaskSet");
+
+    glz_jl::register_bits_member<&MaskSet::selected>("MaskSet", "selected");
+    glz_jl::register_bits_member<&MaskSet::flags>("MaskSet", "flags");
+    glz_jl::register_bits_member<&MaskSet::large>("MaskSet", "large");
+
+    glz::register_instance("global_masks", global_masks);
+}
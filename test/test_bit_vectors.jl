@@ -0,0 +1,67 @@
+# Tests for std::vector<bool> and std::bitset members
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Packed Bit Members" begin
+    masks = Glaze.get_instance(lib, "global_masks")
+
+    @testset "Bit access" begin
+        selected = masks.selected
+        @test selected isa CppBitVector
+        @test length(selected) == 130
+        @test selected[1] && !selected[2] && selected[130]
+        @test count(selected) == 44
+        @test findfirst(selected) == 1
+        @test findnext(selected, 2) == 4
+        @test findnext(selected, 131) === nothing
+
+        selected[2] = true
+        @test masks.selected_count() == 45
+        selected[2] = false
+
+        flags = masks.flags
+        @test length(flags) == 100
+        @test count(flags) == 3
+        @test findall(flags) == [6, 65, 100]
+        @test findnext(flags, 7) == 65
+    end
+
+    @testset "BitVector conversion" begin
+        bv = BitVector(masks.selected)
+        @test bv == [i % 3 == 0 for i in 0:129]
+        @test count(bv) == 44
+
+        large = masks.large
+        big = convert(BitVector, large)
+        @test length(big) == 1_000_000
+        @test count(big) == 1000 == count(large)
+        @test findfirst(large) == 1000
+
+        # std::vector<bool> is resized; std::bitset keeps its length
+        masks.selected = trues(70)
+        @test length(masks.selected) == 70
+        @test masks.selected_count() == 70
+        assign_bits!(masks.selected, [i % 3 == 0 for i in 0:129])
+        @test BitVector(masks.selected) == bv
+
+        @test_throws DimensionMismatch assign_bits!(masks.flags, trues(10))
+    end
+
+    @testset "Word-wise logic" begin
+        selected = masks.selected
+        evens = BitVector([i % 2 == 0 for i in 0:129])
+        thirds = BitVector([i % 3 == 0 for i in 0:129])
+        and_bits!(selected, evens)
+        @test BitVector(selected) == thirds .& evens
+        or_bits!(selected, evens)
+        @test BitVector(selected) == evens
+        xor_bits!(selected, selected)
+        @test count(selected) == 0
+        @test findfirst(selected) === nothing
+
+        mask = falses(100)
+        mask[[6, 7]] .= true
+        or_bits!(masks.flags, mask)
+        @test findall(masks.flags) == [6, 7, 65, 100]
+        @test_throws DimensionMismatch and_bits!(masks.flags, trues(5))
+    end
+end
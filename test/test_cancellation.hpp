@@ -0,0 +1,79 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/cancellation.hpp>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <stop_token>
+#include <string>
+#include <thread>
+
+// Long-running work that polls a std::stop_token, exposed through
+// glz_jl::register_cancellable_method
+struct BatchJob {
+    std::string label = "job";
+
+    // Runs `steps` 1 ms steps; returns how many completed before a stop request
+    int64_t run(int64_t steps, std::stop_token stop)
+    {
+        int64_t done = 0;
+        for (; done < steps && !stop.stop_requested(); ++done) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return done;
+    }
+
+    std::shared_future<int64_t> runAsync(std::stop_token stop, int64_t steps)
+    {
+        return std::async(std::launch::async, [this, stop, steps] { return run(steps, stop); }).share();
+    }
+
+    // Computes value * 2 after delay_ms, like FutureTest::computeAsync, unless stopped
+    std::future<double> computeAsync(double value, int32_t delay_ms, std::stop_token stop)
+    {
+        return std::async(std::launch::async, [value, delay_ms, stop] {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(delay_ms);
+            while (std::chrono::steady_clock::now() < deadline) {
+                if (stop.stop_requested()) {
+                    throw std::runtime_error("computation cancelled");
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return value * 2.0;
+        });
+    }
+
+    std::string describe(std::stop_token stop, std::string_view prefix) const
+    {
+        return std::string(prefix) + (stop.stop_requested() ? " stopped" : " running");
+    }
+
+    void check(std::stop_token stop) const
+    {
+        if (stop.stop_requested()) {
+            throw std::runtime_error("stop requested");
+        }
+    }
+};
+
+template <>
+struct glz::meta<BatchJob> {
+    using T = BatchJob;
+    static constexpr auto value = object("label", &T::label);
+};
+
+inline BatchJob global_job{};
+
+inline void register_cancellation_test_types() {
+    glz::register_type<BatchJob>("BatchJob");
+
+    glz_jl::register_cancellable_method<&BatchJob::run>("BatchJob", "run");
+    glz_jl::register_cancellable_method<&BatchJob::runAsync>("BatchJob", "runAsync");
+    glz_jl::register_cancellable_method<&BatchJob::computeAsync>("BatchJob", "computeAsync");
+    glz_jl::register_cancellable_method<&BatchJob::describe>("BatchJob", "describe");
+    glz_jl::register_cancellable_method<&BatchJob::check>("BatchJob", "check");
+
+    glz::register_instance("global_job", global_job);
+}
@@ -0,0 +1,85 @@
+# Tests for std::stop_token methods cancelled from Julia
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Cooperative Cancellation" begin
+    job = Glaze.get_instance(lib, "global_job")
+
+    @testset "Synchronous calls" begin
+        @test job.run isa Glaze.CancellableMethod
+        @test job.run(5) == 5
+        @test job.describe("batch") == "batch running"
+        @test job.check() === nothing
+        @test_throws ErrorException job.run()
+
+        # A stop requested up front is seen by the first check
+        stop = StopSource(lib)
+        @test !Glaze.iscancelled(stop)
+        @test Glaze.cancel(stop)
+        @test !Glaze.cancel(stop)          # already requested
+        @test Glaze.iscancelled(stop)
+        @test job.run(1000; stop = stop) == 0
+        @test job.describe(SubString("xbatch", 2); stop = stop) == "batch stopped"
+        err = try
+            job.check(; stop = stop)
+            nothing
+        catch e
+            e
+        end
+        @test err isa ErrorException
+        @test occursin("stop requested", err.msg)
+
+        if Threads.nthreads() > 1
+            # Cancel a call blocking another thread
+            stop = StopSource(lib)
+            t = Threads.@spawn job.run(100_000; stop = stop)
+            sleep(0.05)
+            Glaze.cancel(stop)
+            @test fetch(t) < 100_000
+        end
+    end
+
+    @testset "Futures" begin
+        f = job.runAsync(10)
+        @test f isa CancellableFuture{Int64}
+        @test fetch(f) == 10
+        @test isready(f)
+
+        # Roughly 100 s of work unless cancelled
+        f = job.runAsync(100_000)
+        sleep(0.05)
+        @test !isready(f)
+        @test occursin("pending", string(f))
+        @test Glaze.cancel(f)
+        @test Glaze.iscancelled(f)
+        done = fetch(f)
+        @test 0 < done < 100_000
+
+        # The stop is observed from a task waiting on the future
+        f = job.computeAsync(1.5, 60_000)
+        canceller = @async (sleep(0.05); Glaze.cancel(f))
+        @test_throws ErrorException fetch(f)
+        @test fetch(canceller)
+
+        @test fetch(job.computeAsync(1.5, 10)) == 3.0
+
+        # Dropping an unfinished future stops its work instead of blocking
+        job.runAsync(100_000)
+        GC.gc()
+
+        # Collecting an unfinished future together with its object and stop
+        # source leaves both alive to the C++ work until it has stopped
+        orphaned() = count(w -> w.orphaned, values(Glaze._pending_work))
+        let temp = lib.BatchJob
+            temp.runAsync(100_000; stop = StopSource(lib))
+            nothing
+        end
+        GC.gc(); GC.gc()
+        @test orphaned() >= 1
+        deadline = time() + 10
+        while orphaned() > 0 && time() < deadline
+            sleep(0.01)
+            Glaze.reap_futures!()
+        end
+        @test orphaned() == 0
+    end
+end
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/change_tracking.hpp>
+#include <cstdint>
+#include <vector>
+
+// Struct mutated from C++ member functions that report their changes
+// through glz_jl::mark_dirty
+struct TrackedSensor {
+    double reading = 0.0;
+    int32_t sample_count = 0;
+    std::vector<float> samples;
+    
+    void record(double value) {
+        reading = value;
+        ++sample_count;
+        samples.push_back(static_cast<float>(value));
+        glz_jl::mark_dirty(*this, "reading");
+        glz_jl::mark_dirty(*this, "sample_count");
+        glz_jl::mark_dirty(*this, "samples", samples.size() - 1, 1);
+    }
+    
+    void overwrite_sample(int32_t index, float value) {
+        samples[static_cast<size_t>(index)] = value;
+        glz_jl::mark_dirty(*this, "samples", static_cast<size_t>(index), 1);
+    }
+};
+
+template <>
+struct glz::meta<TrackedSensor> {
+    using T = TrackedSensor;
+    static constexpr auto value = object(
+        "reading", &T::reading,
+        "sample_count", &T::sample_count,
+        "samples", &T::samples,
+        "record", &T::record,
+        "overwrite_sample", &T::overwrite_sample
+    );
+};
+
+inline void register_change_tracking_test_types() {
+    glz::register_type<TrackedSensor>("TrackedSensor");
+}
@@ -0,0 +1,151 @@
+# Tests for dirty-field tracking and change epochs
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Change Tracking" begin
+    @testset "Julia setters" begin
+        obj = lib.TestAllTypes
+        epoch = Glaze.track_changes!(obj)
+        @test Glaze.is_tracked(obj)
+        @test isempty(Glaze.changed_since(obj, epoch))
+
+        obj.int_value = 7
+        obj.string_value = "changed"
+
+        changes = Glaze.changed_since(obj, epoch)
+        @test [c.name for c in changes] == [:int_value, :string_value]
+        @test all(c -> isempty(c.ranges), changes)
+        @test all(c -> c.epoch > epoch, changes)
+
+        # Only changes after the new epoch are reported
+        epoch = Glaze.current_epoch()
+        obj.bool_value = true
+        changes = Glaze.changed_since(obj, epoch)
+        @test length(changes) == 1
+        @test changes[1].name == :bool_value
+
+        Glaze.untrack_changes!(obj)
+        @test !Glaze.is_tracked(obj)
+        @test_throws ErrorException Glaze.changed_since(obj, epoch)
+    end
+
+    @testset "Vector element ranges" begin
+        obj = lib.TestAllTypes
+        resize!(obj.float_vector, 100)
+        epoch = Glaze.track_changes!(obj)
+
+        vec = obj.float_vector
+        for i in 10:20
+            vec[i] = Float32(i)
+        end
+        vec[50] = 1.0f0
+
+        changes = Glaze.changed_since(obj, epoch)
+        @test length(changes) == 1
+        @test changes[1].name == :float_vector
+        @test changes[1].ranges == [10:20, 50:50]
+
+        # Size changes invalidate the whole member
+        push!(vec, 2.0f0)
+        changes = Glaze.changed_since(obj, epoch)
+        @test changes[1].name == :float_vector
+        @test isempty(changes[1].ranges)
+
+        # Writes through array views are recorded manually
+        epoch = Glaze.current_epoch()
+        arr = array_view(obj.float_vector)
+        arr[1:5] .= 0.0f0
+        Glaze.mark_changed!(obj, :float_vector, 1:5)
+        changes = Glaze.changed_since(obj, epoch)
+        @test changes[1].ranges == [1:5]
+
+        # Ranges keep the epoch of their own write
+        epoch = Glaze.current_epoch()
+        vec[30] = 1.0f0
+        middle = Glaze.current_epoch()
+        vec[31] = 2.0f0
+        @test Glaze.changed_since(obj, epoch)[1].ranges == [30:31]
+        @test Glaze.changed_since(obj, middle)[1].ranges == [31:31]
+
+        Glaze.clear_changes!(obj)
+        @test isempty(Glaze.changed_since(obj, 0))
+        Glaze.untrack_changes!(obj)
+    end
+
+    @testset "Extension members" begin
+        light = Glaze.get_instance(lib, "global_light")
+        epoch = Glaze.track_changes!(light)
+        light.level = "Dim"
+        changes = Glaze.changed_since(light, epoch)
+        @test [c.name for c in changes] == [:level]
+
+        epoch = Glaze.current_epoch()
+        Glaze.mark_changed!(light, :color)
+        @test [c.name for c in Glaze.changed_since(light, epoch)] == [:color]
+        Glaze.untrack_changes!(light)
+    end
+
+    @testset "C++ mutations via glz_jl::mark_dirty" begin
+        sensor = lib.TrackedSensor
+        epoch = Glaze.track_changes!(sensor)
+
+        sensor.record(1.5)
+        sensor.record(2.5)
+
+        changes = Glaze.changed_since(sensor, epoch)
+        @test [c.name for c in changes] == [:reading, :sample_count, :samples]
+        @test changes[3].ranges == [1:2]
+        @test sensor.sample_count == 2
+
+        epoch = Glaze.current_epoch()
+        sensor.overwrite_sample(Int32(0), 9.0f0)
+        changes = Glaze.changed_since(sensor, epoch)
+        @test length(changes) == 1
+        @test changes[1].name == :samples
+        @test changes[1].ranges == [1:1]
+        @test sensor.samples[1] == 9.0f0
+
+        # C++ writes carry the epoch of the mutation, not of the drain
+        sensor.record(3.5)
+        epoch = Glaze.current_epoch()
+        sensor.reading = 4.0
+        changes = Glaze.changed_since(sensor, epoch)
+        @test [c.name for c in changes] == [:reading]
+
+        # Untracked objects are not recorded, so nothing accumulates for them
+        other = lib.TrackedSensor
+        epoch = Glaze.current_epoch()
+        for _ in 1:10
+            other.record(3.0)
+        end
+        @test Glaze.current_epoch() == epoch
+        @test isempty(Glaze.changed_since(sensor, epoch))
+
+        # Past its pending-record limit C++ drops records, and the next drain
+        # reports every member of the tracked objects as changed, extension
+        # members included
+        light = Glaze.get_instance(lib, "global_light")
+        Glaze.track_changes!(light)
+        epoch = Glaze.current_epoch()
+        for _ in 1:70_000
+            sensor.overwrite_sample(Int32(0), 1.0f0)
+        end
+        changes = Glaze.changed_since(sensor, epoch)
+        @test [c.name for c in changes] == [:reading, :sample_count, :samples]
+        @test all(c -> isempty(c.ranges), changes)
+        @test :level in [c.name for c in Glaze.changed_since(light, epoch)]
+
+        Glaze.untrack_changes!(light)
+        Glaze.untrack_changes!(sensor)
+    end
+
+    @testset "Collected objects are untracked" begin
+        sensor = lib.TrackedSensor
+        Glaze.track_changes!(sensor)
+        address = getfield(sensor, :ptr)
+        @test haskey(Glaze._tracked_objects, address)
+        # A later allocation at the same address must not inherit the dirty state
+        finalize(sensor)
+        @test !haskey(Glaze._tracked_objects, address)
+        @test !any(p -> p.second[1] == address, Glaze._tracked_members)
+    end
+end
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/chrono.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Time series members exposed through glz_jl::register_chrono_member
+struct TimeSeries {
+    using clock = std::chrono::system_clock;
+    using time_point_ns = std::chrono::time_point<clock, std::chrono::nanoseconds>;
+
+    std::string symbol = "ABC";
+    std::chrono::nanoseconds latency{1500};
+    std::chrono::milliseconds window{250};
+    std::chrono::duration<double> elapsed{0.125};
+    time_point_ns start{std::chrono::nanoseconds(1'700'000'000'123'456'789)};
+    std::chrono::steady_clock::time_point last_tick{};
+    std::vector<time_point_ns> timestamps;
+    std::vector<std::chrono::microseconds> gaps;
+
+    int64_t first_timestamp() const { return timestamps.empty() ? 0 : timestamps.front().time_since_epoch().count(); }
+};
+
+template <>
+struct glz::meta<TimeSeries> {
+    using T = TimeSeries;
+    static constexpr auto value = object("symbol", &T::symbol, "first_timestamp", &T::first_timestamp);
+};
+
+inline TimeSeries global_series = [] {
+    TimeSeries series;
+    for (int64_t i = 0; i < 1000; ++i) {
+        series.timestamps.push_back(series.start + std::chrono::nanoseconds(i * 1000));
+    }
+    series.gaps = {std::chrono::microseconds(1), std::chrono::microseconds(20), std::chrono::microseconds(300)};
+    return series;
+}();
+
+inline void register_chrono_test_types() {
+    glz::register_type<TimeSeries>("TimeSeries");
+
+    glz_jl::register_chrono_member<&TimeSeries::latency>("TimeSeries", "latency");
+    glz_jl::register_chrono_member<&TimeSeries::window>("TimeSeries", "window");
+    glz_jl::register_chrono_member<&TimeSeries::elapsed>("TimeSeries", "elapsed");
+    glz_jl::register_chrono_member<&TimeSeries::start>("TimeSeries", "start");
+    glz_jl::register_chrono_member<&TimeSeries::last_tick>("TimeSeries", "last_tick");
+    glz_jl::register_chrono_member<&TimeSeries::timestamps>("TimeSeries", "timestamps");
+    glz_jl::register_chrono_member<&TimeSeries::gaps>("TimeSeries", "gaps");
+
+    glz::register_instance("global_series", global_series);
+}
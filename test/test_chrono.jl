@@ -0,0 +1,61 @@
+# Tests for std::chrono members read as Dates periods and time points
+# This file is included by runtests.jl, so lib is already defined
+
+using Dates
+
+@testset "Chrono Members" begin
+    series = Glaze.get_instance(lib, "global_series")
+
+    @testset "Durations" begin
+        @test series.latency === Nanosecond(1500)
+        @test series.window === Millisecond(250)
+        # duration<double> has no Dates type: read as rounded nanoseconds
+        @test series.elapsed === Nanosecond(125_000_000)
+
+        series.latency = Microsecond(3)
+        @test series.latency === Nanosecond(3000)
+        series.elapsed = Millisecond(500)
+        @test series.elapsed === Nanosecond(500_000_000)
+        @test_throws InexactError series.window = Nanosecond(1)
+    end
+
+    @testset "Time points" begin
+        start = series.start
+        @test start isa TimePoint{:system, Nanosecond}
+        @test Nanosecond(start) == Nanosecond(1_700_000_000_123_456_789)
+        @test DateTime(start) == DateTime(2023, 11, 14, 22, 13, 20, 123)
+        @test series.last_tick isa TimePoint{:steady, Nanosecond}
+
+        series.start = DateTime(2024, 1, 1)
+        @test DateTime(series.start) == DateTime(2024, 1, 1)
+        series.start = start + Second(1)
+        @test series.start - start == Nanosecond(1_000_000_000)
+        @test_throws ErrorException series.last_tick = DateTime(2024, 1, 1)
+        series.start = start
+    end
+
+    @testset "Zero-copy columns" begin
+        stamps = series.timestamps
+        @test stamps isa CppArrayView{TimePoint{:system, Nanosecond}, 1}
+        @test length(stamps) == 1000
+        @test stamps[1] == series.start
+        @test stamps[end] - stamps[1] == Nanosecond(999_000)
+        @test issorted(stamps)
+
+        # Int64-backed: the raw counts share the C++ buffer
+        counts = reinterpret(Int64, stamps)
+        @test counts[1] == 1_700_000_000_123_456_789
+        counts[1] -= 1
+        @test series.first_timestamp() == 1_700_000_000_123_456_788
+        counts[1] += 1
+
+        gaps = series.gaps
+        @test gaps isa CppArrayView{Microsecond, 1}
+        @test collect(gaps) == Microsecond.([1, 20, 300])
+
+        series.gaps = [Millisecond(1), Microsecond(5)]
+        @test series.gaps == [Microsecond(1000), Microsecond(5)]
+        series.timestamps = [DateTime(2024, 1, 1), DateTime(2024, 1, 2)]
+        @test DateTime.(series.timestamps) == [DateTime(2024, 1, 1), DateTime(2024, 1, 2)]
+    end
+end
@@ -0,0 +1,52 @@
+# Tests for split real/imaginary views and planar conversion of complex vectors
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Complex Planar Views" begin
+    obj = lib.TestFloatVectors
+    z32 = obj.vec_complex_f32
+    z64 = obj.vec_complex_f64
+    for k in 1:100
+        push!(z32, ComplexF32(k, -k))
+        push!(z64, ComplexF64(k / 2, 2k))
+    end
+
+    @testset "Strided views" begin
+        re = real_view(z32)
+        im = imag_view(z32)
+        @test length(re) == 100
+        @test re == Float32.(1:100)
+        @test im == -Float32.(1:100)
+        @test strides(re) == (2,)
+
+        # Writes go to the interleaved storage
+        re[3] = 30.0f0
+        im[3] = 0.5f0
+        @test z32[3] == ComplexF32(30, 0.5)
+        re[3] = 3.0f0
+        im[3] = -3.0f0
+
+        @test sum(real_view(z64)) ≈ sum(k / 2 for k in 1:100)
+        @test real_view(array_view(z64)) == real.(collect(z64))
+    end
+
+    @testset "Bulk conversion" begin
+        re, im = to_planar(z64)
+        @test re == [k / 2 for k in 1:100]
+        @test im == [2.0k for k in 1:100]
+
+        re32 = Vector{Float32}(undef, 100)
+        im32 = Vector{Float32}(undef, 100)
+        to_planar!(re32, im32, z32)
+        @test re32 == Float32.(1:100) && im32 == -Float32.(1:100)
+        @test_throws DimensionMismatch to_planar!(re32[1:10], im32, z32)
+        @test_throws ArgumentError to_planar!(re, im, z32)
+
+        from_planar!(z32, Float32[1, 2, 3], Float32[4, 5, 6])
+        @test length(z32) == 3
+        @test collect(z32) == ComplexF32[1 + 4im, 2 + 5im, 3 + 6im]
+
+        from_planar!(z64, re .* 2, im)
+        @test collect(z64) == complex.(re .* 2, im)
+        @test_throws DimensionMismatch from_planar!(z64, [1.0], [1.0, 2.0])
+    end
+end
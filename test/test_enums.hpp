@@ -0,0 +1,52 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/enums.hpp>
+#include <cstdint>
+#include <string>
+
+enum class Color : uint8_t { Red = 1, Green = 2, Blue = 4 };
+
+template <>
+struct glz::meta<Color> {
+    using enum Color;
+    static constexpr auto value = enumerate(Red, Green, Blue);
+};
+
+namespace lighting {
+    enum Level : int32_t { Off = -1, Dim = 0, Bright = 10 };
+}
+
+template <>
+struct glz::meta<lighting::Level> {
+    using enum lighting::Level;
+    static constexpr auto value = enumerate(Off, Dim, Bright);
+};
+
+// Enum members exposed through glz_jl::register_enum_member
+struct Light {
+    std::string name = "lamp";
+    Color color = Color::Green;
+    Color backup = Color::Red;
+    lighting::Level level = lighting::Bright;
+
+    bool is_blue() const { return color == Color::Blue; }
+};
+
+template <>
+struct glz::meta<Light> {
+    using T = Light;
+    static constexpr auto value = object("name", &T::name, "is_blue", &T::is_blue);
+};
+
+inline Light global_light{};
+
+inline void register_enum_test_types() {
+    glz::register_type<Light>("Light");
+
+    glz_jl::register_enum_member<&Light::color>("Light", "color", "Color");
+    glz_jl::register_enum_member<&Light::backup>("Light", "backup", "Color");
+    glz_jl::register_enum_member<&Light::level>("Light", "level");
+
+    glz::register_instance("global_light", global_light);
+}
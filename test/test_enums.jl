@@ -0,0 +1,53 @@
+# Tests for enum members read as generated Julia enums
+# This file is included by runtests.jl, so lib is already defined
+
+# Generate the enum types in their own top-level statements, so the methods
+# defined by @enum are visible to the testset below
+light = Glaze.get_instance(lib, "global_light")
+enum_type(light, :color), enum_type(light, :level)
+
+@testset "Enum Members" begin
+
+    @testset "Generated enum types" begin
+        Color = enum_type(light, :color)
+        @test Color <: Enum{UInt8}
+        @test nameof(Color) == :Color
+        @test Symbol.(instances(Color)) == (:Red, :Green, :Blue)
+        @test Integer.(instances(Color)) == (0x01, 0x02, 0x04)
+
+        # Built once per C++ enum type, shared by every member of that type
+        @test enum_type(light, :backup) === Color
+        @test enum_type(Glaze.get_instance(lib, "global_light"), :color) === Color
+
+        Level = enum_type(light, :level)
+        @test Level <: Enum{Int32}
+        @test nameof(Level) == :Level
+        @test Integer(first(instances(Level))) == -1
+
+        @test_throws ErrorException enum_type(light, :name)
+    end
+
+    @testset "Reading and writing" begin
+        Color = enum_type(light, :color)
+        @test light.color isa Color
+        @test Symbol(light.color) == :Green
+        @test Symbol(light.backup) == :Red
+        @test Integer(light.level) == 10
+
+        light.color = :Blue
+        @test Symbol(light.color) == :Blue
+        @test light.is_blue()
+
+        light.color = Color(2)
+        @test light.color == Color(2)
+        @test !light.is_blue()
+
+        light.level = -1
+        @test Symbol(light.level) == :Off
+        light.level = "Dim"
+        @test Integer(light.level) == 0
+
+        @test_throws ErrorException light.color = :Purple
+        @test_throws ErrorException light.color = 1.5
+    end
+end
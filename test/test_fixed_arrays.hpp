@@ -0,0 +1,51 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/fixed_arrays.hpp>
+#include <array>
+#include <complex>
+#include <string>
+
+// Fixed-size math members exposed through glz_jl::register_array_member
+struct RigidBody {
+    std::string name = "body";
+    std::array<double, 3> position{1.0, 2.0, 3.0};
+    std::array<double, 4> orientation{1.0, 0.0, 0.0, 0.0};
+    std::array<std::array<float, 4>, 4> transform{};
+    std::array<std::complex<double>, 2> phases{};
+    std::array<int32_t, 64> samples{};
+
+    double norm() const { return position[0] * position[0] + position[1] * position[1] + position[2] * position[2]; }
+};
+
+template <>
+struct glz::meta<RigidBody> {
+    using T = RigidBody;
+    static constexpr auto value = object("name", &T::name, "norm", &T::norm);
+};
+
+inline RigidBody global_body = [] {
+    RigidBody body;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            body.transform[i][j] = float(10 * i + j);
+        }
+    }
+    body.phases = {std::complex<double>(1.0, 2.0), std::complex<double>(3.0, 4.0)};
+    for (int i = 0; i < 64; ++i) {
+        body.samples[i] = i;
+    }
+    return body;
+}();
+
+inline void register_fixed_array_test_types() {
+    glz::register_type<RigidBody>("RigidBody");
+
+    glz_jl::register_array_member<&RigidBody::position>("RigidBody", "position");
+    glz_jl::register_array_member<&RigidBody::orientation>("RigidBody", "orientation");
+    glz_jl::register_array_member<&RigidBody::transform>("RigidBody", "transform");
+    glz_jl::register_array_member<&RigidBody::phases>("RigidBody", "phases");
+    glz_jl::register_array_member<&RigidBody::samples>("RigidBody", "samples");
+
+    glz::register_instance("global_body", global_body);
+}
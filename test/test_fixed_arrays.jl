@@ -0,0 +1,50 @@
+# Tests for std::array members read as NTuples and zero-copy views
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Fixed-Size Array Members" begin
+    body = Glaze.get_instance(lib, "global_body")
+
+    @testset "Small arrays as NTuples" begin
+        @test body.position === (1.0, 2.0, 3.0)
+        @test body.orientation isa NTuple{4, Float64}
+        @test isbits(body.orientation)
+        @test body.phases === (1.0 + 2.0im, 3.0 + 4.0im)
+
+        # 4x4 matrix: nested tuples in C++ layout
+        transform = body.transform
+        @test transform isa NTuple{4, NTuple{4, Float32}}
+        @test transform[2][3] == 12.0f0
+
+        body.position = (4.0, 5.0, 6.0)
+        @test body.position === (4.0, 5.0, 6.0)
+        @test body.norm() == 16.0 + 25.0 + 36.0
+        body.orientation = [0.0, 1.0, 0.0, 0.0]
+        @test body.orientation === (0.0, 1.0, 0.0, 0.0)
+        @test_throws DimensionMismatch body.position = [1.0, 2.0]
+    end
+
+    @testset "Large arrays as views" begin
+        samples = body.samples
+        @test samples isa CppArrayView{Int32, 1}
+        @test length(samples) == 64
+        @test sum(samples) == sum(0:63)
+        samples[1] = 100
+        @test body.samples[1] == 100
+    end
+
+    @testset "Nested arrays as 2-D views" begin
+        m = array_view(body, :transform)
+        @test size(m) == (4, 4)
+        # Indexed like the C++ array: m[i, j] == transform[i-1][j-1]
+        @test m[2, 3] == 12.0f0
+        @test m[4, 1] == 30.0f0
+        m[1, 2] = 99.0f0
+        @test body.transform[1][2] == 99.0f0
+        @test Matrix(m)[1, :] == Float32[0, 99, 2, 3]
+
+        body.transform = ntuple(i -> ntuple(j -> Float32(i == j), 4), 4)
+        @test m[3, 3] == 1.0f0 && m[3, 4] == 0.0f0
+
+        @test_throws ErrorException array_view(body, :name)
+    end
+end
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/generators.hpp>
+#include <cstdint>
+#include <ranges>
+#include <string>
+
+struct Trade {
+    int64_t id = 0;
+    double price = 0.0;
+    std::string symbol;
+};
+
+template <>
+struct glz::meta<Trade> {
+    using T = Trade;
+    static constexpr auto value = object("id", &T::id, "price", &T::price, "symbol", &T::symbol);
+};
+
+// Producers exposed through glz_jl::register_generator_method. `produced`
+// counts yielded elements, so tests can check that streams are pulled lazily.
+struct TradeFeed {
+    std::string venue = "XNYS";
+    int64_t produced = 0;
+
+    // Lazy input range; available without std::generator
+    auto ids(int64_t n)
+    {
+        return std::views::iota(int64_t{0}, n) | std::views::transform([this](int64_t i) {
+                   ++produced;
+                   return i;
+               });
+    }
+
+#if defined(__cpp_lib_generator)
+    std::generator<double> prices(int64_t n, double start)
+    {
+        for (int64_t i = 0; i < n; ++i) {
+            ++produced;
+            co_yield start + 0.25 * double(i);
+        }
+    }
+
+    std::generator<std::string> symbols(std::string prefix, int32_t n)
+    {
+        for (int32_t i = 0; i < n; ++i) {
+            ++produced;
+            co_yield prefix + std::to_string(i);
+        }
+    }
+
+    std::generator<Trade> trades(int64_t n)
+    {
+        for (int64_t i = 0; i < n; ++i) {
+            ++produced;
+            co_yield Trade{i, 100.0 + double(i), venue};
+        }
+    }
+#endif
+};
+
+template <>
+struct glz::meta<TradeFeed> {
+    using T = TradeFeed;
+    static constexpr auto value = object("venue", &T::venue, "produced", &T::produced);
+};
+
+inline TradeFeed global_feed{};
+
+inline void register_generator_test_types() {
+    glz::register_type<Trade>("Trade");
+    glz::register_type<TradeFeed>("TradeFeed");
+
+    glz_jl::register_generator_method<&TradeFeed::ids>("TradeFeed", "ids");
+#if defined(__cpp_lib_generator)
+    glz_jl::register_generator_method<&TradeFeed::prices>("TradeFeed", "prices");
+    glz_jl::register_generator_method<&TradeFeed::symbols>("TradeFeed", "symbols");
+    glz_jl::register_generator_method<&TradeFeed::trades>("TradeFeed", "trades", "Trade");
+#endif
+
+    glz::register_instance("global_feed", global_feed);
+}
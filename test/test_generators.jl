@@ -0,0 +1,81 @@
+# Tests for generator member functions pulled in batches
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Generator Methods" begin
+    feed = Glaze.get_instance(lib, "global_feed")
+
+    @testset "Batched pulls" begin
+        @test feed.ids isa GeneratorMethod
+        feed.produced = 0
+
+        g = feed.ids(2500; batch = 1000)
+        @test g isa CppGenerator{Int64}
+        @test feed.produced == 0          # nothing runs before the first pull
+
+        x, _ = iterate(g)
+        @test x == 0
+        @test feed.produced == 1000       # one batch
+        @test sum(g) == sum(1:2499)       # continues after the first element
+        @test feed.produced == 2500
+        @test !isopen(g)
+        @test iterate(g) === nothing
+
+        @test collect(feed.ids(3)) == [0, 1, 2]
+        @test isempty(collect(feed.ids(0)))
+        @test_throws ErrorException feed.ids()
+        @test_throws ErrorException feed.ids(3; batch = 0)
+    end
+
+    @testset "Early close" begin
+        feed.produced = 0
+        g = feed.ids(10_000; batch = 64)
+        for x in g
+            x == 10 && break
+        end
+        @test feed.produced == 64
+        close(g)
+        @test !isopen(g)
+        @test iterate(g) === nothing
+        @test feed.produced == 64
+    end
+
+    # std::generator methods need a standard library with <generator>
+    prices = try
+        feed.prices
+    catch
+        nothing
+    end
+    if prices !== nothing
+        @testset "std::generator" begin
+            feed.produced = 0
+            g = prices(1_000_000, 10.0; batch = 4096)
+            @test eltype(g) === Float64
+            @test first(g) == 10.0
+            # The coroutine is at most one element ahead of the batch
+            @test 4096 <= feed.produced <= 4097
+            close(g)
+
+            total = 0.0
+            for p in feed.prices(100_000, 0.0)
+                total += p
+            end
+            @test total ≈ 0.25 * sum(0:99_999)
+
+            @test collect(feed.symbols("AB", 3)) == ["AB0", "AB1", "AB2"]
+            @test feed.symbols(SubString("XYZ", 1, 1), 2) |> collect == ["X0", "X1"]
+
+            trades = collect(feed.trades(5; batch = 2))
+            @test length(trades) == 5
+            @test all(t -> t isa CppStruct, trades)
+            @test [t.id for t in trades] == 0:4
+            @test trades[end].price == 104.0
+            @test String(trades[1].symbol) == "XNYS"
+
+            # Struct elements pulled but never handed out are freed on close
+            g = feed.trades(10; batch = 8)
+            @test first(g).id == 0
+            close(g)
+            GC.gc()
+        end
+    end
+end
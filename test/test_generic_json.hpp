@@ -0,0 +1,57 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze/json/generic.hpp>
+#include <glaze_jl/generic.hpp>
+#include <string>
+
+// Schemaless payload exposed through glz_jl::register_generic_member
+struct Event {
+    std::string kind = "order";
+    glz::generic payload;
+    glz::generic tags;
+};
+
+template <>
+struct glz::meta<Event> {
+    using T = Event;
+    static constexpr auto value = object("kind", &T::kind);
+};
+
+// Built through the `data` variant so only Glaze's generic layout is assumed
+inline Event global_event = [] {
+    Event event;
+    glz::generic::object_t customer;
+    customer["name"].data = std::string("Ada");
+    customer["vip"].data = true;
+
+    glz::generic::array_t items(3);
+    for (int i = 0; i < 3; ++i) {
+        glz::generic::object_t item;
+        item["sku"].data = "A-" + std::to_string(i + 1);
+        item["qty"].data = double(i + 1);
+        items[i].data = std::move(item);
+    }
+
+    glz::generic::object_t payload;
+    payload["id"].data = 1042.0;
+    payload["customer"].data = std::move(customer);
+    payload["items"].data = std::move(items);
+    payload["note"].data = nullptr;
+    event.payload.data = std::move(payload);
+
+    glz::generic::array_t tags(2);
+    tags[0].data = std::string("new");
+    tags[1].data = std::string("paid");
+    event.tags.data = std::move(tags);
+    return event;
+}();
+
+inline void register_generic_json_test_types() {
+    glz::register_type<Event>("Event");
+
+    glz_jl::register_generic_member<&Event::payload>("Event", "payload");
+    glz_jl::register_generic_member<&Event::tags>("Event", "tags");
+
+    glz::register_instance("global_event", global_event);
+}
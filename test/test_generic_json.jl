@@ -0,0 +1,91 @@
+# Tests for glz::generic members read as lazy dictionaries and vectors
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Generic JSON Members" begin
+    event = Glaze.get_instance(lib, "global_event")
+
+    @testset "Navigation" begin
+        payload = event.payload
+        @test payload isa CppJsonObject
+        @test payload isa AbstractDict{String, Any}
+        @test length(payload) == 4
+        @test sort(collect(keys(payload))) == ["customer", "id", "items", "note"]
+        @test payload["id"] === 1042.0
+        @test payload["note"] === nothing
+        @test haskey(payload, :customer)
+        @test !haskey(payload, "missing")
+        @test get(payload, "missing", 0) == 0
+        @test_throws KeyError payload["missing"]
+
+        customer = payload["customer"]
+        @test customer isa CppJsonObject
+        @test customer["name"] == "Ada"
+        @test customer["vip"] === true
+
+        items = payload["items"]
+        @test items isa CppJsonArray
+        @test length(items) == 3
+        @test items[2]["sku"] == "A-2"
+        @test [item["qty"] for item in items] == [1.0, 2.0, 3.0]
+        @test_throws BoundsError items[4]
+
+        @test event.tags == ["new", "paid"]
+    end
+
+    @testset "Bulk conversion" begin
+        d = copy(event.payload)
+        @test d isa Dict{String, Any}
+        @test d["customer"] == Dict{String, Any}("name" => "Ada", "vip" => true)
+        @test d["items"][3] == Dict{String, Any}("sku" => "A-3", "qty" => 3.0)
+        @test d["items"] isa Vector{Any}
+        @test copy(event.tags) == Any["new", "paid"]
+    end
+
+    @testset "In-place mutation" begin
+        payload = event.payload
+        payload["customer"]["vip"] = false
+        @test event.payload["customer"]["vip"] === false
+
+        payload["note"] = "leave at door"
+        @test payload["note"] == "leave at door"
+        payload["id"] = 7
+        @test payload["id"] == 7
+
+        payload["shipping"] = Dict("method" => "air", "days" => [1, 2])
+        @test payload["shipping"]["method"] == "air"
+        @test copy(payload["shipping"]["days"]) == [1, 2]
+        delete!(payload, "shipping")
+        @test !haskey(payload, "shipping")
+
+        items = payload["items"]
+        push!(items, Dict("sku" => "B-1", "qty" => 10.0))
+        @test length(payload["items"]) == 4
+        items[4]["qty"] = 11.5
+        @test payload["items"][4]["qty"] == 11.5
+        deleteat!(items, 4)
+        @test length(items) == 3
+
+        # Copy a subtree within the same tree in C++
+        payload["first_item"] = items[1]
+        @test payload["first_item"]["sku"] == "A-1"
+        delete!(payload, "first_item")
+
+        tags = event.tags
+        push!(tags, :shipped)
+        @test tags[end] == "shipped"
+        resize!(tags, 2)
+        @test copy(tags) == ["new", "paid"]
+    end
+
+    @testset "Member assignment" begin
+        saved = copy(event.tags)
+        event.tags = Dict("a" => 1.5, "b" => nothing)
+        @test event.tags isa CppJsonObject
+        @test copy(event.tags) == Dict{String, Any}("a" => 1.5, "b" => nothing)
+        event.tags = 3.0
+        @test event.tags === 3.0
+        event.tags = saved
+        @test event.tags == ["new", "paid"]
+        @test_throws ErrorException event.tags = 1 + 2im
+    end
+end
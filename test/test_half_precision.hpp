@@ -0,0 +1,56 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/fixed_arrays.hpp>
+#include <glaze_jl/jagged.hpp>
+#include <glaze_jl/pointers.hpp>
+#include <array>
+#include <string>
+#include <vector>
+#if __has_include(<stdfloat>)
+#include <stdfloat>
+#endif
+
+#if defined(__STDCPP_FLOAT16_T__) && defined(__STDCPP_BFLOAT16_T__)
+#define GLZ_JL_TEST_HALF_PRECISION 1
+
+// Half-precision members exposed through the glaze_jl helpers
+struct HalfBuffer {
+    std::string name = "half";
+    std::array<std::float16_t, 4> scale{1.0f16, 0.5f16, 0.25f16, 2.0f16};
+    std::array<std::float16_t, 32> activations{};
+    std::array<std::bfloat16_t, 32> weights{};
+    std::vector<std::vector<std::float16_t>> batches{{1.0f16, 2.0f16}, {3.0f16}};
+    std::float16_t* peak = nullptr;
+};
+
+template <>
+struct glz::meta<HalfBuffer> {
+    using T = HalfBuffer;
+    static constexpr auto value = object("name", &T::name);
+};
+
+inline HalfBuffer global_half = [] {
+    HalfBuffer buffer;
+    for (int i = 0; i < 32; ++i) {
+        buffer.activations[i] = std::float16_t(0.5f * i);
+        buffer.weights[i] = std::bfloat16_t(float(i) - 16.0f);
+    }
+    buffer.peak = &buffer.activations[31];
+    return buffer;
+}();
+#endif
+
+inline void register_half_precision_test_types() {
+#if defined(GLZ_JL_TEST_HALF_PRECISION)
+    glz::register_type<HalfBuffer>("HalfBuffer");
+
+    glz_jl::register_array_member<&HalfBuffer::scale>("HalfBuffer", "scale");
+    glz_jl::register_array_member<&HalfBuffer::activations>("HalfBuffer", "activations");
+    glz_jl::register_array_member<&HalfBuffer::weights>("HalfBuffer", "weights");
+    glz_jl::register_jagged_member<&HalfBuffer::batches>("HalfBuffer", "batches");
+    glz_jl::register_pointer_member<&HalfBuffer::peak>("HalfBuffer", "peak");
+
+    glz::register_instance("global_half", global_half);
+#endif
+}
@@ -0,0 +1,62 @@
+# Tests for Float16 and BFloat16 element types
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Half-Precision Elements" begin
+    @testset "BFloat16 conversions" begin
+        @test sizeof(BFloat16) == 2
+        @test Float32(BFloat16(1.0)) == 1.0f0
+        @test Float32(BFloat16(-16.0)) == -16.0f0
+        @test reinterpret(UInt16, BFloat16(1.0f0)) == 0x3f80
+        # Round to nearest even on the dropped mantissa bits
+        @test Float32(BFloat16(1.00390625f0)) == 1.0f0
+        @test Float32(BFloat16(1.01171875f0)) == 1.015625f0
+        @test isnan(BFloat16(NaN32))
+        @test isinf(BFloat16(Inf32))
+        @test BFloat16(2) + BFloat16(3) == BFloat16(5)
+        @test BFloat16(1.5) * 2.0f0 === 3.0f0
+        @test -BFloat16(2) < zero(BFloat16)
+        @test Glaze.type_symbol_to_type(:bfloat16) === BFloat16
+        @test Glaze.type_symbol_to_type(:float16) === Float16
+        @test Glaze.primitive_kind_to_julia_type(UInt64(12)) === Float16
+        @test Glaze.primitive_kind_to_julia_type(UInt64(13)) === BFloat16
+    end
+
+    @testset "Primitive descriptors" begin
+        for T in (Float16, BFloat16)
+            desc = Glaze.create_primitive_descriptor(T)
+            @test Glaze.julia_type_from_descriptor(Ptr{Glaze.TypeDescriptor}(desc)) === T
+        end
+    end
+
+    # HalfBuffer is only registered when the compiler provides std::float16_t and std::bfloat16_t
+    half = try
+        Glaze.get_instance(lib, "global_half")
+    catch
+        nothing
+    end
+    if half !== nothing
+        @testset "Members and views" begin
+            @test half.scale === Float16.((1.0, 0.5, 0.25, 2.0))
+            half.scale = (2.0, 1.0, 0.5, 0.25)
+            @test half.scale === Float16.((2.0, 1.0, 0.5, 0.25))
+
+            activations = half.activations
+            @test activations isa CppArrayView{Float16, 1}
+            @test activations[3] == Float16(1.0)
+            activations[1] = Float16(8.0)
+            @test half.activations[1] == Float16(8.0)
+
+            weights = array_view(half, :weights)
+            @test eltype(weights) === BFloat16
+            @test Float32.(weights[1:3]) == Float32[-16, -15, -14]
+            weights[1] = BFloat16(0.5)
+            @test half.weights[1] == BFloat16(0.5)
+
+            batches = half.batches
+            @test collect(batches[1]) == Float16[1, 2]
+            @test eltype(batches[2]) === Float16
+
+            @test half.peak === Float16(15.5)
+        end
+    end
+end
@@ -0,0 +1,94 @@
+# Tests for opt-in FFI instrumentation and trace export
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "FFI Instrumentation" begin
+    obj = lib.TestFloatVectors
+    v = obj.vec_f64
+    resize!(v, 8)
+
+    @testset "Disabled by default" begin
+        @test !Glaze.instrumentation_enabled()
+        Glaze.reset_stats()
+        v[1] = 1.0
+        @test isempty(Glaze.stats())
+    end
+
+    @testset "Counts per entry point and call site" begin
+        Glaze.enable_instrumentation!()
+        try
+            Glaze.reset_stats()
+            for i in 1:8
+                v[i] = i
+            end
+            @test sum(v) == 36.0
+            resize!(v, 8)
+
+            s = Glaze.stats()
+            byname = Dict(x.name => x for x in s if !x.native)
+            @test haskey(byname, "glz_vector_float64_view")
+            @test haskey(byname, "glz_vector_float64_resize")
+            @test byname["glz_vector_float64_resize"].count == 1
+            view_stats = byname["glz_vector_float64_view"]
+            @test view_stats.count >= 9   # 8 writes and at least one read
+            @test sum(view_stats.histogram) == view_stats.count
+            @test view_stats.max_ns <= view_stats.total_ns
+            @test Glaze.mean_ns(view_stats) <= view_stats.max_ns
+            @test issorted([x.total_ns for x in s if !x.native]; rev=true)
+
+            # Split by the Glaze wrapper that made the crossing
+            sites = [x for x in Glaze.stats(; by_site=true) if x.name == "glz_vector_float64_view"]
+            @test length(sites) >= 2
+            @test all(x -> startswith(x.site, "vectors.jl:"), sites)
+            @test sum(x.count for x in sites) == view_stats.count
+
+            # Member accessors are labelled by the expression that produced the pointer
+            obj.vec_f64
+            @test any(x -> x.name == "member.getter", Glaze.stats())
+
+            # Timings recorded inside C++ by GLZ_JL_TIMED
+            z = obj.vec_complex_f64
+            resize!(z, 16)
+            to_planar(z)
+            native = [x for x in Glaze.stats() if x.native]
+            @test any(x -> x.name == "glz_jl_complexf64_to_planar" && x.count == 1, native)
+
+            Glaze.reset_stats()
+            @test isempty(Glaze.stats())
+        finally
+            Glaze.disable_instrumentation!()
+        end
+
+        v[1] = 1.0
+        @test isempty(Glaze.stats())
+    end
+
+    @testset "Chrome trace export" begin
+        Glaze.enable_instrumentation!(trace=true)
+        try
+            Glaze.reset_stats()
+            Glaze.trace_span("fill \"vector\"") do
+                for i in 1:4
+                    v[i] = 2i
+                end
+            end
+        finally
+            Glaze.disable_instrumentation!()
+        end
+
+        path = tempname() * ".json"
+        try
+            @test Glaze.export_trace(path) == path
+            trace = read(path, String)
+            @test startswith(trace, "{\"displayTimeUnit\"")
+            @test occursin("\"traceEvents\": [", trace)
+            @test count("\"cat\": \"ffi\"", trace) == 4
+            @test occursin("\"name\": \"glz_vector_float64_view\"", trace)
+            @test occursin("\"name\": \"fill \\\"vector\\\"\", \"cat\": \"span\"", trace)
+            @test occursin("\"ph\": \"X\"", trace)
+            @test endswith(rstrip(trace), "]}")
+        finally
+            rm(path; force=true)
+        end
+        Glaze.reset_stats()
+    end
+end
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/jagged.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Ragged event data: one inner vector per event
+struct EventBatch {
+    std::string run = "run-1";
+    std::vector<std::vector<float>> hits;
+    std::vector<std::vector<int32_t>> channels;
+
+    size_t hit_count() const
+    {
+        size_t n = 0;
+        for (const auto& h : hits) n += h.size();
+        return n;
+    }
+};
+
+template <>
+struct glz::meta<EventBatch> {
+    using T = EventBatch;
+    // hits is also registered as a jagged member; channels only is not in meta
+    static constexpr auto value = object("run", &T::run, "hits", &T::hits, "hit_count", &T::hit_count);
+};
+
+inline EventBatch global_events = [] {
+    EventBatch batch;
+    batch.hits = {{1.0f, 2.0f, 3.0f}, {}, {4.0f}, {5.0f, 6.0f}};
+    batch.channels = {{7}, {8, 9}};
+    return batch;
+}();
+
+inline void register_jagged_vector_test_types() {
+    glz::register_type<EventBatch>("EventBatch");
+
+    glz_jl::register_jagged_member<&EventBatch::hits>("EventBatch", "hits");
+    glz_jl::register_jagged_member<&EventBatch::channels>("EventBatch", "channels");
+
+    glz::register_instance("global_events", global_events);
+}
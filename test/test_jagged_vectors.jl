@@ -0,0 +1,53 @@
+# Tests for jagged vector<vector<T>> members
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Jagged Vectors" begin
+    events = Glaze.get_instance(lib, "global_events")
+
+    @testset "Zero-copy inner views" begin
+        hits = events.hits
+        @test hits isa CppJaggedVector{Float32}
+        @test length(hits) == 4
+        @test hits[1] isa CppArrayView{Float32, 1}
+        @test hits[1] == Float32[1, 2, 3]
+        @test Base.isempty(hits[2])
+        @test sum(sum, hits) == 21.0f0
+
+        hits[4][2] = 60.0f0
+        @test events.hits[4] == Float32[5, 60]
+        hits[4][2] = 6.0f0
+
+        @test events.channels isa CppJaggedVector{Int32}
+        @test collect(events.channels) == [Int32[7], Int32[8, 9]]
+    end
+
+    @testset "Flat buffers" begin
+        values, offsets = flatten_jagged(events.hits)
+        @test values == Float32[1, 2, 3, 4, 5, 6]
+        @test offsets == [1, 4, 4, 5, 7]
+        @test values[offsets[4]:offsets[5]-1] == Float32[5, 6]
+
+        # Rebuild from flat buffers in one call
+        assign_jagged!(events.hits, Float32[10, 20, 30], [1, 2, 2, 4])
+        @test collect(events.hits) == [Float32[10], Float32[], Float32[20, 30]]
+        @test events.hit_count() == 3
+
+        @test_throws DimensionMismatch assign_jagged!(events.hits, Float32[1], [1, 3])
+        @test_throws ArgumentError assign_jagged!(events.hits, Float32[1, 2], [1, 3, 2, 3])
+
+        # Whole-member assignment from Julia vectors of vectors
+        events.channels = [[1, 2, 3], Int[], [4]]
+        @test collect(events.channels) == [Int32[1, 2, 3], Int32[], Int32[4]]
+
+        events.hits = [[1.0, 2.0, 3.0], [], [4.0], [5.0, 6.0]]
+        @test flatten_jagged(events.hits)[1] == Float32[1, 2, 3, 4, 5, 6]
+    end
+
+    @testset "Registration resolved once per member" begin
+        info = events.info
+        member = unsafe_load(info.members, Glaze.member_index(info, :hits))
+        lookup(obj, m) = Glaze.registered_member(obj, m)
+        @test lookup(events, member).name == Glaze.find_extension_member(events, :hits).name
+        @test (@allocated lookup(events, member)) == 0
+    end
+end
@@ -15,4 +15,14 @@
 #include "variant_animals_demo.cpp"
 
 // Include the interop implementation
-#include "build/_deps/glaze-src/src/interop/interop.cpp"
\ No newline at end of file
+#include "build/_deps/glaze-src/src/interop/interop.cpp"
+
+// Include the Glaze.jl helper implementations
+#include <glaze_jl/change_tracking.cpp>
+#include <glaze_jl/extensions.cpp>
+#include <glaze_jl/planar.cpp>
+#include <glaze_jl/tuples.cpp>
+#include <glaze_jl/cancellation.cpp>
+#include <glaze_jl/instrumentation.cpp>
+#include <glaze_jl/accounting.cpp>
+#include <glaze_jl/beve.cpp>
\ No newline at end of file
@@ -0,0 +1,71 @@
+# Tests for live-object accounting and leak detection
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Live Object Accounting" begin
+    GC.gc()
+
+    @testset "Instances per registered type" begin
+        before = Glaze.live_count("Calculator")
+        calcs = [lib.Calculator for _ in 1:3]
+        @test Glaze.live_count("Calculator") == before + 3
+
+        entry = only(x for x in Glaze.live_objects() if x.name == "Calculator")
+        @test !entry.native
+        @test entry.bytes == entry.live * Int(calcs[1].info.size)
+        @test entry.created - entry.destroyed == entry.live
+
+        foreach(finalize, calcs)
+        @test Glaze.live_count("Calculator") == before
+    end
+
+    @testset "Member call temporaries are released" begin
+        processor = lib.VectorProcessor
+        @test processor.dotProduct([1.0, 2.0, 3.0], [4.0, 5.0, 6.0]) == 32.0
+        @test processor.joinStrings(["a", "βc"], ", ") == "a, βc"
+        @test Glaze.live_count(Glaze.TEMP_STRING) == 0
+        @test Glaze.live_count(Glaze.TEMP_VECTOR) == 0
+
+        # Temporaries made before a failing argument conversion are destroyed too
+        @test_throws ErrorException processor.joinStrings(["a"], 42)
+        @test Glaze.live_count(Glaze.TEMP_VECTOR) == 0
+        finalize(processor)
+    end
+
+    @testset "Shared futures and their struct results" begin
+        future_test = get_instance(lib, "global_future_test")
+        before = Glaze.live_objects()
+        future = future_test.getPersonAsync("Ada", 36, 0)
+        person = get(future)
+        @test person.name == "Ada"
+        leaks = Dict(x.name => x for x in Glaze.leaked_since(before))
+        @test leaks[Glaze.SHARED_FUTURE].live == 1
+        @test leaks["Person"].live == 1
+
+        finalize(person)
+        finalize(future)
+        @test isempty(Glaze.leaked_since(before))
+    end
+
+    @testset "Native extension objects" begin
+        before = Glaze.live_objects()
+        stop = StopSource(lib)
+        native = [x for x in Glaze.leaked_since(before) if x.native]
+        @test length(native) == 1
+        @test native[1].name == "std::stop_source"
+        @test native[1].live == 1
+
+        finalize(stop)
+        @test isempty(Glaze.leaked_since(before))
+    end
+
+    @testset "Workload leaves nothing behind" begin
+        before = Glaze.live_objects()
+        for _ in 1:50
+            calc = lib.Calculator
+            calc.add(1.0)
+            lib.VectorProcessor.joinStrings(["x", "y"], "-")
+        end
+        GC.gc()
+        @test isempty(Glaze.leaked_since(before))
+    end
+end
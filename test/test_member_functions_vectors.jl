@@ -118,6 +118,9 @@ using Libdl
             
             # Test with single element
             @test processor.joinStrings(["Solo"], " | ") == "Solo"
+
+            # Non-ASCII elements and separators are passed by byte count
+            @test processor.joinStrings(["größe", "日本語", "∞"], " → ") == "größe → 日本語 → ∞"
         end
         
         @testset "Complex Vector Operations" begin
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/mdspan.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Image stored row by row with its dimensions in sibling members
+struct ImageData {
+    std::vector<float> pixels;
+    int32_t width = 4;
+    int32_t height = 3;
+
+#if defined(__cpp_lib_mdspan)
+    std::mdspan<float, std::dextents<size_t, 2>> rows;                     // layout_right
+    std::mdspan<float, std::dextents<size_t, 2>, std::layout_left> columns;
+    std::mdspan<float, std::dextents<size_t, 2>, std::layout_stride> even_columns;
+
+    std::mdspan<const float, std::dextents<size_t, 2>> pixel_view() const
+    {
+        return std::mdspan<const float, std::dextents<size_t, 2>>(pixels.data(), height, width);
+    }
+#endif
+};
+
+template <>
+struct glz::meta<ImageData> {
+    using T = ImageData;
+    static constexpr auto value = object("pixels", &T::pixels, "width", &T::width, "height", &T::height);
+};
+
+inline ImageData global_image = [] {
+    ImageData image;
+    // pixel (row r, column c) = 10 * r + c
+    for (int r = 0; r < image.height; ++r) {
+        for (int c = 0; c < image.width; ++c) {
+            image.pixels.push_back(float(10 * r + c));
+        }
+    }
+    return image;
+}();
+
+inline void register_multidim_view_test_types() {
+    glz::register_type<ImageData>("ImageData");
+
+#if defined(__cpp_lib_mdspan)
+    auto& image = global_image;
+    const size_t h = size_t(image.height), w = size_t(image.width);
+    image.rows = decltype(image.rows)(image.pixels.data(), h, w);
+    // Same pixels viewed as a width x height column-major matrix (the transpose)
+    image.columns = decltype(image.columns)(image.pixels.data(), w, h);
+    using stride_mapping = std::layout_stride::mapping<std::dextents<size_t, 2>>;
+    image.even_columns = decltype(image.even_columns)(
+        image.pixels.data(), stride_mapping(std::dextents<size_t, 2>(h, w / 2), std::array<size_t, 2>{w, 2}));
+
+    glz_jl::register_mdspan_member<&ImageData::rows>("ImageData", "rows");
+    glz_jl::register_mdspan_member<&ImageData::columns>("ImageData", "columns");
+    glz_jl::register_mdspan_member<&ImageData::even_columns>("ImageData", "even_columns");
+    glz_jl::register_mdspan_method<&ImageData::pixel_view>("ImageData", "pixel_view");
+#endif
+
+    glz::register_instance("global_image", global_image);
+}
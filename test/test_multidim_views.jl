@@ -0,0 +1,53 @@
+# Tests for multi-dimensional views over contiguous C++ buffers
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Multi-Dimensional Views" begin
+    image = Glaze.get_instance(lib, "global_image")
+    h, w = Int(image.height), Int(image.width)
+    expected = [Float32(10 * (r - 1) + (c - 1)) for r in 1:h, c in 1:w]
+
+    @testset "reshape_view" begin
+        rows = reshape_view(image.pixels, h, w; order=:row)
+        @test size(rows) == (h, w)
+        @test rows == expected
+        @test rows[2, 3] == 12.0f0
+
+        cols = reshape_view(image.pixels, (w, h))
+        @test cols isa CppArrayView{Float32, 2}
+        @test cols == permutedims(expected)
+
+        # Writes go to the C++ vector
+        rows[3, 4] = -1.0f0
+        @test image.pixels[end] == -1.0f0
+        rows[3, 4] = 23.0f0
+
+        # Usable with BLAS without copying
+        x = Float32[1, 2, 3, 4]
+        @test rows * x ≈ expected * x
+        @test cols' * x[1:w] ≈ expected * x[1:w]
+        @test pointer(cols) == pointer(array_view(image.pixels))
+        @test strides(cols) == (1, w)
+
+        @test_throws DimensionMismatch reshape_view(image.pixels, 5, 5)
+        @test_throws ArgumentError reshape_view(image.pixels, h, w; order=:diagonal)
+    end
+
+    # std::mdspan needs a C++23 standard library with <mdspan>
+    if Glaze.find_extension_member(image, :rows) !== nothing
+        @testset "std::mdspan members" begin
+            @test image.rows == expected
+            @test image.rows[2, 4] == 13.0f0
+            @test image.columns == permutedims(expected)
+            @test image.columns isa CppArrayView{Float32, 2}
+
+            even = image.even_columns
+            @test even isa CppStridedView{Float32, 2}
+            @test even == expected[:, 1:2:end]
+
+            # Method results are views of the same pixels
+            @test image.pixel_view == expected
+            @test pointer(parent(image.pixel_view)) == pointer(array_view(image.pixels))
+            @test_throws ErrorException image.rows = zeros(Float32, h, w)
+        end
+    end
+end
@@ -222,6 +222,10 @@ using Glaze
         Glaze.set_value!(opt_string, "hello optional")
         @test !isnothing(opt_string)
         @test Glaze.value(opt_string) == "hello optional"
+
+        # Non-ASCII strings are passed by byte count
+        Glaze.set_value!(opt_string, "größe → ∞")
+        @test Glaze.value(opt_string) == "größe → ∞"
         
         # Reset string
         Glaze.reset!(opt_string)
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/pointers.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Polymorphic hierarchy exposed through pointer members
+struct Shape {
+    virtual ~Shape() = default;
+    virtual double area() const = 0;
+};
+
+struct Circle : Shape {
+    double radius = 1.0;
+    double area() const override { return 3.141592653589793 * radius * radius; }
+};
+
+struct Rectangle : Shape {
+    double width = 1.0;
+    double height = 1.0;
+    double area() const override { return width * height; }
+};
+
+// Hierarchy without virtual functions, resolved through a discriminator
+struct Message {
+    std::string kind = "Message";
+};
+
+struct TextMessage : Message {
+    std::string text;
+    TextMessage() { kind = "TextMessage"; }
+};
+
+struct Scene {
+    std::string name = "scene";
+    std::unique_ptr<Shape> main_shape;
+    std::shared_ptr<Shape> shared_shape;
+    Shape* raw_shape = nullptr;
+    std::unique_ptr<Shape> empty_shape;
+    std::vector<std::unique_ptr<Shape>> shapes;
+    std::unique_ptr<Message> message;
+    // Pointers to non-struct values
+    std::unique_ptr<std::vector<float>> weights;
+    std::shared_ptr<std::string> label;
+    int32_t* counter = nullptr;
+    double* missing_value = nullptr;
+    std::vector<std::shared_ptr<std::string>> tags;
+};
+
+inline int32_t global_scene_counter = 7;
+
+// Pointees of std::vector<bool> are rejected at registration: the bits are packed,
+// so a contiguous element view would misread them
+static_assert(glz_jl::detail::is_vector_pointee_element<float>);
+static_assert(!glz_jl::detail::is_vector_pointee_element<bool>);
+
+template <>
+struct glz::meta<Circle> {
+    using T = Circle;
+    static constexpr auto value = object("radius", &T::radius, "area", &T::area);
+};
+
+template <>
+struct glz::meta<Rectangle> {
+    using T = Rectangle;
+    static constexpr auto value = object("width", &T::width, "height", &T::height, "area", &T::area);
+};
+
+template <>
+struct glz::meta<Message> {
+    using T = Message;
+    static constexpr auto value = object("kind", &T::kind);
+};
+
+template <>
+struct glz::meta<TextMessage> {
+    using T = TextMessage;
+    static constexpr auto value = object("kind", &T::kind, "text", &T::text);
+};
+
+template <>
+struct glz::meta<Scene> {
+    using T = Scene;
+    static constexpr auto value = object("name", &T::name);
+};
+
+inline Scene global_scene = [] {
+    Scene scene;
+    auto circle = std::make_unique<Circle>();
+    circle->radius = 2.0;
+    scene.main_shape = std::move(circle);
+
+    auto rect = std::make_shared<Rectangle>();
+    rect->width = 3.0;
+    rect->height = 4.0;
+    scene.shared_shape = rect;
+    scene.raw_shape = rect.get();
+
+    for (int i = 0; i < 100; ++i) {
+        if (i % 2 == 0) {
+            auto c = std::make_unique<Circle>();
+            c->radius = double(i);
+            scene.shapes.push_back(std::move(c));
+        }
+        else {
+            auto r = std::make_unique<Rectangle>();
+            r->width = double(i);
+            r->height = 2.0;
+            scene.shapes.push_back(std::move(r));
+        }
+    }
+    scene.shapes.push_back(nullptr);
+
+    auto message = std::make_unique<TextMessage>();
+    message->text = "hello";
+    scene.message = std::move(message);
+
+    scene.weights = std::make_unique<std::vector<float>>(std::vector<float>{0.5f, 1.5f, 2.5f});
+    scene.label = std::make_shared<std::string>("main scene");
+    scene.counter = &global_scene_counter;
+    scene.tags.push_back(std::make_shared<std::string>("a"));
+    scene.tags.push_back(scene.label);
+    scene.tags.push_back(nullptr);
+    return scene;
+}();
+
+inline void register_polymorphic_pointer_test_types() {
+    glz::register_type<Circle>("Circle");
+    glz::register_type<Rectangle>("Rectangle");
+    glz::register_type<Message>("Message");
+    glz::register_type<TextMessage>("TextMessage");
+    glz::register_type<Scene>("Scene");
+
+    glz_jl::register_derived<Shape, Circle>("Circle");
+    glz_jl::register_derived<Shape, Rectangle>("Rectangle");
+    glz_jl::register_derived<Message, TextMessage>("TextMessage");
+    glz_jl::register_derived<Message, Message>("Message");
+    glz_jl::register_discriminator<Message>([](const Message& m) -> std::string_view { return m.kind; });
+
+    glz_jl::register_pointer_member<&Scene::main_shape>("Scene", "main_shape", "Shape");
+    glz_jl::register_pointer_member<&Scene::shared_shape>("Scene", "shared_shape", "Shape");
+    glz_jl::register_pointer_member<&Scene::raw_shape>("Scene", "raw_shape", "Shape");
+    glz_jl::register_pointer_member<&Scene::empty_shape>("Scene", "empty_shape", "Shape");
+    glz_jl::register_pointer_member<&Scene::shapes>("Scene", "shapes", "Shape");
+    glz_jl::register_pointer_member<&Scene::message>("Scene", "message", "Message");
+    glz_jl::register_pointer_member<&Scene::weights>("Scene", "weights");
+    glz_jl::register_pointer_member<&Scene::label>("Scene", "label");
+    glz_jl::register_pointer_member<&Scene::counter>("Scene", "counter");
+    glz_jl::register_pointer_member<&Scene::missing_value>("Scene", "missing_value");
+    glz_jl::register_pointer_member<&Scene::tags>("Scene", "tags");
+
+    glz::register_instance("global_scene", global_scene);
+}
+
+// Registers one more pointer member on Scene after Julia has looked up its
+// extension members, to check that late registrations are seen
+extern "C" {
+    #ifdef _WIN32
+        __declspec(dllexport)
+    #else
+        __attribute__((visibility("default")))
+    #endif
+    void register_late_scene_member() {
+        glz_jl::register_pointer_member<&Scene::main_shape>("Scene", "late_shape", "Shape");
+    }
+}
@@ -0,0 +1,104 @@
+# Tests for pointer members resolved to their dynamic types
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Polymorphic Pointer Members" begin
+    scene = Glaze.get_instance(lib, "global_scene")
+
+    @testset "Pointer members" begin
+        main_shape = scene.main_shape
+        @test main_shape isa Glaze.CppStruct
+        @test unsafe_string(main_shape.info.name) == "Circle"
+        @test main_shape.radius == 2.0
+        @test main_shape.area() ≈ π * 4
+
+        # shared_ptr and raw pointer to the same Rectangle
+        shared = scene.shared_shape
+        raw = scene.raw_shape
+        @test unsafe_string(shared.info.name) == "Rectangle"
+        @test shared.ptr == raw.ptr
+        @test raw.area() == 12.0
+
+        # Views are zero-copy: writes go to the pointee
+        raw.width = 5.0
+        @test shared.width == 5.0
+        @test !shared.owned
+
+        @test scene.empty_shape === nothing
+        @test_throws ErrorException scene.main_shape = nothing
+    end
+
+    @testset "Discriminator resolution" begin
+        message = scene.message
+        @test unsafe_string(message.info.name) == "TextMessage"
+        @test message.text == "hello"
+    end
+
+    @testset "Vectors of pointers" begin
+        shapes = scene.shapes
+        @test shapes isa CppPointerVector
+        @test length(shapes) == 101
+        @test shapes[end] === nothing
+
+        names = [unsafe_string(s.info.name) for s in shapes if s !== nothing]
+        @test count(==("Circle"), names) == 50
+        @test count(==("Rectangle"), names) == 50
+        @test shapes[3].radius == 2.0
+        @test shapes[4].width == 3.0
+
+        total = sum(s.area() for s in shapes if s !== nothing)
+        expected = sum(isodd(i) ? 2.0 * i : π * i^2 for i in 0:99)
+        @test total ≈ expected
+
+        # Resolutions are cached per vtable
+        @test length(Glaze._vtable_cache) >= 2
+
+        # Threads walking one vector share its cache while the element types alternate
+        totals = zeros(max(4, 2 * Threads.nthreads()))
+        @sync for t in eachindex(totals)
+            Threads.@spawn totals[t] = sum(s.area() for s in shapes if s !== nothing)
+        end
+        @test all(≈(expected), totals)
+    end
+
+    @testset "Bulk pointee collection" begin
+        shapes = scene.shapes
+        pointees = collect_pointees(shapes)
+        @test length(pointees) == 101
+        @test pointees[end] === nothing
+        @test pointees[1].ptr == shapes[1].ptr
+        @test collect(shapes)[2].width == 1.0
+        @test pointer_kind(scene, :shapes) == :unique
+    end
+
+    @testset "Non-struct pointees" begin
+        @test pointer_kind(scene, :main_shape) == :unique
+        @test pointer_kind(scene, :shared_shape) == :shared
+        @test pointer_kind(scene, :raw_shape) == :raw
+
+        weights = scene.weights
+        @test weights isa CppVectorFloat32
+        @test collect(weights) == Float32[0.5, 1.5, 2.5]
+        weights[1] = 4.0f0
+        @test scene.weights[1] == 4.0f0
+
+        label = scene.label
+        @test label isa CppString
+        @test String(label) == "main scene"
+
+        @test scene.counter === Int32(7)
+        @test scene.missing_value === nothing
+
+        tags = scene.tags
+        @test length(tags) == 3
+        @test [t === nothing ? nothing : String(t) for t in tags] == ["a", "main scene", nothing]
+        # The shared_ptr element and the member share their pointee
+        @test tags[2].ptr == label.ptr
+    end
+
+    @testset "Members registered after first use" begin
+        @test Glaze.find_extension_member(scene, :late_shape) === nothing
+        ccall(Libdl.dlsym(lib.handle, :register_late_scene_member), Cvoid, ())
+        @test scene.late_shape.ptr == scene.main_shape.ptr
+        @test scene.main_shape.radius == 2.0
+    end
+end
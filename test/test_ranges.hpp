@@ -0,0 +1,61 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/ranges.hpp>
+#include <deque>
+#include <list>
+#include <set>
+#include <string>
+#include <unordered_set>
+
+struct Waypoint {
+    double x = 0.0;
+    double y = 0.0;
+
+    bool operator==(const Waypoint&) const = default;
+};
+
+template <>
+struct glz::meta<Waypoint> {
+    using T = Waypoint;
+    static constexpr auto value = object("x", &T::x, "y", &T::y);
+};
+
+// Non-contiguous containers exposed through glz_jl::register_range_member
+struct RouteIndex {
+    std::string name = "route";
+    std::deque<double> readings;
+    std::list<Waypoint> waypoints{{0.0, 0.0}, {1.0, 2.0}, {3.0, 5.0}};
+    std::set<int32_t> visited{7, 3, 11};
+    std::set<std::string, std::less<>> tags{"fast", "scenic", "toll"};
+    std::unordered_set<std::string> aliases{"a1", "b2"};
+
+    size_t tag_count() const { return tags.size(); }
+};
+
+template <>
+struct glz::meta<RouteIndex> {
+    using T = RouteIndex;
+    static constexpr auto value = object("name", &T::name, "tag_count", &T::tag_count);
+};
+
+inline RouteIndex global_route = [] {
+    RouteIndex route;
+    for (int i = 0; i < 1000; ++i) {
+        route.readings.push_back(0.5 * i);
+    }
+    return route;
+}();
+
+inline void register_range_test_types() {
+    glz::register_type<Waypoint>("Waypoint");
+    glz::register_type<RouteIndex>("RouteIndex");
+
+    glz_jl::register_range_member<&RouteIndex::readings>("RouteIndex", "readings");
+    glz_jl::register_range_member<&RouteIndex::waypoints>("RouteIndex", "waypoints", "Waypoint");
+    glz_jl::register_range_member<&RouteIndex::visited>("RouteIndex", "visited");
+    glz_jl::register_range_member<&RouteIndex::tags>("RouteIndex", "tags");
+    glz_jl::register_range_member<&RouteIndex::aliases>("RouteIndex", "aliases");
+
+    glz::register_instance("global_route", global_route);
+}
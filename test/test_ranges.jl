@@ -0,0 +1,92 @@
+# Tests for deque/list/set members iterated through the chunked range protocol
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Non-Contiguous Ranges" begin
+    route = Glaze.get_instance(lib, "global_route")
+
+    @testset "std::deque values" begin
+        readings = route.readings
+        @test readings isa CppRange{Float64}
+        @test length(readings) == 1000
+        # Spans several chunks
+        @test sum(readings) ≈ 0.5 * sum(0:999)
+        @test collect(readings)[end] == 499.5
+        @test 10.5 in readings
+        @test !(10.25 in readings)
+
+        push!(readings, -1.0)
+        @test length(route.readings) == 1001
+        @test last(collect(route.readings)) == -1.0
+        delete!(readings, -1.0)
+        @test length(route.readings) == 1000
+    end
+
+    @testset "std::list of structs" begin
+        waypoints = route.waypoints
+        @test waypoints isa CppRange{CppStruct}
+        @test [(w.x, w.y) for w in waypoints] == [(0.0, 0.0), (1.0, 2.0), (3.0, 5.0)]
+
+        # Elements are views into the list nodes
+        first(waypoints).y = 0.5
+        @test first(route.waypoints).y == 0.5
+
+        w = first(waypoints)
+        @test w in waypoints
+    end
+
+    @testset "std::set" begin
+        visited = route.visited
+        @test visited isa CppRange{Int32}
+        @test collect(visited) == Int32[3, 7, 11]   # ordered
+        @test 7 in visited
+        @test !(8 in visited)
+
+        push!(visited, 7)     # already present
+        @test length(visited) == 3
+        push!(visited, 1)
+        @test collect(visited) == Int32[1, 3, 7, 11]
+        delete!(visited, 1)
+        @test length(visited) == 3
+    end
+
+    @testset "std::string sets" begin
+        tags = route.tags
+        @test tags isa CppRange{CppString}
+        @test String.(collect(tags)) == ["fast", "scenic", "toll"]
+        # Heterogeneous lookup on std::set<std::string, std::less<>>
+        @test "scenic" in tags
+        @test !("slow" in tags)
+        @test SubString("toll road", 1, 4) in tags
+
+        push!(tags, "coastal")
+        @test route.tag_count() == 4
+        delete!(tags, "coastal")
+        @test route.tag_count() == 3
+
+        aliases = route.aliases
+        @test sort(String.(collect(aliases))) == ["a1", "b2"]
+        @test "a1" in aliases
+        @test !("c3" in aliases)
+    end
+
+    @testset "Assignment" begin
+        route.visited = [5, 2, 5]
+        @test collect(route.visited) == Int32[2, 5]
+        route.visited = Int32[3, 7, 11]
+        @test collect(route.visited) == Int32[3, 7, 11]
+    end
+
+    @testset "Early exit" begin
+        # Breaking out of a loop leaves the cursor to the finalizer
+        found = 0.0
+        for r in route.readings
+            if r > 2
+                found = r
+                break
+            end
+        end
+        @test found == 2.5
+        GC.gc()
+        @test length(route.readings) == 1000
+    end
+end
@@ -0,0 +1,115 @@
+# Tests for out-of-process execution over REPE
+# This file is included by runtests.jl, so lib and test_lib_path are already defined
+
+@testset "Remote Execution" begin
+    @testset "BEVE round trip" begin
+        for value in (nothing, true, false, Int32(-7), UInt64(1) << 40, 3.5, 1.5f0,
+                      ComplexF64(1, -2), "", "hello", Float32[1, 2, 3], Int64[],
+                      [true, false, true, true, false, false, true, false, true],
+                      ["a", "bc"], ComplexF32[1 + 2im, 3 - 4im], Any[1, "two", [3.0]],
+                      Dict{String, Any}("x" => 1.0, "nested" => Dict{String, Any}("y" => "z")))
+            @test isequal(Glaze.from_beve(Glaze.to_beve(value)), value)
+        end
+        # Sizes beyond the 1-byte compressed size encoding
+        big = rand(Float64, 100_000)
+        @test Glaze.from_beve(Glaze.to_beve(big)) == big
+    end
+
+    remote = Glaze.load_remote(test_lib_path; init=:init_test_types_complete)
+    try
+        @testset "Instances and members" begin
+            global_test = Glaze.get_instance(remote, "global_test")
+            @test global_test isa RemoteStruct
+            @test :int_value in propertynames(global_test)
+            @test global_test.int_value == 42
+            @test global_test.string_value == "Global test string"
+            @test global_test.float_vector == Float32[1, 2, 3]
+            @test global_test.complex_vector ≈ ComplexF32[1 + 1im, 2 - 1im]
+
+            global_test.int_value = 7
+            @test global_test.int_value == 7
+            global_test.float_vector = Float32.(1:1000)
+            @test sum(global_test.float_vector) == sum(Float32.(1:1000))
+            @test global_test[]["int_value"] == 7
+        end
+
+        @testset "Nested structs" begin
+            person = remote.Person
+            person.name = "Ada"
+            person.address.city = "London"
+            person.scores = Int32[90, 95]
+            @test person.address isa RemoteStruct
+            @test person.address.city == "London"
+            @test person[]["address"]["city"] == "London"
+            @test person.scores == Int32[90, 95]
+        end
+
+        @testset "Reserved and escaped member names" begin
+            names = remote.TestReservedNames
+            names.path = "/tmp/data"
+            names.handle = 3
+            names.remote = 1.5
+            names.schema = true
+            setproperty!(names, Symbol("m/s~2"), 9.81)
+            @test names.path == "/tmp/data"
+            @test names.handle == 3
+            @test names.remote == 1.5
+            @test names.schema == true
+            @test getproperty(names, Symbol("m/s~2")) == 9.81
+            @test fetch(Glaze.remote_get(names, Symbol("m/s~2"))) == 9.81
+            @test names[]["m/s~2"] == 9.81
+        end
+
+        @testset "Extension members" begin
+            light = Glaze.get_instance(remote, "global_light")
+            @test :level in propertynames(light)
+            light.level = "Dim"
+            @test light.level == "Dim"
+            # Generators cannot stream across the process boundary
+            feed = remote.TradeFeed
+            @test :ids in propertynames(feed)
+            @test_throws ErrorException feed.ids
+        end
+
+        @testset "Member functions" begin
+            calc = remote.Calculator
+            calc.value = 2.0
+            @test calc.add(3.0) == 5.0
+            @test calc.getValue() == 5.0
+            calc.reset()
+            @test calc.value == 0.0
+            @test_throws ErrorException calc.add = 1.0
+        end
+
+        @testset "Pipelining and batching" begin
+            calc = remote.Calculator
+            futures = [Glaze.remote_call(calc.add, 1.0) for _ in 1:100]
+            @test fetch.(futures) == collect(1.0:100.0)
+
+            global_test = Glaze.get_instance(remote, "global_test")
+            futures = Glaze.batch(remote) do
+                [Glaze.remote_get(global_test, name) for name in (:int_value, :bool_value, :string_value)]
+            end
+            @test fetch.(futures) == [7, true, "Global test string"]
+        end
+
+        @testset "Errors" begin
+            @test_throws ErrorException remote.NoSuchType
+            @test_throws ErrorException Glaze.get_instance(remote, "non_existent")
+            global_test = Glaze.get_instance(remote, "global_test")
+            @test_throws ErrorException global_test.no_such_member
+            @test_throws ErrorException global_test.int_value = "not a number"
+            @test isopen(remote)
+        end
+
+        @testset "Child process failure" begin
+            calc = remote.Calculator
+            kill(getfield(remote, :process))
+            wait(getfield(remote, :process))
+            @test_throws ErrorException calc.getValue()
+            @test !isopen(remote)
+        end
+    finally
+        process_running(getfield(remote, :process)) && close(remote)
+    end
+end
@@ -0,0 +1,90 @@
+# Tests for Serialization of Glaze wrappers
+# This file is included by runtests.jl, so lib is already defined
+
+using Serialization
+
+serialize_roundtrip(x) = (io = IOBuffer(); serialize(io, x); seekstart(io); deserialize(io))
+
+@testset "Serialization" begin
+    @testset "CppStruct" begin
+        obj = lib.TestAllTypes
+        obj.int_value = 11
+        obj.float_value = 1.25f0
+        obj.bool_value = true
+        obj.string_value = "serialized"
+        resize!(obj.float_vector, 4)
+        array_view(obj.float_vector) .= Float32[1, 2, 3, 4]
+        push!(obj.complex_vector, ComplexF32(1, -1))
+
+        restored = serialize_roundtrip(obj)
+        @test restored isa Glaze.CppStruct
+        @test restored.ptr != obj.ptr
+        @test restored.int_value == 11
+        @test restored.float_value == 1.25f0
+        @test restored.bool_value == true
+        @test restored.string_value == "serialized"
+        @test collect(restored.float_vector) == Float32[1, 2, 3, 4]
+        @test collect(restored.complex_vector) == [ComplexF32(1, -1)]
+
+        # The copy is independent of the original
+        restored.int_value = 0
+        @test obj.int_value == 11
+    end
+
+    @testset "Nested structs" begin
+        person = lib.Person
+        person.name = "Grace"
+        person.age = 85
+        person.address.city = "Arlington"
+        push!(person.scores, 100)
+
+        restored = serialize_roundtrip(person)
+        @test restored.name == "Grace"
+        @test restored.age == 85
+        @test restored.address.city == "Arlington"
+        @test collect(restored.scores) == Int32[100]
+
+        # A nested member serializes as a standalone instance of its type
+        address = serialize_roundtrip(person.address)
+        @test address isa Glaze.CppStruct
+        @test address.city == "Arlington"
+    end
+
+    @testset "Native and Julia-side encoding" begin
+        # Person is registered with glz_jl::register_beve, Address is not
+        person = lib.Person
+        @test Glaze.native_beve(person) isa Vector{UInt8}
+        @test Glaze.native_beve(person.address) === nothing
+
+        # Types with extension members cannot be encoded member by member from Julia
+        light = Glaze.get_instance(lib, "global_light")
+        @test Glaze.native_beve(light) === nothing
+        @test_throws ErrorException serialize(IOBuffer(), light)
+    end
+
+    @testset "Library lookup" begin
+        path = Libdl.dlpath(lib.handle)
+        @test Glaze.library_for_path(path).handle == lib.handle
+        # Another file with the same name is a different library
+        @test_throws ErrorException Glaze.library_for_path(joinpath(tempdir(), "elsewhere", basename(path)))
+    end
+
+    @testset "Optionals" begin
+        opt = Glaze.get_instance(lib, "global_optional_with_values")
+        restored = serialize_roundtrip(opt)
+        @test Glaze.value(restored.opt_int) == 42
+        @test Glaze.value(restored.opt_string) == "test string"
+        @test restored.required_field == "required field value"
+        @test serialize_roundtrip(opt.opt_int) == 42
+    end
+
+    @testset "Containers" begin
+        obj = lib.TestAllTypes
+        obj.string_value = "text"
+        resize!(obj.float_vector, 3)
+        array_view(obj.float_vector) .= Float32[5, 6, 7]
+        @test serialize_roundtrip(obj.string_value) == "text"
+        @test serialize_roundtrip(obj.float_vector) == Float32[5, 6, 7]
+        @test serialize_roundtrip(obj.float_vector) isa Vector{Float32}
+    end
+end
@@ -0,0 +1,111 @@
+# Tests for named shared-memory segments
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Shared Memory" begin
+    segment = "glaze_test_$(getpid())"
+
+    @testset "Publish and attach" begin
+        seg = Glaze.create_segment(segment, 1 << 20)
+        try
+            obj = lib.TestAllTypes
+            obj.int_value = 42
+            obj.float_value = 2.5f0
+            obj.string_value = "shared"
+            resize!(obj.float_vector, 1000)
+            array_view(obj.float_vector) .= Float32.(1:1000)
+            push!(obj.complex_vector, 1.0f0 + 2.0f0im)
+
+            Glaze.publish!(seg, "state", obj)
+            Glaze.publish!(seg, "weights", collect(1.0:0.5:10.0))
+
+            state = Glaze.attach(lib, segment, "state")
+            @test state isa Glaze.SharedInstance
+            @test getfield(state, :type_name) == "TestAllTypes"
+            @test state.int_value == 42
+            @test state.float_value == 2.5f0
+            @test state.string_value == "shared"
+            @test :float_vector in propertynames(state)
+
+            values = state.float_vector
+            @test values isa Glaze.SharedMemoryView{Float32,1}
+            @test length(values) == 1000
+            @test sum(values) == sum(Float32.(1:1000))
+            @test state.complex_vector == [1.0f0 + 2.0f0im]
+            @test_throws ErrorException values[1] = 0.0f0
+
+            weights = Glaze.attach(segment, "weights")
+            @test weights == collect(1.0:0.5:10.0)
+
+            # The published copy is independent of the live C++ object
+            obj.int_value = 0
+            @test state.int_value == 42
+
+            @test_throws ErrorException Glaze.publish!(seg, "weights", [1.0])
+            @test_throws ErrorException Glaze.attach(segment, "missing")
+
+            # Members without a flat representation are rejected, and nothing is written
+            @test_throws ErrorException Glaze.publish!(seg, "opt", Glaze.get_instance(lib, "global_optional_with_values"))
+            @test_throws ErrorException Glaze.publish!(seg, "light", Glaze.get_instance(lib, "global_light"))
+            @test !any(startswith("opt"), keys(seg.index))
+            @test !any(startswith("light"), keys(seg.index))
+
+            # The attaching library must register the type with the same members
+            Glaze.publish!(seg, "person", lib.Person)
+            @test Glaze.attach(lib, segment, "person").address isa Glaze.SharedInstance
+            Glaze.publish!(seg, "renamed", 1.0)
+            bogus = Glaze.SharedInstance(seg, "renamed", "Person")
+            @test_throws ErrorException Glaze.check_shared_layout(lib, bogus)
+
+            # Members named like the instance's fields, and names that need escaping
+            reserved = lib.TestReservedNames
+            reserved.path = "/data"
+            reserved.schema = true
+            setproperty!(reserved, Symbol("m/s~2"), 9.81)
+            Glaze.publish!(seg, "reserved", reserved)
+            shared = Glaze.attach(lib, segment, "reserved")
+            @test shared.path == "/data"
+            @test shared.schema == true
+            @test getproperty(shared, Symbol("m/s~2")) == 9.81
+            @test Symbol("m/s~2") in propertynames(shared)
+        finally
+            Glaze.unlink_segment(segment)
+        end
+        @test_throws ErrorException Glaze.open_segment(segment)
+    end
+
+    @testset "Recreate and close" begin
+        seg = Glaze.create_segment(segment, 1 << 16)
+        try
+            Glaze.publish!(seg, "values", Int64.(1:100))
+            values = Glaze.attach(segment, "values")
+            # Recreating unlinks the old file instead of truncating it under its readers
+            fresh = Glaze.create_segment(segment, 1 << 16)
+            @test sum(values) == 5050
+            @test_throws ErrorException Glaze.attach(segment, "values")
+
+            close(fresh)
+            @test !isopen(fresh)
+            @test occursin("closed", string(fresh))
+            @test_throws ErrorException Glaze.publish!(fresh, "x", 1.0)
+        finally
+            Glaze.unlink_segment(segment)
+        end
+    end
+
+    @testset "Attach from another process" begin
+        seg = Glaze.create_segment(segment, 1 << 16)
+        try
+            Glaze.publish!(seg, "values", Int64.(1:100))
+            project = dirname(Base.active_project())
+            code = """
+                using Glaze
+                v = Glaze.attach("$segment", "values")
+                print(sum(v))
+                """
+            output = read(`$(Base.julia_cmd()) --project=$project -e $code`, String)
+            @test output == "5050"
+        finally
+            Glaze.unlink_segment(segment)
+        end
+    end
+end
@@ -1,6 +1,21 @@
 #include "test_structs_glaze_simple.hpp"
 #include "test_shared_future.hpp"
 #include "test_all_types.hpp"
+#include "test_change_tracking.hpp"
+#include "test_polymorphic_pointers.hpp"
+#include "test_fixed_arrays.hpp"
+#include "test_multidim_views.hpp"
+#include "test_jagged_vectors.hpp"
+#include "test_bit_vectors.hpp"
+#include "test_half_precision.hpp"
+#include "test_enums.hpp"
+#include "test_tuples.hpp"
+#include "test_chrono.hpp"
+#include "test_ranges.hpp"
+#include "test_generators.hpp"
+#include "test_cancellation.hpp"
+#include "test_generic_json.hpp"
+#include <glaze_jl/beve.hpp>
 // Map types are not yet supported in Glaze.jl
 // #include "test_map_types.hpp"
 
@@ -37,6 +52,52 @@ extern "C" {
         // Initialize variant test types
         init_variant_test_types();
         
+        // Initialize change tracking test types
+        register_change_tracking_test_types();
+        
+        // Initialize pointer member test types
+        register_polymorphic_pointer_test_types();
+        
+        // Initialize std::array member test types
+        register_fixed_array_test_types();
+        
+        // Initialize multi-dimensional view test types
+        register_multidim_view_test_types();
+        
+        // Initialize jagged vector test types
+        register_jagged_vector_test_types();
+        
+        // Initialize packed bit member test types
+        register_bit_vector_test_types();
+        
+        // Initialize half-precision test types
+        register_half_precision_test_types();
+        
+        // Initialize enum member test types
+        register_enum_test_types();
+        
+        // Initialize pair and tuple member test types
+        register_tuple_test_types();
+        
+        // Initialize std::chrono member test types
+        register_chrono_test_types();
+        
+        // Initialize non-contiguous range test types
+        register_range_test_types();
+        
+        // Initialize generator method test types
+        register_generator_test_types();
+        
+        // Initialize cancellable method test types
+        register_cancellation_test_types();
+        
+        // Initialize glz::generic member test types
+        register_generic_json_test_types();
+        
+        // Encode these natively when Julia serializes them
+        glz_jl::register_beve<Person>("Person");
+        glz_jl::register_beve<TestAllTypes>("TestAllTypes");
+        
         // Map test types are not yet supported in Glaze.jl
         // register_map_test_types();
         
@@ -0,0 +1,69 @@
+# Tests for interop calls made from several threads at once
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Multi-threaded Access" begin
+    ntasks = max(4, 2 * Threads.nthreads())
+
+    @testset "SnapshotDict" begin
+        d = Glaze.SnapshotDict{Int, String}()
+        @test get(d, 1, nothing) === nothing
+        @test get!(() -> "one", d, 1) == "one"
+        @test get!(() -> error("not called on a hit"), d, 1) == "one"
+        d[2] = "two"
+        @test length(d) == 2
+        @test sort!(collect(keys(Glaze.snapshot(d)))) == [1, 2]
+
+        # Concurrent misses on the same keys agree on one published value
+        d = Glaze.SnapshotDict{Int, Vector{Int}}()
+        seen = Vector{Vector{Vector{Int}}}(undef, ntasks)
+        @sync for t in 1:ntasks
+            Threads.@spawn seen[t] = [get!(() -> [k], d, k) for k in 1:200]
+        end
+        @test length(d) == 200
+        @test all(t -> all(k -> seen[t][k] === Glaze.snapshot(d)[k], 1:200), 1:ntasks)
+
+        # Writers may run inside finalizers, including while the same thread writes:
+        # inserts copy the table, so they allocate and can trigger a collection
+        d = Glaze.SnapshotDict{Int, Int}()
+        for k in 1:2000
+            finalizer(x -> (d[-x[]] = x[]), Ref(k))
+            d[k] = k
+        end
+        GC.gc()
+        @test all(k -> get(d, k, 0) == k, 1:2000)
+    end
+
+    @testset "Distinct objects" begin
+        calcs = [lib.Calculator for _ in 1:ntasks]
+        results = zeros(ntasks)
+        @sync for t in 1:ntasks
+            Threads.@spawn begin
+                calc = calcs[t]
+                add = calc.add
+                for _ in 1:1000
+                    add(Float64(t))
+                end
+                results[t] = calc.value
+            end
+        end
+        @test results == [1000.0 * t for t in 1:ntasks]
+        foreach(finalize, calcs)
+    end
+
+    @testset "Temporaries and instances" begin
+        before = Glaze.live_objects()
+        joined = Vector{String}(undef, ntasks)
+        @sync for t in 1:ntasks
+            Threads.@spawn begin
+                for i in 1:100
+                    processor = lib.VectorProcessor
+                    joined[t] = processor.joinStrings(["t$t", "i$i"], "-")
+                    finalize(processor)
+                end
+            end
+        end
+        @test joined == ["t$t-i100" for t in 1:ntasks]
+        GC.gc()
+        @test isempty(Glaze.leaked_since(before))
+    end
+end
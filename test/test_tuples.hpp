@@ -0,0 +1,37 @@
+#pragma once
+
+#include <glaze/interop/interop.hpp>
+#include <glaze_jl/tuples.hpp>
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <utility>
+
+// Pair and tuple members exposed through glz_jl::register_tuple_member
+struct Segment {
+    std::string label = "segment";
+    std::pair<double, double> range{-1.0, 1.0};
+    std::pair<int32_t, int32_t> indices{3, 7};
+    std::tuple<int32_t, float, std::complex<double>> sample{5, 2.5f, {1.0, -1.0}};
+
+    double width() const { return range.second - range.first; }
+};
+
+template <>
+struct glz::meta<Segment> {
+    using T = Segment;
+    static constexpr auto value = object("label", &T::label, "width", &T::width);
+};
+
+inline Segment global_segment{};
+
+inline void register_tuple_test_types() {
+    glz::register_type<Segment>("Segment");
+
+    glz_jl::register_tuple_member<&Segment::range>("Segment", "range");
+    glz_jl::register_tuple_member<&Segment::indices>("Segment", "indices");
+    glz_jl::register_tuple_member<&Segment::sample>("Segment", "sample");
+
+    glz::register_instance("global_segment", global_segment);
+}
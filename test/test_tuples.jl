@@ -0,0 +1,36 @@
+# Tests for std::pair and std::tuple read as isbits Julia tuples
+# This file is included by runtests.jl, so lib is already defined
+
+@testset "Pair and Tuple Members" begin
+    segment = Glaze.get_instance(lib, "global_segment")
+
+    @testset "Pairs" begin
+        @test segment.range === (-1.0, 1.0)
+        @test segment.indices === (Int32(3), Int32(7))
+        @test isbits(segment.range)
+
+        segment.range = (0.0, 4.0)
+        @test segment.width() == 4.0
+        segment.range = 1 => 2
+        @test segment.range === (1.0, 2.0)
+        @test_throws ErrorException segment.range = (1.0, 2.0, 3.0)
+
+        # Same layout as the Julia tuple: read with a single load
+        range_member = Glaze.find_extension_member(segment, :range)
+        @test Glaze.tuple_layout(range_member.type).direct
+    end
+
+    @testset "Tuples" begin
+        sample = segment.sample
+        @test sample isa Tuple{Int32, Float32, ComplexF64}
+        @test sample === (Int32(5), 2.5f0, 1.0 - 1.0im)
+
+        segment.sample = (6, 0.5, 2.0im)
+        @test segment.sample === (Int32(6), 0.5f0, 0.0 + 2.0im)
+    end
+
+    @testset "Tuple returns" begin
+        processor = lib.VectorProcessor
+        @test processor.findMinMax([2.0, -1.0, 5.0]) === (-1.0, 5.0)
+    end
+end
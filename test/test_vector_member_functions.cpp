@@ -1,5 +1,6 @@
 #include "test_vector_member_functions.hpp"
 #include "test_structs_glaze_simple.hpp"
+#include <glaze_jl/tuples.hpp>
 
 // Register vector test types
 void register_vector_test_types() {
@@ -9,6 +10,7 @@ void register_vector_test_types() {
     // Explicitly register pair type used by findMinMax
     // The automatic registration in create_type_descriptor might not work due to static initialization order
     glz::register_type<std::pair<double, double>>("std::pair<double, double>");
+    glz_jl::register_tuple_type<std::pair<double, double>>("std::pair<double, double>");
 }
 
 // Global instances are defined in test_structs_glaze_simple.hpp
@@ -0,0 +1,112 @@
+# Tests that the hot interop paths do not allocate once compiled
+# This file is included by runtests.jl, so lib is already defined
+
+# Every operation runs through a function so @allocated measures the call
+# itself rather than global-scope boxing; the first call compiles it
+allocs(f, args...) = (f(args...); @allocated f(args...))
+
+read_member(obj, name, T) = getmember(obj, name, T)
+write_member!(obj, name, x) = (setproperty!(obj, name, x); nothing)
+
+get_at(v, i) = v[i]
+set_at!(v, x, i) = (v[i] = x; nothing)
+view_length(v) = length(array_view(v))
+
+function sum_loop(v)
+    s = zero(eltype(v))
+    for x in v
+        s += x
+    end
+    return s
+end
+
+call0(f) = f()
+call1(f, a) = f(a)
+call3(f, a, b, c) = f(a, b, c)
+
+@testset "Zero-Allocation Hot Paths" begin
+    @testset "Primitive member reads and writes" begin
+        ints = lib.TestIntegerTypes
+        for (name, x) in ((:i8_value, Int8(-8)), (:i16_value, Int16(-16)), (:i32_value, Int32(-32)),
+                          (:i64_value, Int64(-64)), (:u8_value, UInt8(8)), (:u16_value, UInt16(16)),
+                          (:u32_value, UInt32(32)), (:u64_value, UInt64(64)))
+            @test allocs(write_member!, ints, name, x) == 0
+            @test allocs(read_member, ints, name, typeof(x)) == 0
+            @test read_member(ints, name, typeof(x)) === x
+        end
+
+        floats = lib.TestFloatTypes
+        @test allocs(write_member!, floats, :f32_value, 1.25f0) == 0
+        @test allocs(write_member!, floats, :f64_value, 2.5) == 0
+        @test allocs(read_member, floats, :f32_value, Float32) == 0
+        @test allocs(read_member, floats, :f64_value, Float64) == 0
+        @test read_member(floats, :f64_value, Float64) === 2.5
+
+        basic = lib.TestBasicTypes
+        @test allocs(write_member!, basic, :bool_value, true) == 0
+        @test allocs(read_member, basic, :bool_value, Bool) == 0
+        @test read_member(basic, :bool_value, Bool) === true
+
+        @test_throws ErrorException getmember(floats, :f64_value, Float32)
+        @test_throws ErrorException getmember(basic, :string_value, Float64)
+        @test_throws ErrorException getmember(floats, :missing, Float64)
+    end
+
+    @testset "Specialized vector element access" begin
+        obj = lib.TestFloatVectors
+        for (name, x) in ((:vec_f32, 1.5f0), (:vec_f64, 2.5), (:vec_complex_f32, ComplexF32(1, -1)),
+                          (:vec_complex_f64, ComplexF64(2, -2)))
+            v = getproperty(obj, name)
+            resize!(v, 64)
+            for i in 1:64
+                v[i] = x
+            end
+
+            @test allocs(get_at, v, 10) == 0
+            @test allocs(set_at!, v, x, 10) == 0
+            @test allocs(length, v) == 0
+            @test allocs(sum_loop, v) == 0
+            @test sum_loop(v) ≈ 64 * x
+            @test_throws BoundsError v[65]
+        end
+    end
+
+    @testset "array_view creation" begin
+        obj = lib.TestFloatVectors
+        v = obj.vec_f64
+        resize!(v, 16)
+        @test allocs(array_view, v) == 0
+        @test allocs(view_length, v) == 0
+        @test view_length(v) == 16
+        @test allocs(array_view, obj.vec_f32) == 0
+        @test allocs(array_view, obj.vec_complex_f64) == 0
+    end
+
+    @testset "Member calls with primitive arguments" begin
+        calc = get_instance(lib, "global_calculator")
+        add = calc.add
+        compute = calc.compute
+        set_value = calc.setValue
+        get_value = calc.getValue
+        reset = calc.reset
+        @test add isa CppMemberFunction{Float64}
+        @test set_value isa CppMemberFunction{Nothing}
+        @test calc.describe isa CppMemberFunction{Any}
+
+        saved = get_value()
+        @test allocs(call1, set_value, 1.0) == 0
+        @test allocs(call0, get_value) == 0
+        @test allocs(call1, add, 0.5) == 0
+        @test allocs(call3, compute, 1.0, 2.0, 3.0) == 0
+        @test allocs(call0, reset) == 0
+
+        set_value(2.0)
+        @test call1(add, 1.5) === 3.5
+        @test call0(get_value) === 3.5
+        @test call1(set_value, 4.0) === nothing
+        # Integer arguments convert like the general call path
+        @test call1(add, 1) === 5.0
+        @test_throws ErrorException add()
+        set_value(saved)
+    end
+end